@@ -41,9 +41,9 @@ inline VertexIndex findSourceVertex(std::vector<size_t> geodesicLengths) {
     return source;
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <typename Graph>
 Path findPathToVertexFromPredecessors(
-    const Graph<EdgeLabel> &graph, VertexIndex source, VertexIndex destination,
+    const Graph &graph, VertexIndex source, VertexIndex destination,
     const Predecessors &distancesPredecessors) {
     if (source == destination)
         return {source};
@@ -64,18 +64,18 @@ Path findPathToVertexFromPredecessors(
     return path;
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <typename Graph>
 Path findPathToVertexFromPredecessors(
-    const Graph<EdgeLabel> &graph, VertexIndex destination,
+    const Graph &graph, VertexIndex destination,
     const Predecessors &distancesPredecessors) {
     VertexIndex source = findSourceVertex(distancesPredecessors.first);
     return findPathToVertexFromPredecessors(graph, source, destination,
                                             distancesPredecessors);
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <typename Graph>
 MultiplePaths findMultiplePathsToVertexFromPredecessors(
-    const Graph<EdgeLabel> &graph, VertexIndex source, VertexIndex destination,
+    const Graph &graph, VertexIndex source, VertexIndex destination,
     const MultiplePredecessors &distancesPredecessors) {
     if (source == destination)
         return {{source}};
@@ -119,18 +119,17 @@ MultiplePaths findMultiplePathsToVertexFromPredecessors(
     return paths;
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <typename Graph>
 MultiplePaths findMultiplePathsToVertexFromPredecessors(
-    const Graph<EdgeLabel> &graph, VertexIndex destination,
+    const Graph &graph, VertexIndex destination,
     const MultiplePredecessors &distancesPredecessors) {
     VertexIndex source = findSourceVertex(distancesPredecessors.first);
     return findMultiplePathsToVertexFromPredecessors(graph, source, destination,
                                                      distancesPredecessors);
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
-Predecessors findVertexPredecessors(const Graph<EdgeLabel> &graph,
-                                      VertexIndex vertex) {
+template <typename Graph>
+Predecessors findVertexPredecessors(const Graph &graph, VertexIndex vertex) {
     VertexIndex currentVertex = vertex;
     size_t verticesNumber = graph.getSize();
 
@@ -159,8 +158,8 @@ Predecessors findVertexPredecessors(const Graph<EdgeLabel> &graph,
     return {std::move(shortestPaths), std::move(predecessors)};
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
-Path findGeodesics(const Graph<EdgeLabel> &graph, VertexIndex source,
+template <typename Graph>
+Path findGeodesics(const Graph &graph, VertexIndex source,
                    VertexIndex destination) {
     if (source == destination)
         return {source};
@@ -174,9 +173,9 @@ Path findGeodesics(const Graph<EdgeLabel> &graph, VertexIndex source,
         return {};
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
-MultiplePredecessors findAllVertexPredecessors(const Graph<EdgeLabel> &graph,
-                                                 VertexIndex vertex) {
+template <typename Graph>
+MultiplePredecessors findAllVertexPredecessors(const Graph &graph,
+                                               VertexIndex vertex) {
     VertexIndex currentVertex = vertex;
     size_t verticesNumber = graph.getSize();
 
@@ -216,9 +215,9 @@ MultiplePredecessors findAllVertexPredecessors(const Graph<EdgeLabel> &graph,
     return {std::move(shortestPaths), std::move(predecessors)};
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
-MultiplePaths findAllGeodesics(const Graph<EdgeLabel> &graph,
-                               VertexIndex source, VertexIndex destination) {
+template <typename Graph>
+MultiplePaths findAllGeodesics(const Graph &graph, VertexIndex source,
+                               VertexIndex destination) {
     if (source == destination)
         return {{source}};
 
@@ -231,8 +230,8 @@ MultiplePaths findAllGeodesics(const Graph<EdgeLabel> &graph,
         return {};
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
-std::vector<Path> findGeodesicsFromVertex(const Graph<EdgeLabel> &graph,
+template <typename Graph>
+std::vector<Path> findGeodesicsFromVertex(const Graph &graph,
                                           VertexIndex vertex) {
     auto predecessors = findVertexPredecessors(graph, vertex);
     std::vector<Path> geodesics;
@@ -247,9 +246,9 @@ std::vector<Path> findGeodesicsFromVertex(const Graph<EdgeLabel> &graph,
     return geodesics;
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <typename Graph>
 std::vector<MultiplePaths>
-findAllGeodesicsFromVertex(const Graph<EdgeLabel> &graph, VertexIndex vertex) {
+findAllGeodesicsFromVertex(const Graph &graph, VertexIndex vertex) {
     auto predecessors = findAllVertexPredecessors(graph, vertex);
 
     std::vector<MultiplePaths> allGeodesics;
@@ -286,9 +285,9 @@ findGeodesicsDijkstra(const Graph &graph, VertexIndex source) {
         auto vertex = unprocessedVertices.front();
         std::pop_heap(unprocessedVertices.begin(), unprocessedVertices.end());
         unprocessedVertices.pop_back();
+        auto weight = graph.getOutEdgeWeights(vertex).begin();
         for (auto &neighbour : graph.getOutNeighbours(vertex)) {
-            EdgeWeight newPathLength =
-                distances[vertex] + graph.getEdgeWeight(vertex, neighbour);
+            EdgeWeight newPathLength = distances[vertex] + *weight++;
             if (newPathLength < distances[neighbour]) {
                 distances[neighbour] = newPathLength;
                 predecessors[neighbour] = vertex;
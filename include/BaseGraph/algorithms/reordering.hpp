@@ -0,0 +1,284 @@
+#ifndef BASE_GRAPH_REORDERING_HPP
+#define BASE_GRAPH_REORDERING_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "BaseGraph/graph_views.hpp"
+#include "BaseGraph/types.h"
+
+namespace BaseGraph {
+namespace algorithms {
+
+/*
+ * The orderings below return the new index of each vertex, which is the
+ * argument expected by the `getPermutedGraph` method of the graphs:
+ *
+ *     auto newIndices = algorithms::getReverseCuthillMcKeeOrdering(graph);
+ *     auto reorderedGraph = graph.getPermutedGraph(newIndices);
+ *
+ * For directed graphs, only the out edges are followed. The orderings of the
+ * underlying undirected graph are obtained by passing a @ref
+ * SymmetrizedGraphView.
+ */
+
+/// Returns the number of out neighbours of each vertex of \p graph.
+template <typename Graph>
+std::vector<size_t> countOutNeighbours(const Graph &graph) {
+    std::vector<size_t> degrees(graph.getSize());
+    for (VertexIndex i : graph) {
+        auto neighbours = graph.getOutNeighbours(i);
+        degrees[i] = std::distance(neighbours.begin(), neighbours.end());
+    }
+    return degrees;
+}
+
+/// Sorts the vertices by \p degrees with a stable counting sort, in
+/// \f$O(V+E)\f$. Returns the vertices in the sorted order.
+inline std::vector<VertexIndex>
+sortVerticesByDegree(const std::vector<size_t> &degrees, bool decreasing) {
+    size_t maxDegree = 0;
+    for (size_t degree : degrees)
+        maxDegree = std::max(maxDegree, degree);
+
+    std::vector<size_t> offsets(maxDegree + 2, 0);
+    for (size_t degree : degrees)
+        ++offsets[(decreasing ? maxDegree - degree : degree) + 1];
+    for (size_t d = 0; d <= maxDegree; ++d)
+        offsets[d + 1] += offsets[d];
+
+    std::vector<VertexIndex> order(degrees.size());
+    for (VertexIndex i = 0; i < degrees.size(); ++i)
+        order[offsets[decreasing ? maxDegree - degrees[i] : degrees[i]]++] = i;
+    return order;
+}
+
+/// Returns the new index of each vertex when the vertices are visited in \p
+/// order (i.e. `newIndices[order[k]] = k`).
+inline std::vector<VertexIndex>
+orderToNewIndices(const std::vector<VertexIndex> &order) {
+    std::vector<VertexIndex> newIndices(order.size());
+    for (VertexIndex k = 0; k < order.size(); ++k)
+        newIndices[order[k]] = k;
+    return newIndices;
+}
+
+/**
+ * Orders the vertices by out degree, in \f$O(V+E)\f$. Vertices of equal
+ * degree keep their relative order. Placing the hubs first groups the
+ * vertices that are accessed the most.
+ *
+ * @param decreasing If `true`, the vertex of largest degree gets index 0.
+ * @return New index of each vertex.
+ */
+template <typename Graph>
+std::vector<VertexIndex>
+getDegreeOrdering(const Graph &graph, bool decreasing = true) {
+    return orderToNewIndices(
+        sortVerticesByDegree(countOutNeighbours(graph), decreasing)
+    );
+}
+
+/**
+ * Orders the vertices by a breadth-first search that starts at \p source and
+ * restarts at the smallest unvisited vertex until every vertex is visited, in
+ * \f$O(V+E)\f$. Neighbouring vertices end up with close indices.
+ *
+ * @return New index of each vertex.
+ */
+template <typename Graph>
+std::vector<VertexIndex>
+getBreadthFirstOrdering(const Graph &graph, VertexIndex source = 0) {
+    const size_t size = graph.getSize();
+    std::vector<VertexIndex> order;
+    order.reserve(size);
+    std::vector<bool> visited(size, false);
+
+    auto visitFrom = [&](VertexIndex root) {
+        size_t next = order.size();
+        visited[root] = true;
+        order.push_back(root);
+        while (next < order.size()) {
+            VertexIndex vertex = order[next++];
+            for (VertexIndex neighbour : graph.getOutNeighbours(vertex))
+                if (!visited[neighbour]) {
+                    visited[neighbour] = true;
+                    order.push_back(neighbour);
+                }
+        }
+    };
+    if (size > 0) {
+        graph.assertVertexInRange(source);
+        visitFrom(source);
+    }
+    for (VertexIndex i = 0; i < size; ++i)
+        if (!visited[i])
+            visitFrom(i);
+    return orderToNewIndices(order);
+}
+
+/**
+ * Orders the vertices with the reverse Cuthill-McKee algorithm, which
+ * reduces the bandwidth of the adjacency matrix. Each component is traversed
+ * breadth-first from its vertex of smallest degree, visiting the neighbours
+ * of each vertex by increasing degree, and the resulting order is reversed.
+ * The complexity is \f$O(V+E\log d_{\max})\f$.
+ *
+ * @return New index of each vertex.
+ */
+template <typename Graph>
+std::vector<VertexIndex> getReverseCuthillMcKeeOrdering(const Graph &graph) {
+    const size_t size = graph.getSize();
+    std::vector<size_t> degrees = countOutNeighbours(graph);
+    std::vector<VertexIndex> roots = sortVerticesByDegree(degrees, false);
+
+    std::vector<VertexIndex> order;
+    order.reserve(size);
+    std::vector<bool> visited(size, false);
+    std::vector<VertexIndex> unvisitedNeighbours;
+    auto byDegree = [&](VertexIndex vertex1, VertexIndex vertex2) {
+        return degrees[vertex1] < degrees[vertex2] ||
+               (degrees[vertex1] == degrees[vertex2] && vertex1 < vertex2);
+    };
+
+    for (VertexIndex root : roots) {
+        if (visited[root])
+            continue;
+        size_t next = order.size();
+        visited[root] = true;
+        order.push_back(root);
+        while (next < order.size()) {
+            VertexIndex vertex = order[next++];
+            unvisitedNeighbours.clear();
+            for (VertexIndex neighbour : graph.getOutNeighbours(vertex))
+                if (!visited[neighbour]) {
+                    visited[neighbour] = true;
+                    unvisitedNeighbours.push_back(neighbour);
+                }
+            std::sort(
+                unvisitedNeighbours.begin(), unvisitedNeighbours.end(),
+                byDegree
+            );
+            order.insert(
+                order.end(), unvisitedNeighbours.begin(),
+                unvisitedNeighbours.end()
+            );
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return orderToNewIndices(order);
+}
+
+/**
+ * Orders the vertices with a greedy heuristic in the spirit of Gorder (Wei et
+ * al., 2016). Vertices are placed one at a time: the next vertex is the one
+ * that has the most edges to, and shares the most in neighbours with, the
+ * last \p windowSize placed vertices. Vertices that are accessed together by
+ * traversals thus end up in the same cache lines.
+ *
+ * The scores are updated incrementally when a vertex enters or leaves the
+ * window. In neighbours of degree larger than \f$\sqrt{V}\f$ aren't used for
+ * the shared neighbour scores, which bounds the cost of the hubs. The
+ * complexity is \f$O(w \sum_v d_v^2 \log V)\f$ in the worst case, where \f$w\f$
+ * is \p windowSize, and close to \f$O(wE\log V)\f$ for sparse graphs.
+ *
+ * @return New index of each vertex.
+ */
+template <typename Graph>
+std::vector<VertexIndex>
+getGorderOrdering(const Graph &graph, size_t windowSize = 5) {
+    const size_t size = graph.getSize();
+    std::vector<VertexIndex> order;
+    if (size == 0)
+        return order;
+    order.reserve(size);
+
+    // In neighbours, bucketed by destination.
+    std::vector<size_t> inOffsets(size + 1, 0);
+    for (VertexIndex i = 0; i < size; ++i)
+        for (VertexIndex j : graph.getOutNeighbours(i))
+            ++inOffsets[j + 1];
+    for (VertexIndex i = 0; i < size; ++i)
+        inOffsets[i + 1] += inOffsets[i];
+    std::vector<VertexIndex> inNeighbours(inOffsets[size]);
+    std::vector<size_t> nextPosition(inOffsets.begin(), inOffsets.end() - 1);
+    for (VertexIndex i = 0; i < size; ++i)
+        for (VertexIndex j : graph.getOutNeighbours(i))
+            inNeighbours[nextPosition[j]++] = i;
+
+    std::vector<size_t> outDegrees = countOutNeighbours(graph);
+    size_t hubDegree = 1;
+    while (hubDegree * hubDegree < size)
+        ++hubDegree;
+
+    std::vector<long long> scores(size, 0);
+    std::vector<bool> placed(size, false);
+    typedef std::pair<long long, VertexIndex> ScoredVertex;
+    // Larger scores first, then smaller indices.
+    auto lowerPriority = [](const ScoredVertex &a, const ScoredVertex &b) {
+        return a.first < b.first || (a.first == b.first && a.second > b.second);
+    };
+    std::priority_queue<
+        ScoredVertex, std::vector<ScoredVertex>, decltype(lowerPriority)>
+        candidates(lowerPriority);
+
+    auto addToScore = [&](VertexIndex vertex, long long difference) {
+        if (placed[vertex])
+            return;
+        scores[vertex] += difference;
+        if (scores[vertex] > 0)
+            candidates.push({scores[vertex], vertex});
+    };
+    auto updateScores = [&](VertexIndex vertex, long long difference) {
+        for (VertexIndex neighbour : graph.getOutNeighbours(vertex))
+            addToScore(neighbour, difference);
+        for (size_t p = inOffsets[vertex]; p < inOffsets[vertex + 1]; ++p) {
+            VertexIndex inNeighbour = inNeighbours[p];
+            addToScore(inNeighbour, difference);
+            if (outDegrees[inNeighbour] <= hubDegree)
+                for (VertexIndex sibling : graph.getOutNeighbours(inNeighbour))
+                    if (sibling != vertex)
+                        addToScore(sibling, difference);
+        }
+    };
+
+    // Starts with the vertex of largest in degree.
+    VertexIndex next = 0;
+    for (VertexIndex i = 1; i < size; ++i)
+        if (inOffsets[i + 1] - inOffsets[i] >
+            inOffsets[next + 1] - inOffsets[next])
+            next = i;
+    VertexIndex firstUnplaced = 0;
+
+    while (true) {
+        placed[next] = true;
+        order.push_back(next);
+        if (order.size() == size)
+            break;
+        updateScores(next, 1);
+        if (order.size() > windowSize)
+            updateScores(order[order.size() - windowSize - 1], -1);
+
+        // Entries whose score changed since they were pushed are skipped.
+        while (!candidates.empty() &&
+               (placed[candidates.top().second] ||
+                scores[candidates.top().second] != candidates.top().first))
+            candidates.pop();
+        if (!candidates.empty())
+            next = candidates.top().second;
+        else {
+            while (placed[firstUnplaced])
+                ++firstUnplaced;
+            next = firstUnplaced;
+        }
+    }
+    return orderToNewIndices(order);
+}
+
+} // namespace algorithms
+} // namespace BaseGraph
+
+#endif
@@ -1,6 +1,9 @@
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include "BaseGraph/compact_directed_graph.hpp"
+#include "BaseGraph/compact_undirected_graph.hpp"
 #include "BaseGraph/directed_graph.hpp"
 #include "BaseGraph/types.h"
 #include "BaseGraph/undirected_graph.hpp"
@@ -8,17 +11,43 @@
 namespace BaseGraph {
 namespace algorithms {
 
+/// Gives \p subgraph the vertex properties of \p graph, whose vertex
+/// `vertices[i]` is the vertex \c i of \p subgraph. Does nothing for graphs
+/// without vertex properties.
+template <typename Graph>
+auto selectVertexProperties(
+    const Graph &graph, Graph &subgraph,
+    const std::vector<VertexIndex> &vertices, int
+) -> decltype(subgraph.getVertexProperties(), void()) {
+    subgraph.getVertexProperties() =
+        graph.getVertexProperties().getSelected(vertices);
+}
+template <typename Graph>
+void selectVertexProperties(
+    const Graph &, Graph &, const std::vector<VertexIndex> &, long
+) {}
+
+/// Gives \p subgraph, of the same size as \p graph, the vertex properties
+/// of \p graph. Does nothing for graphs without vertex properties.
+template <typename Graph>
+auto copyVertexProperties(const Graph &graph, Graph &subgraph, int)
+    -> decltype(subgraph.getVertexProperties(), void()) {
+    subgraph.getVertexProperties() = graph.getVertexProperties();
+}
+template <typename Graph>
+void copyVertexProperties(const Graph &, Graph &, long) {}
+
 /**
  * Construct a Graph that only contains the edges in \p vertices.
  * @param vertices Vertices to include in the subgraph.
  * @return Subgraph without vertex remapping. The subgraph has
  *         the same number of vertices than the original graph.
  */
-template <template <class...> class Graph, typename EdgeLabel>
-Graph<EdgeLabel>
-getSubgraph(const Graph<EdgeLabel> &graph,
-              const std::unordered_set<VertexIndex> &vertices) {
-    Graph<EdgeLabel> subgraph(graph.getSize());
+template <typename Graph>
+Graph getSubgraph(
+    const Graph &graph, const std::unordered_set<VertexIndex> &vertices
+) {
+    Graph subgraph(graph.getSize());
 
     for (VertexIndex i : vertices) {
         graph.assertVertexInRange(i);
@@ -26,6 +55,7 @@ getSubgraph(const Graph<EdgeLabel> &graph,
             if (vertices.find(j) != vertices.end())
                 subgraph.addEdge(i, j, graph.getEdgeLabel(i, j));
     }
+    copyVertexProperties(graph, subgraph, 0);
     return subgraph;
 }
 
@@ -35,17 +65,20 @@ getSubgraph(const Graph<EdgeLabel> &graph,
  * @return Directed subgraph and mapping of the original vertex indices
  *         to the subgraph vertex indices.
  */
-template <template <class...> class Graph, typename EdgeLabel>
-std::pair<Graph<EdgeLabel>, std::unordered_map<VertexIndex, VertexIndex>>
-getSubgraphWithRemap(const Graph<EdgeLabel> &graph,
-                       const std::unordered_set<VertexIndex> &vertices) {
+template <typename Graph>
+std::pair<Graph, std::unordered_map<VertexIndex, VertexIndex>>
+getSubgraphWithRemap(
+    const Graph &graph, const std::unordered_set<VertexIndex> &vertices
+) {
 
-    Graph<EdgeLabel> subgraph(vertices.size());
+    Graph subgraph(vertices.size());
     std::unordered_map<VertexIndex, VertexIndex> newMapping;
+    std::vector<VertexIndex> oldIndices;
 
     VertexIndex position = 0;
     for (VertexIndex vertex : vertices) {
         newMapping[vertex] = position;
+        oldIndices.push_back(vertex);
         ++position;
     }
 
@@ -56,8 +89,118 @@ getSubgraphWithRemap(const Graph<EdgeLabel> &graph,
                 subgraph.addEdge(newMapping[i], newMapping[j],
                                  graph.getEdgeLabel(i, j));
     }
+    selectVertexProperties(graph, subgraph, oldIndices, 0);
     return {std::move(subgraph), std::move(newMapping)};
 }
 
+/**
+ * Construct a compact graph that only contains the edges in \p vertices. The
+ * subgraph is assembled in a mutable graph and then frozen.
+ * @param vertices Vertices to include in the subgraph.
+ * @return Subgraph without vertex remapping. The subgraph has
+ *         the same number of vertices than the original graph.
+ */
+template <typename EdgeLabel>
+LabeledCompactDirectedGraph<EdgeLabel> getSubgraph(
+    const LabeledCompactDirectedGraph<EdgeLabel> &graph,
+    const std::unordered_set<VertexIndex> &vertices
+) {
+    LabeledDirectedGraph<EdgeLabel, VectorStorage> subgraph(graph.getSize());
+
+    for (VertexIndex i : vertices) {
+        graph.assertVertexInRange(i);
+        for (VertexIndex j : graph.getOutNeighbours(i))
+            if (vertices.find(j) != vertices.end())
+                subgraph.addEdge(i, j, graph.getEdgeLabel(i, j), true);
+    }
+    return freeze(subgraph);
+}
+
+/**
+ * Construct a compact graph that only contains the edges in \p vertices.
+ * @param vertices Vertices to include in the subgraph.
+ * @return Subgraph without vertex remapping. The subgraph has
+ *         the same number of vertices than the original graph.
+ */
+template <typename EdgeLabel>
+LabeledCompactUndirectedGraph<EdgeLabel> getSubgraph(
+    const LabeledCompactUndirectedGraph<EdgeLabel> &graph,
+    const std::unordered_set<VertexIndex> &vertices
+) {
+    LabeledUndirectedGraph<EdgeLabel, VectorStorage> subgraph(graph.getSize());
+
+    for (VertexIndex i : vertices) {
+        graph.assertVertexInRange(i);
+        for (VertexIndex j : graph.getOutNeighbours(i))
+            if (i <= j && vertices.find(j) != vertices.end())
+                subgraph.addEdge(i, j, graph.getEdgeLabel(i, j), true);
+    }
+    return freeze(subgraph);
+}
+
+/**
+ * Construct a compact graph that only contains the edges in \p vertices.
+ * @param vertices Vertices to include in the subgraph.
+ * @return Subgraph and mapping of the original vertex indices to the subgraph
+ *         vertex indices.
+ */
+template <typename EdgeLabel>
+std::pair<
+    LabeledCompactDirectedGraph<EdgeLabel>,
+    std::unordered_map<VertexIndex, VertexIndex>>
+getSubgraphWithRemap(
+    const LabeledCompactDirectedGraph<EdgeLabel> &graph,
+    const std::unordered_set<VertexIndex> &vertices
+) {
+    LabeledDirectedGraph<EdgeLabel, VectorStorage> subgraph(vertices.size());
+    std::unordered_map<VertexIndex, VertexIndex> newMapping;
+
+    VertexIndex position = 0;
+    for (VertexIndex vertex : vertices)
+        newMapping[vertex] = position++;
+
+    for (VertexIndex i : vertices) {
+        graph.assertVertexInRange(i);
+        for (VertexIndex j : graph.getOutNeighbours(i))
+            if (vertices.find(j) != vertices.end())
+                subgraph.addEdge(
+                    newMapping[i], newMapping[j], graph.getEdgeLabel(i, j), true
+                );
+    }
+    return {freeze(subgraph), std::move(newMapping)};
+}
+
+/**
+ * Construct a compact graph that only contains the edges in \p vertices.
+ * @param vertices Vertices to include in the subgraph.
+ * @return Subgraph and mapping of the original vertex indices to the subgraph
+ *         vertex indices.
+ */
+template <typename EdgeLabel>
+std::pair<
+    LabeledCompactUndirectedGraph<EdgeLabel>,
+    std::unordered_map<VertexIndex, VertexIndex>>
+getSubgraphWithRemap(
+    const LabeledCompactUndirectedGraph<EdgeLabel> &graph,
+    const std::unordered_set<VertexIndex> &vertices
+) {
+    LabeledUndirectedGraph<EdgeLabel, VectorStorage> subgraph(vertices.size());
+    std::unordered_map<VertexIndex, VertexIndex> newMapping;
+
+    VertexIndex position = 0;
+    for (VertexIndex vertex : vertices)
+        newMapping[vertex] = position++;
+
+    for (VertexIndex i : vertices) {
+        graph.assertVertexInRange(i);
+        for (VertexIndex j : graph.getOutNeighbours(i))
+            if (i <= j && vertices.find(j) != vertices.end())
+                subgraph.addEdge(
+                    newMapping[i], newMapping[j], graph.getEdgeLabel(i, j), true
+                );
+    }
+    return {freeze(subgraph), std::move(newMapping)};
+}
+
 } // namespace algorithms
 } // namespace BaseGraph
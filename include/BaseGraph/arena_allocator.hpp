@@ -0,0 +1,203 @@
+#ifndef BASE_GRAPH_ARENA_ALLOCATOR_HPP
+#define BASE_GRAPH_ARENA_ALLOCATOR_HPP
+
+#include "BaseGraph/types.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define BASEGRAPH_HAS_MEMORY_RESOURCE
+#endif
+#endif
+
+namespace BaseGraph {
+
+/**
+ * Memory pool that hands out memory by moving a pointer forward in large
+ * blocks. Deallocations do nothing: the memory is only given back when the
+ * whole arena is released, in one call per block.
+ *
+ * This suits graphs that are built, analysed and destroyed in batch jobs,
+ * where freeing each edge separately dominates the running time. Every
+ * container that allocated from the arena must be destroyed before the arena
+ * is released.
+ */
+class MonotonicArena {
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t blockSize;
+    char *current = nullptr;
+    size_t remaining = 0;
+    size_t usedBytes = 0;
+
+  public:
+    /// Constructs an empty arena that reserves memory by blocks of at least
+    /// \p blockSize bytes.
+    explicit MonotonicArena(size_t blockSize = 1 << 16)
+        : blockSize(std::max<size_t>(blockSize, 1)) {}
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+    /// Returns \p bytes bytes aligned on \p alignment, which must be a power
+    /// of two.
+    void *allocate(size_t bytes, size_t alignment) {
+        size_t padding = paddingOf(current, alignment);
+        if (padding + bytes > remaining) {
+            addBlock(bytes + alignment);
+            padding = paddingOf(current, alignment);
+        }
+        char *allocated = current + padding;
+        current += padding + bytes;
+        remaining -= padding + bytes;
+        usedBytes += bytes;
+        return allocated;
+    }
+
+    /// Frees every block. The memory handed out by the arena must not be used
+    /// afterwards.
+    void release() {
+        blocks.clear();
+        current = nullptr;
+        remaining = 0;
+        usedBytes = 0;
+    }
+
+    /// Returns the number of bytes handed out since the last release.
+    size_t getUsedBytes() const { return usedBytes; }
+    /// Returns the number of bytes reserved from the global heap.
+    size_t getReservedBytes() const {
+        size_t reservedBytes = 0;
+        for (const auto &block : blocks)
+            reservedBytes += block.size;
+        return reservedBytes;
+    }
+
+  private:
+    static size_t paddingOf(const char *pointer, size_t alignment) {
+        return (alignment - reinterpret_cast<uintptr_t>(pointer) % alignment) %
+               alignment;
+    }
+
+    void addBlock(size_t minimumSize) {
+        size_t size = std::max(blockSize, minimumSize);
+        blocks.push_back({std::unique_ptr<char[]>(new char[size]), size});
+        current = blocks.back().data.get();
+        remaining = size;
+    }
+};
+
+/**
+ * Makes \p arena the arena of the @ref ArenaAllocator objects default
+ * constructed by the current thread, until the scope is destroyed. Scopes can
+ * be nested.
+ *
+ * For example:
+ * \code{.cpp}
+ * using namespace BaseGraph;
+ * MonotonicArena arena;
+ * {
+ *     ArenaScope scope(arena);
+ *     LabeledDirectedGraph<NoLabel, ArenaStorage> graph(5);
+ *     graph.addEdge(0, 1); // Allocated in arena
+ * }
+ * arena.release();
+ * \endcode
+ */
+class ArenaScope {
+    MonotonicArena *previousArena;
+
+  public:
+    explicit ArenaScope(MonotonicArena &arena)
+        : previousArena(getCurrentArena()) {
+        currentArena() = &arena;
+    }
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+    ~ArenaScope() { currentArena() = previousArena; }
+
+    /// Returns the arena of the innermost scope of the current thread, or
+    /// `nullptr` outside of any scope.
+    static MonotonicArena *getCurrentArena() { return currentArena(); }
+
+  private:
+    static MonotonicArena *&currentArena() {
+        static thread_local MonotonicArena *arena = nullptr;
+        return arena;
+    }
+};
+
+/**
+ * Allocator that draws memory from a @ref MonotonicArena. A default
+ * constructed allocator uses the arena of the current @ref ArenaScope and
+ * falls back on the global heap outside of any scope. The arena follows the
+ * containers when they are copied, moved or swapped.
+ *
+ * @tparam T Type of the allocated elements.
+ */
+template <typename T>
+class ArenaAllocator {
+    MonotonicArena *arena;
+
+  public:
+    typedef T value_type;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    ArenaAllocator() : arena(ArenaScope::getCurrentArena()) {}
+    /// Constructs an allocator that uses \p arena, or the global heap when \p
+    /// arena is `nullptr`.
+    explicit ArenaAllocator(MonotonicArena *arena) : arena(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other)
+        : arena(other.getArena()) {}
+
+    T *allocate(size_t n) {
+        if (arena == nullptr)
+            return std::allocator<T>().allocate(n);
+        return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T *pointer, size_t n) {
+        if (arena == nullptr)
+            std::allocator<T>().deallocate(pointer, n);
+    }
+
+    /// Returns the arena of the allocator, or `nullptr` if it uses the global
+    /// heap.
+    MonotonicArena *getArena() const { return arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const {
+        return arena == other.getArena();
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const {
+        return arena != other.getArena();
+    }
+};
+
+/// Storage policy that keeps the neighbours of each vertex in a `std::list`
+/// whose nodes are allocated by @ref ArenaAllocator.
+using ArenaStorage = AllocatorStorage<ArenaAllocator, ListStorage>;
+
+#ifdef BASEGRAPH_HAS_MEMORY_RESOURCE
+/// Storage policy that keeps the neighbours of each vertex in a
+/// `std::pmr::list`. Available in C++17.
+using PmrStorage =
+    AllocatorStorage<std::pmr::polymorphic_allocator, ListStorage>;
+#endif
+
+} // namespace BaseGraph
+
+#endif
@@ -27,6 +27,7 @@ DEALINGS IN THE SOFTWARE.
 #ifndef BASE_GRAPH_BOOST_HASH_HPP
 #define BASE_GRAPH_BOOST_HASH_HPP
 
+#include "BaseGraph/flat_edge_map.hpp"
 #include "BaseGraph/types.h"
 
 #include <cstddef>
@@ -48,8 +49,9 @@ size_t hashPair(std::pair<A, B> const &v) {
     return seed;
 }
 
+/// Hashes an edge packed in a 64-bit integer. See @ref hashEdgeKey.
 struct hashEdge {
-    size_t operator()(Edge const &v) const { return hashPair(v); }
+    size_t operator()(Edge const &v) const { return hashEdgeKey(v); }
 };
 
 } // namespace BaseGraph
@@ -0,0 +1,699 @@
+#ifndef BASE_GRAPH_COMPACT_DIRECTED_GRAPH_HPP
+#define BASE_GRAPH_COMPACT_DIRECTED_GRAPH_HPP
+
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/edge_property.hpp"
+#include "BaseGraph/types.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace BaseGraph {
+
+template <typename EdgeLabel>
+class LabeledDeltaDirectedGraph;
+
+/**
+ * Immutable directed graph stored in compressed sparse row (CSR) form.
+ *
+ * The out neighbours of every vertex are stored contiguously in a single
+ * array, sorted in increasing order, and the edge labels are stored in a
+ * parallel array. A compact graph is built in \f$O(V+E)\f$ from a mutable graph
+ * (see @ref freeze) and cannot be modified afterwards. It is meant for
+ * read-only workloads: it uses a fraction of the memory of @ref
+ * LabeledDirectedGraph, @ref hasEdge and @ref getEdgeLabel are binary searches
+ * and traversals are cache friendly.
+ *
+ * @tparam EdgeLabel Container of edge information. Requires a default
+ * constructor.
+ */
+template <typename EdgeLabel>
+class LabeledCompactDirectedGraph {
+  public:
+    /// Contains the out neighbours of a vertex, sorted in increasing order.
+    typedef ArrayView<VertexIndex> Successors;
+
+  protected:
+    size_t size = 0;
+    size_t edgeNumber = 0;
+
+    /// The out neighbours of vertex \c i are in
+    /// `neighbours[offsets[i]:offsets[i+1]]`.
+    std::vector<size_t> offsets;
+    std::vector<VertexIndex> neighbours;
+    /// Label of each edge in \c neighbours. Empty for unlabeled graphs.
+    std::vector<EdgeLabel> labels;
+
+    // Reads the rows of its base and fills the arrays of the merged base.
+    friend class LabeledDeltaDirectedGraph<EdgeLabel>;
+
+  public:
+    /// Constructs a graph of \p size vertices without edges.
+    explicit LabeledCompactDirectedGraph(size_t size = 0)
+        : size(size), offsets(size + 1, 0) {}
+
+    /// Constructs a compact copy of \p graph. Duplicate edges are kept.
+    template <typename Storage>
+    explicit LabeledCompactDirectedGraph(
+        const LabeledDirectedGraph<EdgeLabel, Storage> &graph
+    ) {
+        buildFrom(graph);
+    }
+
+    /// Returns the number of vertices.
+    size_t getSize() const { return size; }
+    /// Returns the number of edges.
+    size_t getEdgeNumber() const { return edgeNumber; }
+
+    /// Returns if graph instance and \p other have the same size, edges and
+    /// edge labels.
+    bool operator==(const LabeledCompactDirectedGraph &other) const {
+        return size == other.size && edgeNumber == other.edgeNumber &&
+               offsets == other.offsets && neighbours == other.neighbours &&
+               labels == other.labels;
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const LabeledCompactDirectedGraph &other) const {
+        return !(this->operator==(other));
+    }
+
+    /// Returns if a directed edge of any label connects \p source to \p
+    /// destination.
+    bool hasEdge(VertexIndex source, VertexIndex destination) const {
+        size_t position;
+        return findEdge(source, destination, position);
+    }
+    /// Returns if a directed edge of label \p label connects \p source to \p
+    /// destination.
+    bool hasEdge(
+        VertexIndex source, VertexIndex destination, const EdgeLabel &label
+    ) const {
+        return hasEdge(source, destination) &&
+               (getEdgeLabel(source, destination, false) == label);
+    }
+
+    /// Returns vertices to which \p vertex is connected.
+    Successors getOutNeighbours(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return Successors(
+            neighbours.data() + offsets[vertex],
+            neighbours.data() + offsets[vertex + 1]
+        );
+    }
+
+    /// Returns the out edges of \p vertex with their @ref EdgeId, in the order
+    /// of @ref getOutNeighbours. The identifier of an edge is its position in
+    /// the edges sorted by source, then by destination.
+    OutEdges getOutEdges(VertexIndex vertex) const {
+        return OutEdges(getOutNeighbours(vertex), offsets[vertex]);
+    }
+    /// Returns the @ref EdgeId of the edge from \p source to \p destination
+    /// (of the first one when it is duplicated), in \f$O(\log d)\f$. Throws
+    /// `std::invalid_argument` if the edge doesn't exist.
+    EdgeId getEdgeId(VertexIndex source, VertexIndex destination) const {
+        size_t position;
+        if (!findEdge(source, destination, position))
+            throw std::invalid_argument("Edge does not exist.");
+        return position;
+    }
+
+    /// Returns the labels of the out edges of \p vertex, in the same order as
+    /// @ref getOutNeighbours. Unavailable for unlabeled graphs.
+    template <typename... Dummy, typename U = EdgeLabel>
+    typename std::enable_if<
+        !std::is_same<U, NoLabel>::value, ArrayView<EdgeLabel>>::type
+    getOutEdgeLabels(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return ArrayView<EdgeLabel>(
+            labels.data() + offsets[vertex], labels.data() + offsets[vertex + 1]
+        );
+    }
+
+    /// @copydoc LabeledDirectedGraph::getEdgeLabel
+    EdgeLabel getEdgeLabel(
+        VertexIndex source, VertexIndex destination,
+        bool throwIfInexistent = true
+    ) const {
+        return _getLabel(source, destination, throwIfInexistent);
+    }
+
+    /// Counts the number of in edges of \p vertex. @ref getInDegrees is more
+    /// efficient when more than one in degree is needed.
+    size_t getInDegree(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return std::count(neighbours.begin(), neighbours.end(), vertex);
+    }
+    /// Counts the number of in edges of each vertex.
+    std::vector<size_t> getInDegrees() const {
+        std::vector<size_t> inDegrees(size, 0);
+        for (VertexIndex neighbour : neighbours)
+            ++inDegrees[neighbour];
+        return inDegrees;
+    }
+    /// Counts the number of edges coming from \p vertex.
+    size_t getOutDegree(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return offsets[vertex + 1] - offsets[vertex];
+    }
+    /// Counts the number of out edges of each vertex.
+    std::vector<size_t> getOutDegrees() const {
+        std::vector<size_t> outDegrees(size, 0);
+        for (VertexIndex i : *this)
+            outDegrees[i] = offsets[i + 1] - offsets[i];
+        return outDegrees;
+    }
+
+    /// Constructs the adjacency matrix.
+    AdjacencyMatrix getAdjacencyMatrix() const {
+        AdjacencyMatrix adjacencyMatrix(size, std::vector<size_t>(size, 0));
+        for (auto edge : edges())
+            ++adjacencyMatrix[edge.first][edge.second];
+        return adjacencyMatrix;
+    }
+
+    /// @copydoc LabeledDirectedGraph::getSparseAdjacency
+    SparseMatrix<size_t> getSparseAdjacency(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        triplets.reserve(neighbours.size());
+        for (VertexIndex i : *this)
+            for (size_t p = offsets[i]; p < offsets[i + 1]; ++p)
+                triplets.addEntry(i, neighbours[p], 1);
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    LabeledCompactDirectedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        LabeledCompactDirectedGraph permutedGraph;
+        permutedGraph.buildFrom(
+            PermutedGraphView<LabeledCompactDirectedGraph>(*this, newIndices)
+        );
+        return permutedGraph;
+    }
+
+    /// Outputs graph's size and edges in text to a given `std::stream` object.
+    friend std::ostream &operator<<(
+        std::ostream &stream, const LabeledCompactDirectedGraph &graph
+    ) {
+        stream << "Compact directed graph of size: " << graph.getSize() << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            for (auto &neighbour : graph.getOutNeighbours(i))
+                stream << neighbour << ", ";
+            stream << "\n";
+        }
+        return stream;
+    }
+
+    /// Returns VertexIterator of first vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator begin() const { return VertexIterator(0); }
+    /// Returns VertexIterator of last vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator end() const { return VertexIterator(size); }
+
+    /// Structure that iterates on the graph's edges.
+    struct Edges {
+        struct constEdgeIterator {
+            const LabeledCompactDirectedGraph &graph;
+            VertexIndex vertex;
+            size_t position;
+
+            constEdgeIterator(
+                const LabeledCompactDirectedGraph &graph, VertexIndex vertex,
+                size_t position
+            )
+                : graph(graph), vertex(vertex), position(position) {
+                skipEmptyVertices();
+            }
+
+            bool operator==(constEdgeIterator rhs) const {
+                return vertex == rhs.vertex && position == rhs.position;
+            }
+            bool operator!=(constEdgeIterator rhs) const {
+                return !(*this == rhs);
+            }
+            Edge operator*() { return {vertex, graph.neighbours[position]}; }
+            constEdgeIterator operator++() {
+                ++position;
+                skipEmptyVertices();
+                return *this;
+            }
+            constEdgeIterator operator++(int) {
+                constEdgeIterator tmp = *this;
+                operator++();
+                return tmp;
+            }
+            void skipEmptyVertices() {
+                while (vertex < graph.size &&
+                       position == graph.offsets[vertex + 1])
+                    ++vertex;
+            }
+        };
+
+        const LabeledCompactDirectedGraph &graph;
+        Edges(const LabeledCompactDirectedGraph &graph) : graph(graph) {}
+
+        constEdgeIterator begin() const {
+            return constEdgeIterator(graph, 0, 0);
+        }
+        constEdgeIterator end() const {
+            return constEdgeIterator(
+                graph, graph.size, graph.neighbours.size()
+            );
+        }
+    };
+    /// Creates @ref LabeledCompactDirectedGraph::Edges object that supports
+    /// range-based for loop.
+    Edges edges() const { return Edges(*this); }
+
+    /// Throws `std::out_of_range` if \p vertex is not contained in the graph.
+    void assertVertexInRange(VertexIndex vertex) const {
+        if (vertex >= size)
+            throw std::out_of_range(
+                "Vertex index (" + std::to_string(vertex) +
+                ") greater than the graph's size(" + std::to_string(size) + ")."
+            );
+    }
+
+  protected:
+    /**
+     * Fills the arrays with the edges of \p graph in \f$O(V+E)\f$. The edges
+     * are bucketed twice with a counting sort (first by destination, then by
+     * source) so that the neighbours of each vertex end up sorted.
+     *
+     * @tparam Graph Any graph that provides \c getSize, \c getOutNeighbours
+     * and, when labeled, \c getOutEdgeLabels.
+     */
+    template <typename Graph>
+    void buildFrom(const Graph &graph);
+
+    /// Copies the edge labels of \p graph in \p inLabels, bucketed by
+    /// destination in the same order as the sources in @ref buildFrom.
+    template <typename Graph, typename U = EdgeLabel>
+    static typename std::enable_if<std::is_same<U, NoLabel>::value>::type
+    bucketLabels(
+        const Graph &, const std::vector<size_t> &, std::vector<EdgeLabel> &
+    ) {}
+    template <typename Graph, typename U = EdgeLabel>
+    static typename std::enable_if<!std::is_same<U, NoLabel>::value>::type
+    bucketLabels(
+        const Graph &graph, const std::vector<size_t> &inOffsets,
+        std::vector<EdgeLabel> &inLabels
+    ) {
+        std::vector<size_t> nextPosition(
+            inOffsets.begin(), inOffsets.end() - 1
+        );
+        for (VertexIndex i = 0; i < graph.getSize(); ++i) {
+            auto label = graph.getOutEdgeLabels(i).begin();
+            for (VertexIndex j : graph.getOutNeighbours(i))
+                inLabels[nextPosition[j]++] = *label++;
+        }
+    }
+
+    /// Returns if edge (\p source, \p destination) exists and sets \p position
+    /// to the index of its first occurrence in \c neighbours.
+    bool findEdge(
+        VertexIndex source, VertexIndex destination, size_t &position
+    ) const {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
+
+        auto rowEnd = neighbours.begin() + offsets[source + 1];
+        auto it = std::lower_bound(
+            neighbours.begin() + offsets[source], rowEnd, destination
+        );
+        position = it - neighbours.begin();
+        return it != rowEnd && *it == destination;
+    }
+
+    template <typename... Dummy, typename U = EdgeLabel>
+    typename std::enable_if<std::is_same<U, NoLabel>::value, EdgeLabel>::type
+    _getLabel(
+        VertexIndex source, VertexIndex destination, bool throwIfInexistent
+    ) const {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
+        return NoLabel();
+    }
+    template <typename... Dummy, typename U = EdgeLabel>
+    typename std::enable_if<!std::is_same<U, NoLabel>::value, EdgeLabel>::type
+    _getLabel(
+        VertexIndex source, VertexIndex destination, bool throwIfInexistent
+    ) const {
+        size_t position;
+        if (findEdge(source, destination, position))
+            return labels[position];
+        if (throwIfInexistent)
+            throw std::invalid_argument("Edge label does not exist.");
+        return EdgeLabel();
+    }
+};
+
+/// Unlabeled compact directed graph.
+using CompactDirectedGraph = LabeledCompactDirectedGraph<NoLabel>;
+
+template <typename EdgeLabel>
+template <typename Graph>
+void LabeledCompactDirectedGraph<EdgeLabel>::buildFrom(const Graph &graph) {
+    const bool isLabeled = !std::is_same<EdgeLabel, NoLabel>::value;
+    size = graph.getSize();
+
+    std::vector<size_t> inOffsets(size + 1, 0);
+    offsets.assign(size + 1, 0);
+    for (VertexIndex i = 0; i < size; ++i)
+        for (VertexIndex j : graph.getOutNeighbours(i)) {
+            ++inOffsets[j + 1];
+            ++offsets[i + 1];
+        }
+    for (VertexIndex i = 0; i < size; ++i) {
+        inOffsets[i + 1] += inOffsets[i];
+        offsets[i + 1] += offsets[i];
+    }
+    edgeNumber = offsets[size];
+
+    // Sources are visited in increasing order, so each in-bucket is sorted.
+    std::vector<VertexIndex> inSources(edgeNumber);
+    std::vector<EdgeLabel> inLabels(isLabeled ? edgeNumber : 0);
+    std::vector<size_t> nextPosition(inOffsets.begin(), inOffsets.end() - 1);
+    for (VertexIndex i = 0; i < size; ++i)
+        for (VertexIndex j : graph.getOutNeighbours(i))
+            inSources[nextPosition[j]++] = i;
+    bucketLabels(graph, inOffsets, inLabels);
+
+    // Destinations are visited in increasing order, so each row is sorted.
+    neighbours.resize(edgeNumber);
+    labels.resize(isLabeled ? edgeNumber : 0);
+    nextPosition.assign(offsets.begin(), offsets.end() - 1);
+    for (VertexIndex j = 0; j < size; ++j)
+        for (size_t p = inOffsets[j]; p < inOffsets[j + 1]; ++p) {
+            size_t position = nextPosition[inSources[p]]++;
+            neighbours[position] = j;
+            if (isLabeled)
+                labels[position] = std::move(inLabels[p]);
+        }
+}
+
+/**
+ * Immutable directed weighted graph stored in compressed sparse row form. See
+ * @ref LabeledCompactDirectedGraph.
+ */
+class CompactDirectedWeightedGraph
+    : private LabeledCompactDirectedGraph<EdgeWeight> {
+    using BaseClass = LabeledCompactDirectedGraph<EdgeWeight>;
+    long double totalWeight = 0;
+
+  public:
+    using BaseClass::Successors;
+
+    using BaseClass::assertVertexInRange;
+    using BaseClass::begin;
+    using BaseClass::edges;
+    using BaseClass::end;
+    using BaseClass::getAdjacencyMatrix;
+    using BaseClass::getEdgeId;
+    using BaseClass::getSparseAdjacency;
+    using BaseClass::getEdgeNumber;
+    using BaseClass::getInDegree;
+    using BaseClass::getInDegrees;
+    using BaseClass::getOutDegree;
+    using BaseClass::getOutDegrees;
+    using BaseClass::getOutEdges;
+    using BaseClass::getOutNeighbours;
+    using BaseClass::getSize;
+    using BaseClass::hasEdge;
+
+    /// Constructs a graph of \p size vertices without edges.
+    explicit CompactDirectedWeightedGraph(size_t size = 0) : BaseClass(size) {}
+
+    /// Constructs a compact copy of \p graph.
+    template <typename Storage>
+    explicit CompactDirectedWeightedGraph(
+        const BasicDirectedWeightedGraph<Storage> &graph
+    )
+        : BaseClass(graph.asLabeledGraph()),
+          totalWeight(graph.getTotalWeight()) {}
+
+    /// @copydoc BasicDirectedWeightedGraph::getTotalWeight
+    long double getTotalWeight() const { return totalWeight; }
+
+    /// Returns if graph instance and \p other have the same size, edges and
+    /// edge weights.
+    bool operator==(const CompactDirectedWeightedGraph &other) const {
+        return BaseClass::operator==(other);
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const CompactDirectedWeightedGraph &other) const {
+        return BaseClass::operator!=(other);
+    }
+
+    /// @copydoc BasicDirectedWeightedGraph::getEdgeWeight
+    EdgeWeight getEdgeWeight(
+        VertexIndex source, VertexIndex destination,
+        bool throwIfInexistent = true
+    ) const {
+        return getEdgeLabel(source, destination, throwIfInexistent);
+    }
+    /// Returns the weights of the out edges of \p vertex, in the same order as
+    /// @ref getOutNeighbours.
+    ArrayView<EdgeWeight> getOutEdgeWeights(VertexIndex vertex) const {
+        return getOutEdgeLabels(vertex);
+    }
+
+    /// @copydoc BasicDirectedWeightedGraph::asLabeledGraph
+    const BaseClass &asLabeledGraph() const {
+        return static_cast<const BaseClass &>(*this);
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    CompactDirectedWeightedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        CompactDirectedWeightedGraph permutedGraph;
+        static_cast<BaseClass &>(permutedGraph) =
+            BaseClass::getPermutedGraph(newIndices);
+        permutedGraph.totalWeight = totalWeight;
+        return permutedGraph;
+    }
+
+    /// @copydoc BasicDirectedWeightedGraph::getWeightMatrix
+    WeightMatrix getWeightMatrix() const {
+        WeightMatrix weightMatrix(size, std::vector<EdgeWeight>(size, 0));
+        for (auto edge : edges())
+            weightMatrix[edge.first][edge.second] =
+                getEdgeWeight(edge.first, edge.second);
+        return weightMatrix;
+    }
+
+    /// @copydoc BasicDirectedWeightedGraph::getSparseWeights
+    SparseMatrix<EdgeWeight> getSparseWeights(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<EdgeWeight> triplets;
+        triplets.reserve(neighbours.size());
+        for (VertexIndex i : *this)
+            for (size_t p = offsets[i]; p < offsets[i + 1]; ++p)
+                triplets.addEntry(i, neighbours[p], labels[p]);
+        return buildSparseMatrix(size, triplets, orientation, KeepLastEntry());
+    }
+
+    /// @copydoc LabeledCompactDirectedGraph::operator<<
+    friend std::ostream &operator<<(
+        std::ostream &stream, const CompactDirectedWeightedGraph &graph
+    ) {
+        stream << "CompactDirectedWeightedGraph of size: " << graph.getSize()
+               << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            auto weights = graph.getOutEdgeWeights(i);
+            auto neighbours = graph.getOutNeighbours(i);
+            for (size_t k = 0; k < neighbours.size(); ++k)
+                stream << neighbours[k] << "(" << weights[k] << "), ";
+            stream << "\n";
+        }
+        return stream;
+    }
+};
+
+/**
+ * Immutable directed multigraph stored in compressed sparse row form. The
+ * multiplicity of each edge is stored in a parallel array. See @ref
+ * LabeledCompactDirectedGraph.
+ */
+class CompactDirectedMultigraph
+    : private LabeledCompactDirectedGraph<EdgeMultiplicity> {
+    using BaseClass = LabeledCompactDirectedGraph<EdgeMultiplicity>;
+    size_t totalEdgeNumber = 0;
+
+  public:
+    using BaseClass::Successors;
+
+    using BaseClass::assertVertexInRange;
+    using BaseClass::begin;
+    using BaseClass::edges;
+    using BaseClass::end;
+    using BaseClass::getEdgeId;
+    using BaseClass::getOutEdges;
+    using BaseClass::getOutNeighbours;
+    using BaseClass::getSize;
+    using BaseClass::hasEdge;
+    /// @copydoc BasicDirectedMultigraph::getEdgeNumber
+    using BaseClass::getEdgeNumber;
+
+    /// Constructs a graph of \p size vertices without edges.
+    explicit CompactDirectedMultigraph(size_t size = 0) : BaseClass(size) {}
+
+    /// Constructs a compact copy of \p graph.
+    template <typename Storage>
+    explicit CompactDirectedMultigraph(
+        const BasicDirectedMultigraph<Storage> &graph
+    )
+        : BaseClass(graph.asLabeledGraph()),
+          totalEdgeNumber(graph.getTotalEdgeNumber()) {}
+
+    /// @copydoc BasicDirectedMultigraph::getTotalEdgeNumber
+    size_t getTotalEdgeNumber() const { return totalEdgeNumber; }
+
+    /// Returns if graph instance and \p other have the same size, edges and
+    /// edge multiplicities.
+    bool operator==(const CompactDirectedMultigraph &other) const {
+        return BaseClass::operator==(other);
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const CompactDirectedMultigraph &other) const {
+        return BaseClass::operator!=(other);
+    }
+
+    /// @copydoc BasicDirectedMultigraph::getEdgeMultiplicity
+    EdgeMultiplicity
+    getEdgeMultiplicity(VertexIndex source, VertexIndex destination) const {
+        return getEdgeLabel(source, destination, false);
+    }
+    /// Returns the multiplicities of the out edges of \p vertex, in the same
+    /// order as @ref getOutNeighbours.
+    ArrayView<EdgeMultiplicity> getOutEdgeMultiplicities(VertexIndex vertex
+    ) const {
+        return getOutEdgeLabels(vertex);
+    }
+
+    /// @copydoc BasicDirectedMultigraph::asLabeledGraph
+    const BaseClass &asLabeledGraph() const {
+        return static_cast<const BaseClass &>(*this);
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    CompactDirectedMultigraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        CompactDirectedMultigraph permutedGraph;
+        static_cast<BaseClass &>(permutedGraph) =
+            BaseClass::getPermutedGraph(newIndices);
+        permutedGraph.totalEdgeNumber = totalEdgeNumber;
+        return permutedGraph;
+    }
+
+    /// @copydoc BasicDirectedMultigraph::getAdjacencyMatrix
+    AdjacencyMatrix getAdjacencyMatrix() const {
+        AdjacencyMatrix adjacencyMatrix(size, std::vector<size_t>(size, 0));
+        for (VertexIndex i : *this)
+            for (size_t p = offsets[i]; p < offsets[i + 1]; ++p)
+                adjacencyMatrix[i][neighbours[p]] += labels[p];
+        return adjacencyMatrix;
+    }
+
+    /// @copydoc BasicDirectedMultigraph::getSparseAdjacency
+    SparseMatrix<size_t> getSparseAdjacency(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        triplets.reserve(neighbours.size());
+        for (VertexIndex i : *this)
+            for (size_t p = offsets[i]; p < offsets[i + 1]; ++p)
+                triplets.addEntry(i, neighbours[p], labels[p]);
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// @copydoc BasicDirectedMultigraph::getOutDegree
+    size_t getOutDegree(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        size_t degree = 0;
+        for (size_t p = offsets[vertex]; p < offsets[vertex + 1]; ++p)
+            degree += labels[p];
+        return degree;
+    }
+    /// @copydoc BasicDirectedMultigraph::getOutDegrees
+    std::vector<size_t> getOutDegrees() const {
+        std::vector<size_t> degrees(size, 0);
+        for (VertexIndex i : *this)
+            degrees[i] = getOutDegree(i);
+        return degrees;
+    }
+    /// @copydoc BasicDirectedMultigraph::getInDegree
+    size_t getInDegree(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        size_t degree = 0;
+        for (size_t p = 0; p < neighbours.size(); ++p)
+            if (neighbours[p] == vertex)
+                degree += labels[p];
+        return degree;
+    }
+    /// @copydoc BasicDirectedMultigraph::getInDegrees
+    std::vector<size_t> getInDegrees() const {
+        std::vector<size_t> inDegrees(size, 0);
+        for (size_t p = 0; p < neighbours.size(); ++p)
+            inDegrees[neighbours[p]] += labels[p];
+        return inDegrees;
+    }
+
+    /// @copydoc LabeledCompactDirectedGraph::operator<<
+    friend std::ostream &
+    operator<<(std::ostream &stream, const CompactDirectedMultigraph &graph) {
+        stream << "CompactDirectedMultigraph of size: " << graph.getSize()
+               << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            auto multiplicities = graph.getOutEdgeMultiplicities(i);
+            auto neighbours = graph.getOutNeighbours(i);
+            for (size_t k = 0; k < neighbours.size(); ++k)
+                stream << neighbours[k] << "(" << multiplicities[k] << "), ";
+            stream << "\n";
+        }
+        return stream;
+    }
+};
+
+/// Constructs the compact (read-only) version of \p graph.
+template <typename EdgeLabel, typename Storage>
+LabeledCompactDirectedGraph<EdgeLabel>
+freeze(const LabeledDirectedGraph<EdgeLabel, Storage> &graph) {
+    return LabeledCompactDirectedGraph<EdgeLabel>(graph);
+}
+
+/// Constructs the compact (read-only) version of \p graph.
+template <typename Storage>
+CompactDirectedWeightedGraph
+freeze(const BasicDirectedWeightedGraph<Storage> &graph) {
+    return CompactDirectedWeightedGraph(graph);
+}
+
+/// Constructs the compact (read-only) version of \p graph.
+template <typename Storage>
+CompactDirectedMultigraph freeze(const BasicDirectedMultigraph<Storage> &graph
+) {
+    return CompactDirectedMultigraph(graph);
+}
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,570 @@
+#ifndef BASE_GRAPH_COMPACT_UNDIRECTED_GRAPH_HPP
+#define BASE_GRAPH_COMPACT_UNDIRECTED_GRAPH_HPP
+
+#include "BaseGraph/compact_directed_graph.hpp"
+#include "BaseGraph/types.h"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_multigraph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace BaseGraph {
+
+/**
+ * Immutable undirected graph stored in compressed sparse row (CSR) form.
+ *
+ * Each edge is stored in the neighbours of both of its endpoints (self-loops
+ * are stored once), like in @ref LabeledUndirectedGraph. See @ref
+ * LabeledCompactDirectedGraph for the memory layout.
+ *
+ * @tparam EdgeLabel Container of edge information. Requires a default
+ * constructor.
+ */
+template <typename EdgeLabel>
+class LabeledCompactUndirectedGraph
+    : protected LabeledCompactDirectedGraph<EdgeLabel> {
+    using Directed = LabeledCompactDirectedGraph<EdgeLabel>;
+    using Directed::edgeNumber;
+    using Directed::neighbours;
+    using Directed::offsets;
+    using Directed::size;
+
+    /// @ref EdgeId of each entry of \c neighbours. Both endpoints of an edge
+    /// share its identifier.
+    std::vector<EdgeId> edgeIds;
+
+  public:
+    using typename Directed::Successors;
+
+    /// Constructs a graph of \p size vertices without edges.
+    explicit LabeledCompactUndirectedGraph(size_t size = 0) : Directed(size) {}
+
+    /// Constructs a compact copy of \p graph. Duplicate edges are kept.
+    template <typename Storage>
+    explicit LabeledCompactUndirectedGraph(
+        const LabeledUndirectedGraph<EdgeLabel, Storage> &graph
+    ) {
+        Directed::buildFrom(graph);
+        edgeNumber = graph.getEdgeNumber();
+        buildEdgeIds();
+    }
+
+    using Directed::assertVertexInRange;
+    using Directed::begin;
+    using Directed::end;
+    using Directed::getEdgeLabel;
+    using Directed::getEdgeNumber;
+    using Directed::getOutEdgeLabels;
+    using Directed::getOutNeighbours;
+    using Directed::getSize;
+    using Directed::hasEdge;
+
+    /// Returns if graph instance and \p other have the same size, edges and
+    /// edge labels.
+    bool operator==(const LabeledCompactUndirectedGraph &other) const {
+        return Directed::operator==(other);
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const LabeledCompactUndirectedGraph &other) const {
+        return Directed::operator!=(other);
+    }
+
+    /// Returns vertices to which \p vertex is connected, sorted in increasing
+    /// order.
+    Successors getNeighbours(VertexIndex vertex) const {
+        return getOutNeighbours(vertex);
+    }
+
+    /// Returns the edges of \p vertex with their @ref EdgeId, in the order of
+    /// @ref getNeighbours. The identifiers are numbered by smallest endpoint,
+    /// then by largest endpoint.
+    OutEdges getOutEdges(VertexIndex vertex) const {
+        return OutEdges(
+            getOutNeighbours(vertex), edgeIds.data() + offsets[vertex]
+        );
+    }
+    /// Returns the @ref EdgeId of the edge connecting \p vertex1 and \p
+    /// vertex2 (of the first one when it is duplicated), in \f$O(\log d)\f$.
+    /// Throws `std::invalid_argument` if the edge doesn't exist.
+    EdgeId getEdgeId(VertexIndex vertex1, VertexIndex vertex2) const {
+        size_t position;
+        if (!Directed::findEdge(vertex1, vertex2, position))
+            throw std::invalid_argument("Edge does not exist.");
+        return edgeIds[position];
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getDegree
+    size_t
+    getDegree(VertexIndex vertex, bool countSelfLoopsTwice = true) const {
+        assertVertexInRange(vertex);
+        size_t degree = offsets[vertex + 1] - offsets[vertex];
+        if (countSelfLoopsTwice) {
+            auto rowBegin = neighbours.begin() + offsets[vertex];
+            auto rowEnd = neighbours.begin() + offsets[vertex + 1];
+            auto selfLoops = std::equal_range(rowBegin, rowEnd, vertex);
+            degree += selfLoops.second - selfLoops.first;
+        }
+        return degree;
+    }
+    /// @copydoc LabeledUndirectedGraph::getDegrees
+    std::vector<size_t> getDegrees(bool countSelfLoopsTwice = true) const {
+        std::vector<size_t> degrees(size);
+        for (VertexIndex i : *this)
+            degrees[i] = getDegree(i, countSelfLoopsTwice);
+        return degrees;
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getAdjacencyMatrix
+    AdjacencyMatrix getAdjacencyMatrix(bool countSelfLoopsTwice = true) const {
+        AdjacencyMatrix adjacencyMatrix(size, std::vector<size_t>(size, 0));
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                adjacencyMatrix[i][j] += i == j && countSelfLoopsTwice ? 2 : 1;
+        return adjacencyMatrix;
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getSparseAdjacency
+    SparseMatrix<size_t> getSparseAdjacency(
+        bool countSelfLoopsTwice = true,
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                triplets.addEntry(i, j, i == j && countSelfLoopsTwice ? 2 : 1);
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    LabeledCompactUndirectedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        LabeledCompactUndirectedGraph permutedGraph;
+        permutedGraph.buildFrom(
+            PermutedGraphView<LabeledCompactUndirectedGraph>(*this, newIndices)
+        );
+        permutedGraph.edgeNumber = edgeNumber;
+        permutedGraph.buildEdgeIds();
+        return permutedGraph;
+    }
+
+    /// @copydoc LabeledCompactDirectedGraph::operator<<
+    friend std::ostream &operator<<(
+        std::ostream &stream, const LabeledCompactUndirectedGraph &graph
+    ) {
+        stream << "Compact undirected graph of size: " << graph.getSize()
+               << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            for (auto &neighbour : graph.getOutNeighbours(i))
+                stream << neighbour << ", ";
+            stream << "\n";
+        }
+        return stream;
+    }
+
+    /// Structure that iterates on the graph's edges. Each edge is returned
+    /// once, as \f$(i,j)\f$ where \f$i \leq j\f$.
+    struct Edges {
+        struct constEdgeIterator {
+            const LabeledCompactUndirectedGraph &graph;
+            VertexIndex vertex;
+            size_t position;
+
+            constEdgeIterator(
+                const LabeledCompactUndirectedGraph &graph, VertexIndex vertex,
+                size_t position
+            )
+                : graph(graph), vertex(vertex), position(position) {
+                skipToNextEdge();
+            }
+
+            bool operator==(constEdgeIterator rhs) const {
+                return vertex == rhs.vertex && position == rhs.position;
+            }
+            bool operator!=(constEdgeIterator rhs) const {
+                return !(*this == rhs);
+            }
+            Edge operator*() { return {vertex, graph.neighbours[position]}; }
+            constEdgeIterator operator++() {
+                ++position;
+                skipToNextEdge();
+                return *this;
+            }
+            constEdgeIterator operator++(int) {
+                constEdgeIterator tmp = *this;
+                operator++();
+                return tmp;
+            }
+            // Skips empty rows and the neighbours smaller than the current
+            // vertex, since these edges were already returned.
+            void skipToNextEdge() {
+                while (vertex < graph.size) {
+                    if (position == graph.offsets[vertex + 1])
+                        ++vertex;
+                    else if (graph.neighbours[position] < vertex)
+                        ++position;
+                    else
+                        break;
+                }
+            }
+        };
+
+        const LabeledCompactUndirectedGraph &graph;
+        Edges(const LabeledCompactUndirectedGraph &graph) : graph(graph) {}
+
+        constEdgeIterator begin() const {
+            return constEdgeIterator(graph, 0, 0);
+        }
+        constEdgeIterator end() const {
+            return constEdgeIterator(
+                graph, graph.size, graph.neighbours.size()
+            );
+        }
+    };
+    /// Creates @ref LabeledCompactUndirectedGraph::Edges object that supports
+    /// range-based for loop.
+    Edges edges() const { return Edges(*this); }
+
+  protected:
+    /// Numbers the edges in \f$O(V+E)\f$. An edge \f$(i,j)\f$ with
+    /// \f$i<j\f$ receives its identifier in the row of \f$i\f$. Rows are
+    /// visited in increasing order, so the entries of row \f$j\f$ are
+    /// reached in the same order as the entries larger than \f$j\f$ of row
+    /// \f$i\f$, and a cursor per row matches both entries of each edge.
+    void buildEdgeIds() {
+        edgeIds.resize(neighbours.size());
+        std::vector<size_t> mirrorCursors(size);
+        for (VertexIndex i = 0; i < size; ++i)
+            mirrorCursors[i] = std::upper_bound(
+                                   neighbours.begin() + offsets[i],
+                                   neighbours.begin() + offsets[i + 1], i
+                               ) -
+                               neighbours.begin();
+
+        EdgeId nextId = 0;
+        for (VertexIndex i = 0; i < size; ++i)
+            for (size_t p = offsets[i]; p < offsets[i + 1]; ++p) {
+                VertexIndex j = neighbours[p];
+                edgeIds[p] = j < i ? edgeIds[mirrorCursors[j]++] : nextId++;
+            }
+    }
+};
+
+/// Unlabeled compact undirected graph.
+using CompactUndirectedGraph = LabeledCompactUndirectedGraph<NoLabel>;
+
+/**
+ * Immutable undirected weighted graph stored in compressed sparse row form.
+ * See @ref LabeledCompactUndirectedGraph.
+ */
+class CompactUndirectedWeightedGraph
+    : private LabeledCompactUndirectedGraph<EdgeWeight> {
+    using BaseClass = LabeledCompactUndirectedGraph<EdgeWeight>;
+    EdgeWeight totalWeight = 0;
+
+  public:
+    using BaseClass::Successors;
+
+    using BaseClass::assertVertexInRange;
+    using BaseClass::begin;
+    using BaseClass::edges;
+    using BaseClass::end;
+    using BaseClass::getAdjacencyMatrix;
+    using BaseClass::getSparseAdjacency;
+    using BaseClass::getDegree;
+    using BaseClass::getDegrees;
+    using BaseClass::getEdgeId;
+    using BaseClass::getEdgeNumber;
+    using BaseClass::getNeighbours;
+    using BaseClass::getOutEdges;
+    using BaseClass::getOutNeighbours;
+    using BaseClass::getSize;
+    using BaseClass::hasEdge;
+
+    /// Constructs a graph of \p size vertices without edges.
+    explicit CompactUndirectedWeightedGraph(size_t size = 0)
+        : BaseClass(size) {}
+
+    /// Constructs a compact copy of \p graph.
+    template <typename Storage>
+    explicit CompactUndirectedWeightedGraph(
+        const BasicUndirectedWeightedGraph<Storage> &graph
+    )
+        : BaseClass(graph.asLabeledGraph()),
+          totalWeight(graph.getTotalWeight()) {}
+
+    /// @copydoc BasicUndirectedWeightedGraph::getTotalWeight
+    EdgeWeight getTotalWeight() const { return totalWeight; }
+
+    /// Returns if graph instance and \p other have the same size, edges and
+    /// edge weights.
+    bool operator==(const CompactUndirectedWeightedGraph &other) const {
+        return BaseClass::operator==(other);
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const CompactUndirectedWeightedGraph &other) const {
+        return BaseClass::operator!=(other);
+    }
+
+    /// @copydoc BasicUndirectedWeightedGraph::getEdgeWeight
+    EdgeWeight getEdgeWeight(
+        VertexIndex vertex1, VertexIndex vertex2, bool throwIfInexistent = true
+    ) const {
+        return getEdgeLabel(vertex1, vertex2, throwIfInexistent);
+    }
+    /// Returns the weights of the edges of \p vertex, in the same order as
+    /// @ref getNeighbours.
+    ArrayView<EdgeWeight> getOutEdgeWeights(VertexIndex vertex) const {
+        return getOutEdgeLabels(vertex);
+    }
+
+    /// @copydoc BasicUndirectedWeightedGraph::asLabeledGraph
+    const BaseClass &asLabeledGraph() const {
+        return static_cast<const BaseClass &>(*this);
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    CompactUndirectedWeightedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        CompactUndirectedWeightedGraph permutedGraph;
+        static_cast<BaseClass &>(permutedGraph) =
+            BaseClass::getPermutedGraph(newIndices);
+        permutedGraph.totalWeight = totalWeight;
+        return permutedGraph;
+    }
+
+    /// @copydoc BasicUndirectedWeightedGraph::getWeightMatrix
+    WeightMatrix getWeightMatrix() const {
+        WeightMatrix weightMatrix(
+            getSize(), std::vector<EdgeWeight>(getSize(), 0)
+        );
+        for (VertexIndex i : *this) {
+            auto weights = getOutEdgeWeights(i);
+            auto neighbours = getOutNeighbours(i);
+            for (size_t k = 0; k < neighbours.size(); ++k)
+                weightMatrix[i][neighbours[k]] = weights[k];
+        }
+        return weightMatrix;
+    }
+
+    /// @copydoc BasicUndirectedWeightedGraph::getSparseWeights
+    SparseMatrix<EdgeWeight> getSparseWeights(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<EdgeWeight> triplets;
+        for (VertexIndex i : *this) {
+            auto weights = getOutEdgeWeights(i);
+            auto neighbours = getOutNeighbours(i);
+            for (size_t k = 0; k < neighbours.size(); ++k)
+                triplets.addEntry(i, neighbours[k], weights[k]);
+        }
+        return buildSparseMatrix(
+            getSize(), triplets, orientation, KeepLastEntry()
+        );
+    }
+
+    /// @copydoc LabeledCompactDirectedGraph::operator<<
+    friend std::ostream &operator<<(
+        std::ostream &stream, const CompactUndirectedWeightedGraph &graph
+    ) {
+        stream << "CompactUndirectedWeightedGraph of size: " << graph.getSize()
+               << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            auto weights = graph.getOutEdgeWeights(i);
+            auto neighbours = graph.getOutNeighbours(i);
+            for (size_t k = 0; k < neighbours.size(); ++k)
+                stream << neighbours[k] << "(" << weights[k] << "), ";
+            stream << "\n";
+        }
+        return stream;
+    }
+};
+
+/**
+ * Immutable undirected multigraph stored in compressed sparse row form. The
+ * multiplicity of each edge is stored in a parallel array. See @ref
+ * LabeledCompactUndirectedGraph.
+ */
+class CompactUndirectedMultigraph
+    : private LabeledCompactUndirectedGraph<EdgeMultiplicity> {
+    using BaseClass = LabeledCompactUndirectedGraph<EdgeMultiplicity>;
+    size_t totalEdgeNumber = 0;
+
+  public:
+    using BaseClass::Successors;
+
+    using BaseClass::assertVertexInRange;
+    using BaseClass::begin;
+    using BaseClass::edges;
+    using BaseClass::end;
+    using BaseClass::getEdgeId;
+    using BaseClass::getNeighbours;
+    using BaseClass::getOutEdges;
+    using BaseClass::getOutNeighbours;
+    using BaseClass::getSize;
+    using BaseClass::hasEdge;
+    /// @copydoc BasicDirectedMultigraph::getEdgeNumber
+    using BaseClass::getEdgeNumber;
+
+    /// Constructs a graph of \p size vertices without edges.
+    explicit CompactUndirectedMultigraph(size_t size = 0) : BaseClass(size) {}
+
+    /// Constructs a compact copy of \p graph.
+    template <typename Storage>
+    explicit CompactUndirectedMultigraph(
+        const BasicUndirectedMultigraph<Storage> &graph
+    )
+        : BaseClass(graph.asLabeledGraph()),
+          totalEdgeNumber(graph.getTotalEdgeNumber()) {}
+
+    /// @copydoc BasicDirectedMultigraph::getTotalEdgeNumber
+    size_t getTotalEdgeNumber() const { return totalEdgeNumber; }
+
+    /// Returns if graph instance and \p other have the same size, edges and
+    /// edge multiplicities.
+    bool operator==(const CompactUndirectedMultigraph &other) const {
+        return BaseClass::operator==(other);
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const CompactUndirectedMultigraph &other) const {
+        return BaseClass::operator!=(other);
+    }
+
+    /// @copydoc BasicUndirectedMultigraph::getEdgeMultiplicity
+    EdgeMultiplicity
+    getEdgeMultiplicity(VertexIndex vertex1, VertexIndex vertex2) const {
+        return getEdgeLabel(vertex1, vertex2, false);
+    }
+    /// Returns the multiplicities of the edges of \p vertex, in the same order
+    /// as @ref getNeighbours.
+    ArrayView<EdgeMultiplicity> getOutEdgeMultiplicities(VertexIndex vertex
+    ) const {
+        return getOutEdgeLabels(vertex);
+    }
+
+    /// @copydoc BasicUndirectedMultigraph::asLabeledGraph
+    const BaseClass &asLabeledGraph() const {
+        return static_cast<const BaseClass &>(*this);
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    CompactUndirectedMultigraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        CompactUndirectedMultigraph permutedGraph;
+        static_cast<BaseClass &>(permutedGraph) =
+            BaseClass::getPermutedGraph(newIndices);
+        permutedGraph.totalEdgeNumber = totalEdgeNumber;
+        return permutedGraph;
+    }
+
+    /// @copydoc BasicUndirectedMultigraph::getAdjacencyMatrix
+    AdjacencyMatrix getAdjacencyMatrix(bool countSelfLoopsTwice = true) const {
+        AdjacencyMatrix adjacencyMatrix(
+            getSize(), std::vector<size_t>(getSize(), 0)
+        );
+        for (VertexIndex i : *this) {
+            auto multiplicities = getOutEdgeMultiplicities(i);
+            auto neighbours = getOutNeighbours(i);
+            for (size_t k = 0; k < neighbours.size(); ++k)
+                adjacencyMatrix[i][neighbours[k]] +=
+                    i == neighbours[k] && countSelfLoopsTwice
+                        ? 2 * multiplicities[k]
+                        : multiplicities[k];
+        }
+        return adjacencyMatrix;
+    }
+
+    /// @copydoc BasicUndirectedMultigraph::getSparseAdjacency
+    SparseMatrix<size_t> getSparseAdjacency(
+        bool countSelfLoopsTwice = true,
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        for (VertexIndex i : *this) {
+            auto multiplicities = getOutEdgeMultiplicities(i);
+            auto neighbours = getOutNeighbours(i);
+            for (size_t k = 0; k < neighbours.size(); ++k)
+                triplets.addEntry(
+                    i, neighbours[k],
+                    i == neighbours[k] && countSelfLoopsTwice
+                        ? 2 * multiplicities[k]
+                        : multiplicities[k]
+                );
+        }
+        return buildSparseMatrix(
+            getSize(), triplets, orientation, SumEntries()
+        );
+    }
+
+    /// @copydoc BasicUndirectedMultigraph::getDegree
+    size_t
+    getDegree(VertexIndex vertex, bool countSelfLoopsTwice = true) const {
+        auto multiplicities = getOutEdgeMultiplicities(vertex);
+        auto neighbours = getOutNeighbours(vertex);
+
+        size_t degree = 0;
+        for (size_t k = 0; k < neighbours.size(); ++k)
+            degree += countSelfLoopsTwice && vertex == neighbours[k]
+                          ? 2 * multiplicities[k]
+                          : multiplicities[k];
+        return degree;
+    }
+    /// @copydoc BasicUndirectedMultigraph::getDegrees
+    std::vector<size_t> getDegrees(bool countSelfLoopsTwice = true) const {
+        std::vector<size_t> degrees(getSize(), 0);
+        for (VertexIndex i : *this)
+            degrees[i] = getDegree(i, countSelfLoopsTwice);
+        return degrees;
+    }
+
+    /// @copydoc LabeledCompactDirectedGraph::operator<<
+    friend std::ostream &
+    operator<<(std::ostream &stream, const CompactUndirectedMultigraph &graph) {
+        stream << "CompactUndirectedMultigraph of size: " << graph.getSize()
+               << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            auto multiplicities = graph.getOutEdgeMultiplicities(i);
+            auto neighbours = graph.getOutNeighbours(i);
+            for (size_t k = 0; k < neighbours.size(); ++k)
+                stream << neighbours[k] << "(" << multiplicities[k] << "), ";
+            stream << "\n";
+        }
+        return stream;
+    }
+};
+
+/// Constructs the compact (read-only) version of \p graph.
+template <typename EdgeLabel, typename Storage>
+LabeledCompactUndirectedGraph<EdgeLabel>
+freeze(const LabeledUndirectedGraph<EdgeLabel, Storage> &graph) {
+    return LabeledCompactUndirectedGraph<EdgeLabel>(graph);
+}
+
+/// Constructs the compact (read-only) version of \p graph.
+template <typename Storage>
+CompactUndirectedWeightedGraph
+freeze(const BasicUndirectedWeightedGraph<Storage> &graph) {
+    return CompactUndirectedWeightedGraph(graph);
+}
+
+/// Constructs the compact (read-only) version of \p graph.
+template <typename Storage>
+CompactUndirectedMultigraph
+freeze(const BasicUndirectedMultigraph<Storage> &graph) {
+    return CompactUndirectedMultigraph(graph);
+}
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,390 @@
+#ifndef BASE_GRAPH_COMPRESSED_DIRECTED_GRAPH_HPP
+#define BASE_GRAPH_COMPRESSED_DIRECTED_GRAPH_HPP
+
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/types.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace BaseGraph {
+
+/**
+ * Immutable unlabeled directed graph whose neighbour lists are stored as
+ * variable-length gaps.
+ *
+ * The out neighbours of each vertex are sorted and only the differences
+ * between consecutive neighbours are kept, each encoded on as few bytes as
+ * possible (7 bits per byte, the last bit flags continuation). The row of a
+ * vertex starts with its out degree and its first neighbour is stored
+ * relative to the vertex itself. Graphs with locality (neighbours with close
+ * indices) typically need 1 to 2 bytes per edge instead of the
+ * `sizeof(VertexIndex)` bytes of @ref LabeledCompactDirectedGraph.
+ *
+ * The neighbours are decoded on the fly while iterating, so @ref
+ * getOutNeighbours returns a forward range instead of an array. Edge labels
+ * are discarded. The graph is built in \f$O(V+E\log d_{max})\f$ (see @ref
+ * compress) and cannot be modified afterwards.
+ */
+class CompressedDirectedGraph {
+  public:
+    /// Forward range that decodes the out neighbours of a vertex in
+    /// increasing order.
+    class Successors {
+        const uint8_t *row = nullptr;
+        VertexIndex vertex = 0;
+
+      public:
+        typedef VertexIndex value_type;
+
+        class const_iterator {
+            const uint8_t *position = nullptr;
+            size_t remaining = 0;
+            VertexIndex current = 0;
+
+          public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef VertexIndex value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const VertexIndex *pointer;
+            typedef const VertexIndex &reference;
+
+            const_iterator() {}
+            const_iterator(const uint8_t *row, VertexIndex vertex)
+                : position(row) {
+                remaining = decodeVarint(position);
+                if (remaining > 0)
+                    current = VertexIndex(
+                        vertex + decodeZigzag(decodeVarint(position))
+                    );
+            }
+
+            reference operator*() const { return current; }
+            pointer operator->() const { return &current; }
+            const_iterator &operator++() {
+                if (--remaining > 0)
+                    current += VertexIndex(decodeVarint(position));
+                return *this;
+            }
+            const_iterator operator++(int) {
+                const_iterator tmp = *this;
+                operator++();
+                return tmp;
+            }
+            // Iterators are only compared with iterators of the same row.
+            bool operator==(const const_iterator &rhs) const {
+                return remaining == rhs.remaining;
+            }
+            bool operator!=(const const_iterator &rhs) const {
+                return !(*this == rhs);
+            }
+        };
+        typedef const_iterator iterator;
+
+        Successors() {}
+        Successors(const uint8_t *row, VertexIndex vertex)
+            : row(row), vertex(vertex) {}
+
+        const_iterator begin() const { return const_iterator(row, vertex); }
+        const_iterator end() const { return const_iterator(); }
+        /// Returns the number of neighbours in \f$O(1)\f$.
+        size_t size() const {
+            const uint8_t *position = row;
+            return decodeVarint(position);
+        }
+        bool empty() const { return *row == 0; }
+    };
+
+  protected:
+    size_t size = 0;
+    size_t edgeNumber = 0;
+
+    /// The row of vertex \c i is in `bytes[offsets[i]:offsets[i+1]]`.
+    std::vector<size_t> offsets;
+    std::vector<uint8_t> bytes;
+
+  public:
+    /// Constructs a graph of \p size vertices without edges.
+    explicit CompressedDirectedGraph(size_t size = 0)
+        : size(size), offsets(size + 1), bytes(size, 0) {
+        for (size_t i = 0; i <= size; ++i)
+            offsets[i] = i;
+    }
+
+    /// Constructs a compressed copy of \p graph. Duplicate edges are kept and
+    /// edge labels are discarded.
+    template <typename EdgeLabel, typename Storage>
+    explicit CompressedDirectedGraph(
+        const LabeledDirectedGraph<EdgeLabel, Storage> &graph
+    ) {
+        buildFrom(graph);
+    }
+
+    /// Returns the number of vertices.
+    size_t getSize() const { return size; }
+    /// Returns the number of edges.
+    size_t getEdgeNumber() const { return edgeNumber; }
+
+    /// Returns if graph instance and \p other have the same size and edges.
+    bool operator==(const CompressedDirectedGraph &other) const {
+        return size == other.size && edgeNumber == other.edgeNumber &&
+               offsets == other.offsets && bytes == other.bytes;
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const CompressedDirectedGraph &other) const {
+        return !(this->operator==(other));
+    }
+
+    /// Returns if a directed edge connects \p source to \p destination. The
+    /// row of \p source is decoded until a neighbour larger or equal to \p
+    /// destination is found.
+    bool hasEdge(VertexIndex source, VertexIndex destination) const {
+        assertVertexInRange(destination);
+        for (VertexIndex neighbour : getOutNeighbours(source))
+            if (neighbour >= destination)
+                return neighbour == destination;
+        return false;
+    }
+
+    /// Returns vertices to which \p vertex is connected, sorted in increasing
+    /// order.
+    Successors getOutNeighbours(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return Successors(bytes.data() + offsets[vertex], vertex);
+    }
+
+    /// Counts the number of in edges of \p vertex. @ref getInDegrees is more
+    /// efficient when more than one in degree is needed.
+    size_t getInDegree(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        size_t inDegree = 0;
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                if (j == vertex)
+                    ++inDegree;
+        return inDegree;
+    }
+    /// Counts the number of in edges of each vertex.
+    std::vector<size_t> getInDegrees() const {
+        std::vector<size_t> inDegrees(size, 0);
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                ++inDegrees[j];
+        return inDegrees;
+    }
+    /// Counts the number of edges coming from \p vertex in \f$O(1)\f$.
+    size_t getOutDegree(VertexIndex vertex) const {
+        return getOutNeighbours(vertex).size();
+    }
+    /// Counts the number of out edges of each vertex.
+    std::vector<size_t> getOutDegrees() const {
+        std::vector<size_t> outDegrees(size, 0);
+        for (VertexIndex i : *this)
+            outDegrees[i] = getOutDegree(i);
+        return outDegrees;
+    }
+
+    /// Constructs the adjacency matrix.
+    AdjacencyMatrix getAdjacencyMatrix() const {
+        AdjacencyMatrix adjacencyMatrix(size, std::vector<size_t>(size, 0));
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                ++adjacencyMatrix[i][j];
+        return adjacencyMatrix;
+    }
+
+    /// @copydoc LabeledDirectedGraph::getSparseAdjacency
+    SparseMatrix<size_t> getSparseAdjacency(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        triplets.reserve(getEdgeNumber());
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                triplets.addEntry(i, j, 1);
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// Returns the bytes allocated by the offsets and the encoded rows in
+    /// MemoryUsage::adjacency.
+    MemoryUsage getMemoryUsage() const {
+        MemoryUsage usage;
+        usage.adjacency = offsets.capacity() * sizeof(size_t) +
+                          bytes.capacity() * sizeof(uint8_t);
+        usage.bookkeeping = sizeof(*this);
+        return usage;
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    CompressedDirectedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        CompressedDirectedGraph permutedGraph;
+        permutedGraph.buildFrom(
+            PermutedGraphView<CompressedDirectedGraph>(*this, newIndices)
+        );
+        return permutedGraph;
+    }
+
+    /// Outputs graph's size and edges in text to a given `std::stream` object.
+    friend std::ostream &
+    operator<<(std::ostream &stream, const CompressedDirectedGraph &graph) {
+        stream << "Compressed directed graph of size: " << graph.getSize()
+               << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            for (VertexIndex neighbour : graph.getOutNeighbours(i))
+                stream << neighbour << ", ";
+            stream << "\n";
+        }
+        return stream;
+    }
+
+    /// Returns VertexIterator of first vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator begin() const { return VertexIterator(0); }
+    /// Returns VertexIterator of last vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator end() const { return VertexIterator(size); }
+
+    /// Structure that iterates on the graph's edges.
+    struct Edges {
+        struct constEdgeIterator {
+            const CompressedDirectedGraph &graph;
+            VertexIndex vertex;
+            Successors::const_iterator neighbour;
+
+            constEdgeIterator(
+                const CompressedDirectedGraph &graph, VertexIndex vertex
+            )
+                : graph(graph), vertex(vertex) {
+                if (vertex < graph.size)
+                    neighbour = graph.getOutNeighbours(vertex).begin();
+                skipEmptyVertices();
+            }
+
+            bool operator==(const constEdgeIterator &rhs) const {
+                return vertex == rhs.vertex && neighbour == rhs.neighbour;
+            }
+            bool operator!=(const constEdgeIterator &rhs) const {
+                return !(*this == rhs);
+            }
+            Edge operator*() { return {vertex, *neighbour}; }
+            constEdgeIterator &operator++() {
+                ++neighbour;
+                skipEmptyVertices();
+                return *this;
+            }
+            void skipEmptyVertices() {
+                while (vertex < graph.size &&
+                       neighbour == Successors::const_iterator())
+                    if (++vertex < graph.size)
+                        neighbour = graph.getOutNeighbours(vertex).begin();
+            }
+        };
+
+        const CompressedDirectedGraph &graph;
+        Edges(const CompressedDirectedGraph &graph) : graph(graph) {}
+
+        constEdgeIterator begin() const { return constEdgeIterator(graph, 0); }
+        constEdgeIterator end() const {
+            return constEdgeIterator(graph, graph.size);
+        }
+    };
+    /// Creates @ref CompressedDirectedGraph::Edges object that supports
+    /// range-based for loop.
+    Edges edges() const { return Edges(*this); }
+
+    /// Throws `std::out_of_range` if \p vertex is not contained in the graph.
+    void assertVertexInRange(VertexIndex vertex) const {
+        if (vertex >= size)
+            throw std::out_of_range(
+                "Vertex index (" + std::to_string(vertex) +
+                ") greater than the graph's size(" + std::to_string(size) + ")."
+            );
+    }
+
+  protected:
+    /**
+     * Encodes the rows of \p graph one at a time. Each row is copied in a
+     * buffer and sorted when needed, so the only temporary memory is the
+     * buffer of the largest row.
+     *
+     * @tparam Graph Any graph that provides \c getSize and \c
+     * getOutNeighbours.
+     */
+    template <typename Graph>
+    void buildFrom(const Graph &graph) {
+        size = graph.getSize();
+        edgeNumber = 0;
+        offsets.assign(1, 0);
+        offsets.reserve(size + 1);
+        bytes.clear();
+
+        std::vector<VertexIndex> row;
+        for (VertexIndex i = 0; i < size; ++i) {
+            const auto &neighbours = graph.getOutNeighbours(i);
+            row.assign(neighbours.begin(), neighbours.end());
+            if (!std::is_sorted(row.begin(), row.end()))
+                std::sort(row.begin(), row.end());
+            encodeRow(i, row);
+            edgeNumber += row.size();
+            offsets.push_back(bytes.size());
+        }
+        bytes.shrink_to_fit();
+    }
+
+    /// Appends the degree, the first neighbour relative to \p vertex and the
+    /// gaps between the sorted neighbours of \p row.
+    void encodeRow(VertexIndex vertex, const std::vector<VertexIndex> &row) {
+        encodeVarint(row.size());
+        if (row.empty())
+            return;
+        encodeVarint(encodeZigzag(uint64_t(row[0]) - uint64_t(vertex)));
+        for (size_t k = 1; k < row.size(); ++k)
+            encodeVarint(uint64_t(row[k] - row[k - 1]));
+    }
+
+    void encodeVarint(uint64_t value) {
+        while (value >= 0x80) {
+            bytes.push_back(uint8_t(value | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(uint8_t(value));
+    }
+
+    /// Reads the integer that starts at \p position and moves \p position
+    /// after it.
+    static uint64_t decodeVarint(const uint8_t *&position) {
+        uint64_t value = *position & 0x7f;
+        for (unsigned shift = 7; *position++ & 0x80; shift += 7)
+            value |= uint64_t(*position & 0x7f) << shift;
+        return value;
+    }
+
+    /// Maps small negative and positive differences (two's complement) to
+    /// small unsigned integers.
+    static uint64_t encodeZigzag(uint64_t difference) {
+        return (difference << 1) ^ (0 - (difference >> 63));
+    }
+    static uint64_t decodeZigzag(uint64_t value) {
+        return (value >> 1) ^ (0 - (value & 1));
+    }
+};
+
+/// Constructs the compressed (read-only) version of \p graph.
+template <typename EdgeLabel, typename Storage>
+CompressedDirectedGraph
+compress(const LabeledDirectedGraph<EdgeLabel, Storage> &graph) {
+    return CompressedDirectedGraph(graph);
+}
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef BASE_GRAPH_COMPRESSED_UNDIRECTED_GRAPH_HPP
+#define BASE_GRAPH_COMPRESSED_UNDIRECTED_GRAPH_HPP
+
+#include "BaseGraph/compressed_directed_graph.hpp"
+#include "BaseGraph/types.h"
+#include "BaseGraph/undirected_graph.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace BaseGraph {
+
+/**
+ * Immutable unlabeled undirected graph whose neighbour lists are stored as
+ * variable-length gaps.
+ *
+ * Each edge is stored in the neighbours of both of its endpoints (self-loops
+ * are stored once), like in @ref LabeledUndirectedGraph. See @ref
+ * CompressedDirectedGraph for the encoding.
+ */
+class CompressedUndirectedGraph : protected CompressedDirectedGraph {
+    using Directed = CompressedDirectedGraph;
+
+  public:
+    using Directed::Successors;
+
+    /// Constructs a graph of \p size vertices without edges.
+    explicit CompressedUndirectedGraph(size_t size = 0) : Directed(size) {}
+
+    /// Constructs a compressed copy of \p graph. Duplicate edges are kept and
+    /// edge labels are discarded.
+    template <typename EdgeLabel, typename Storage>
+    explicit CompressedUndirectedGraph(
+        const LabeledUndirectedGraph<EdgeLabel, Storage> &graph
+    ) {
+        Directed::buildFrom(graph);
+        edgeNumber = graph.getEdgeNumber();
+    }
+
+    using Directed::assertVertexInRange;
+    using Directed::begin;
+    using Directed::end;
+    using Directed::getEdgeNumber;
+    using Directed::getMemoryUsage;
+    using Directed::getOutNeighbours;
+    using Directed::getSize;
+    using Directed::hasEdge;
+
+    /// Returns if graph instance and \p other have the same size and edges.
+    bool operator==(const CompressedUndirectedGraph &other) const {
+        return Directed::operator==(other);
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const CompressedUndirectedGraph &other) const {
+        return Directed::operator!=(other);
+    }
+
+    /// Returns vertices to which \p vertex is connected, sorted in increasing
+    /// order.
+    Successors getNeighbours(VertexIndex vertex) const {
+        return getOutNeighbours(vertex);
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getDegree
+    size_t
+    getDegree(VertexIndex vertex, bool countSelfLoopsTwice = true) const {
+        Successors neighbours = getOutNeighbours(vertex);
+        size_t degree = neighbours.size();
+        if (countSelfLoopsTwice)
+            for (VertexIndex neighbour : neighbours) {
+                if (neighbour > vertex)
+                    break;
+                if (neighbour == vertex)
+                    ++degree;
+            }
+        return degree;
+    }
+    /// @copydoc LabeledUndirectedGraph::getDegrees
+    std::vector<size_t> getDegrees(bool countSelfLoopsTwice = true) const {
+        std::vector<size_t> degrees(size);
+        for (VertexIndex i : *this)
+            degrees[i] = getDegree(i, countSelfLoopsTwice);
+        return degrees;
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getAdjacencyMatrix
+    AdjacencyMatrix getAdjacencyMatrix(bool countSelfLoopsTwice = true) const {
+        AdjacencyMatrix adjacencyMatrix(size, std::vector<size_t>(size, 0));
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                adjacencyMatrix[i][j] += i == j && countSelfLoopsTwice ? 2 : 1;
+        return adjacencyMatrix;
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getSparseAdjacency
+    SparseMatrix<size_t> getSparseAdjacency(
+        bool countSelfLoopsTwice = true,
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                triplets.addEntry(i, j, i == j && countSelfLoopsTwice ? 2 : 1);
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    CompressedUndirectedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        CompressedUndirectedGraph permutedGraph;
+        permutedGraph.buildFrom(
+            PermutedGraphView<CompressedUndirectedGraph>(*this, newIndices)
+        );
+        permutedGraph.edgeNumber = edgeNumber;
+        return permutedGraph;
+    }
+
+    /// @copydoc CompressedDirectedGraph::operator<<
+    friend std::ostream &
+    operator<<(std::ostream &stream, const CompressedUndirectedGraph &graph) {
+        stream << "Compressed undirected graph of size: " << graph.getSize()
+               << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            for (VertexIndex neighbour : graph.getOutNeighbours(i))
+                stream << neighbour << ", ";
+            stream << "\n";
+        }
+        return stream;
+    }
+
+    /// Structure that iterates on the graph's edges. Each edge is returned
+    /// once, as \f$(i,j)\f$ where \f$i \leq j\f$.
+    struct Edges {
+        struct constEdgeIterator {
+            const CompressedUndirectedGraph &graph;
+            VertexIndex vertex;
+            Successors::const_iterator neighbour;
+
+            constEdgeIterator(
+                const CompressedUndirectedGraph &graph, VertexIndex vertex
+            )
+                : graph(graph), vertex(vertex) {
+                if (vertex < graph.size)
+                    neighbour = graph.getOutNeighbours(vertex).begin();
+                skipToNextEdge();
+            }
+
+            bool operator==(const constEdgeIterator &rhs) const {
+                return vertex == rhs.vertex && neighbour == rhs.neighbour;
+            }
+            bool operator!=(const constEdgeIterator &rhs) const {
+                return !(*this == rhs);
+            }
+            Edge operator*() { return {vertex, *neighbour}; }
+            constEdgeIterator &operator++() {
+                ++neighbour;
+                skipToNextEdge();
+                return *this;
+            }
+            // Skips empty rows and the neighbours smaller than the current
+            // vertex, since these edges were already returned.
+            void skipToNextEdge() {
+                while (vertex < graph.size) {
+                    if (neighbour == Successors::const_iterator()) {
+                        if (++vertex < graph.size)
+                            neighbour = graph.getOutNeighbours(vertex).begin();
+                    } else if (*neighbour < vertex)
+                        ++neighbour;
+                    else
+                        break;
+                }
+            }
+        };
+
+        const CompressedUndirectedGraph &graph;
+        Edges(const CompressedUndirectedGraph &graph) : graph(graph) {}
+
+        constEdgeIterator begin() const { return constEdgeIterator(graph, 0); }
+        constEdgeIterator end() const {
+            return constEdgeIterator(graph, graph.size);
+        }
+    };
+    /// Creates @ref CompressedUndirectedGraph::Edges object that supports
+    /// range-based for loop.
+    Edges edges() const { return Edges(*this); }
+};
+
+/// Constructs the compressed (read-only) version of \p graph.
+template <typename EdgeLabel, typename Storage>
+CompressedUndirectedGraph
+compress(const LabeledUndirectedGraph<EdgeLabel, Storage> &graph) {
+    return CompressedUndirectedGraph(graph);
+}
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,250 @@
+#ifndef BASE_GRAPH_CONCURRENT_INSERTION_HPP
+#define BASE_GRAPH_CONCURRENT_INSERTION_HPP
+
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/types.h"
+#include "BaseGraph/undirected_graph.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace BaseGraph {
+
+/**
+ * Mutexes that protect the neighbours of the vertices of a graph. Vertices
+ * are distributed among the mutexes (vertex \c i uses mutex
+ * `i % getLockNumber()`), so that a graph of any size uses a bounded amount of
+ * memory while threads working on different vertices rarely wait on each
+ * other.
+ */
+class VertexLocks {
+    std::vector<std::mutex> mutexes;
+
+  public:
+    /// Holds the mutexes of the two endpoints of an edge.
+    struct PairLock {
+        std::unique_lock<std::mutex> first, second;
+    };
+
+    /// Default number of mutexes for a graph of \p size vertices: one per
+    /// vertex, up to 65536.
+    static size_t getDefaultLockNumber(size_t size) {
+        return std::max<size_t>(1, std::min<size_t>(size, 1 << 16));
+    }
+
+    /// Constructs \p lockNumber mutexes (at least one).
+    explicit VertexLocks(size_t lockNumber)
+        : mutexes(std::max<size_t>(lockNumber, 1)) {}
+
+    size_t getLockNumber() const { return mutexes.size(); }
+
+    /// Returns the mutex of \p vertex.
+    std::mutex &get(VertexIndex vertex) {
+        return mutexes[vertex % mutexes.size()];
+    }
+
+    /// Locks the mutexes of \p vertex1 and \p vertex2, once if they share the
+    /// same mutex. The mutexes are always acquired in the same order, which
+    /// prevents deadlocks between threads locking pairs of vertices.
+    PairLock lockPair(VertexIndex vertex1, VertexIndex vertex2) {
+        size_t lock1 = vertex1 % mutexes.size();
+        size_t lock2 = vertex2 % mutexes.size();
+        if (lock1 > lock2)
+            std::swap(lock1, lock2);
+
+        PairLock lock;
+        lock.first = std::unique_lock<std::mutex>(mutexes[lock1]);
+        if (lock2 != lock1)
+            lock.second = std::unique_lock<std::mutex>(mutexes[lock2]);
+        return lock;
+    }
+};
+
+/**
+ * Concurrent ingestion mode of a graph: edges can be added to \p Graph from
+ * many threads at once through @ref addEdge. Specialized for @ref
+ * LabeledDirectedGraph and @ref LabeledUndirectedGraph.
+ *
+ * While the inserter exists, the graph must only be modified through
+ * inserters and must not be read. The number of inserted edges is counted
+ * atomically and added to the edge number of the graph when the inserter is
+ * destroyed, i.e. once every thread has joined.
+ *
+ *     BaseGraph::DirectedGraph graph(vertexNumber);
+ *     {
+ *         BaseGraph::ConcurrentEdgeInserter<BaseGraph::DirectedGraph>
+ *             inserter(graph);
+ *         // Each thread calls inserter.addEdge(source, destination).
+ *     }
+ *     // graph.getEdgeNumber() is up to date.
+ *
+ * The neighbours are allocated with the allocator of the storage, which must
+ * be thread-safe (@ref BaseGraph::ArenaStorage isn't).
+ */
+template <typename Graph>
+class ConcurrentEdgeInserter;
+
+/**
+ * Adds edges to a @ref LabeledDirectedGraph from many threads. Adding an
+ * edge locks its source, and its destination when the in neighbours are
+ * tracked.
+ */
+template <typename EdgeLabel, typename Storage>
+class ConcurrentEdgeInserter<LabeledDirectedGraph<EdgeLabel, Storage>> {
+    typedef LabeledDirectedGraph<EdgeLabel, Storage> Graph;
+
+    Graph &graph;
+    VertexLocks locks;
+    std::atomic<size_t> insertedEdgeNumber;
+    std::atomic<uint64_t> insertedEdgeHashSum;
+
+    bool insertEdge(
+        VertexIndex source, VertexIndex destination, const EdgeLabel &label,
+        bool force
+    ) {
+        if (!force && graph.hasEdge(source, destination))
+            return false;
+        insertedEdgeHashSum +=
+            graph.insertNeighbour(source, destination, label);
+        ++insertedEdgeNumber;
+        return true;
+    }
+
+  public:
+    /// Prepares concurrent insertions in \p graph, whose vertices share
+    /// \p lockNumber mutexes.
+    ConcurrentEdgeInserter(Graph &graph, size_t lockNumber)
+        : graph(graph), locks(lockNumber), insertedEdgeNumber(0),
+          insertedEdgeHashSum(0) {}
+    /// Prepares concurrent insertions in \p graph with the default number of
+    /// mutexes (see @ref VertexLocks::getDefaultLockNumber).
+    explicit ConcurrentEdgeInserter(Graph &graph)
+        : ConcurrentEdgeInserter(
+              graph, VertexLocks::getDefaultLockNumber(graph.getSize())
+          ) {}
+
+    ConcurrentEdgeInserter(const ConcurrentEdgeInserter &) = delete;
+    ConcurrentEdgeInserter &operator=(const ConcurrentEdgeInserter &) = delete;
+
+    /// Adds the inserted edges to the edge number and the fingerprint of the
+    /// graph.
+    ~ConcurrentEdgeInserter() {
+        graph.edgeNumber += insertedEdgeNumber;
+        graph.edgeHashSum += insertedEdgeHashSum;
+    }
+
+    /**
+     * Thread-safe version of @ref LabeledDirectedGraph::addEdge. Returns if
+     * the edge was added.
+     *
+     * When two threads add the same edge without \p force, only one of them
+     * adds it. With sorted storages, edges are inserted in order, otherwise
+     * the order of the neighbours depends on the scheduling of the threads.
+     */
+    bool addEdge(
+        VertexIndex source, VertexIndex destination, const EdgeLabel &label,
+        bool force = false
+    ) {
+        graph.assertVertexInRange(source);
+        graph.assertVertexInRange(destination);
+
+        if (graph.inNeighboursTracked) {
+            auto lock = locks.lockPair(source, destination);
+            return insertEdge(source, destination, label, force);
+        }
+        std::lock_guard<std::mutex> lock(locks.get(source));
+        return insertEdge(source, destination, label, force);
+    }
+    /// Thread-safe version of @ref LabeledDirectedGraph::addEdge with the
+    /// default label. Returns if the edge was added.
+    bool addEdge(
+        VertexIndex source, VertexIndex destination, bool force = false
+    ) {
+        return addEdge(source, destination, EdgeLabel(), force);
+    }
+
+    /// Returns the number of edges added by this inserter so far.
+    size_t getInsertedEdgeNumber() const { return insertedEdgeNumber; }
+};
+
+/**
+ * Adds edges to a @ref LabeledUndirectedGraph from many threads. Adding an
+ * edge locks both of its endpoints, whose neighbours are both modified.
+ */
+template <typename EdgeLabel, typename Storage>
+class ConcurrentEdgeInserter<LabeledUndirectedGraph<EdgeLabel, Storage>> {
+    typedef LabeledUndirectedGraph<EdgeLabel, Storage> Graph;
+    typedef LabeledDirectedGraph<EdgeLabel, Storage> Directed;
+
+    Graph &graph;
+    VertexLocks locks;
+    std::atomic<size_t> insertedEdgeNumber;
+    std::atomic<uint64_t> insertedEdgeHashSum;
+
+    Directed &getDirected() { return static_cast<Directed &>(graph); }
+
+  public:
+    /// Prepares concurrent insertions in \p graph, whose vertices share
+    /// \p lockNumber mutexes.
+    ConcurrentEdgeInserter(Graph &graph, size_t lockNumber)
+        : graph(graph), locks(lockNumber), insertedEdgeNumber(0),
+          insertedEdgeHashSum(0) {}
+    /// Prepares concurrent insertions in \p graph with the default number of
+    /// mutexes (see @ref VertexLocks::getDefaultLockNumber).
+    explicit ConcurrentEdgeInserter(Graph &graph)
+        : ConcurrentEdgeInserter(
+              graph, VertexLocks::getDefaultLockNumber(graph.getSize())
+          ) {}
+
+    ConcurrentEdgeInserter(const ConcurrentEdgeInserter &) = delete;
+    ConcurrentEdgeInserter &operator=(const ConcurrentEdgeInserter &) = delete;
+
+    /// Adds the inserted edges to the edge number and the fingerprint of the
+    /// graph.
+    ~ConcurrentEdgeInserter() {
+        getDirected().edgeNumber += insertedEdgeNumber;
+        getDirected().edgeHashSum += insertedEdgeHashSum;
+    }
+
+    /**
+     * Thread-safe version of @ref LabeledUndirectedGraph::addEdge. Returns if
+     * the edge was added.
+     *
+     * When two threads add the same edge without \p force, only one of them
+     * adds it. With sorted storages, edges are inserted in order, otherwise
+     * the order of the neighbours depends on the scheduling of the threads.
+     */
+    bool addEdge(
+        VertexIndex vertex1, VertexIndex vertex2, const EdgeLabel &label,
+        bool force = false
+    ) {
+        graph.assertVertexInRange(vertex1);
+        graph.assertVertexInRange(vertex2);
+
+        auto lock = locks.lockPair(vertex1, vertex2);
+        if (!force && graph.hasEdge(vertex1, vertex2))
+            return false;
+        uint64_t edgeHash = 0;
+        if (vertex1 != vertex2)
+            edgeHash += getDirected().insertNeighbour(vertex1, vertex2, label);
+        edgeHash += getDirected().insertNeighbour(vertex2, vertex1, label);
+        insertedEdgeHashSum += edgeHash;
+        ++insertedEdgeNumber;
+        return true;
+    }
+    /// Thread-safe version of @ref LabeledUndirectedGraph::addEdge with the
+    /// default label. Returns if the edge was added.
+    bool addEdge(VertexIndex vertex1, VertexIndex vertex2, bool force = false) {
+        return addEdge(vertex1, vertex2, EdgeLabel(), force);
+    }
+
+    /// Returns the number of edges added by this inserter so far.
+    size_t getInsertedEdgeNumber() const { return insertedEdgeNumber; }
+};
+
+} // namespace BaseGraph
+
+#endif
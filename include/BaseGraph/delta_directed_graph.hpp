@@ -0,0 +1,590 @@
+#ifndef BASE_GRAPH_DELTA_DIRECTED_GRAPH_HPP
+#define BASE_GRAPH_DELTA_DIRECTED_GRAPH_HPP
+
+#include "BaseGraph/compact_directed_graph.hpp"
+#include "BaseGraph/types.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace BaseGraph {
+
+/**
+ * Sorted range over the out neighbours of a vertex of a @ref
+ * LabeledDeltaDirectedGraph: the neighbours in the base that aren't deleted,
+ * merged with the inserted neighbours.
+ */
+class DeltaNeighbours {
+    const VertexIndex *baseBegin = nullptr, *baseEnd = nullptr;
+    const VertexIndex *deletedBegin = nullptr, *deletedEnd = nullptr;
+    const VertexIndex *insertedBegin = nullptr, *insertedEnd = nullptr;
+
+  public:
+    class const_iterator {
+        const VertexIndex *base, *baseEnd;
+        const VertexIndex *deleted, *deletedEnd;
+        const VertexIndex *inserted, *insertedEnd;
+
+        bool isBaseNext() const {
+            return inserted == insertedEnd ||
+                   (base != baseEnd && *base <= *inserted);
+        }
+        void skipDeleted() {
+            while (base != baseEnd) {
+                while (deleted != deletedEnd && *deleted < *base)
+                    ++deleted;
+                if (deleted == deletedEnd || *deleted != *base)
+                    return;
+                ++base;
+            }
+        }
+
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef VertexIndex value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const VertexIndex *pointer;
+        typedef const VertexIndex &reference;
+
+        const_iterator(
+            const VertexIndex *base, const VertexIndex *baseEnd,
+            const VertexIndex *deleted, const VertexIndex *deletedEnd,
+            const VertexIndex *inserted, const VertexIndex *insertedEnd
+        )
+            : base(base), baseEnd(baseEnd), deleted(deleted),
+              deletedEnd(deletedEnd), inserted(inserted),
+              insertedEnd(insertedEnd) {
+            skipDeleted();
+        }
+
+        const VertexIndex &operator*() const {
+            return isBaseNext() ? *base : *inserted;
+        }
+        const_iterator &operator++() {
+            if (isBaseNext()) {
+                ++base;
+                skipDeleted();
+            } else
+                ++inserted;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            operator++();
+            return tmp;
+        }
+        bool operator==(const const_iterator &other) const {
+            return base == other.base && inserted == other.inserted;
+        }
+        bool operator!=(const const_iterator &other) const {
+            return !(*this == other);
+        }
+    };
+    typedef const_iterator iterator;
+    typedef VertexIndex value_type;
+
+    DeltaNeighbours() {}
+    DeltaNeighbours(
+        ArrayView<VertexIndex> base, const std::vector<VertexIndex> &deleted,
+        const std::vector<VertexIndex> &inserted
+    )
+        : baseBegin(base.begin()), baseEnd(base.end()),
+          deletedBegin(deleted.data()),
+          deletedEnd(deleted.data() + deleted.size()),
+          insertedBegin(inserted.data()),
+          insertedEnd(inserted.data() + inserted.size()) {}
+
+    const_iterator begin() const {
+        return const_iterator(
+            baseBegin, baseEnd, deletedBegin, deletedEnd, insertedBegin,
+            insertedEnd
+        );
+    }
+    const_iterator end() const {
+        return const_iterator(
+            baseEnd, baseEnd, deletedEnd, deletedEnd, insertedEnd, insertedEnd
+        );
+    }
+};
+
+/**
+ * Directed graph with edge labels made of an immutable @ref
+ * LabeledCompactDirectedGraph (the base) and of a mutable delta. Edge
+ * insertions are stored in a sorted vector per vertex and deletions of base
+ * edges are marked with tombstones, so updates never touch the base and cost
+ * \f$O(\log d + \delta_v)\f$, where \f$\delta_v\f$ is the size of the delta of
+ * the vertex.
+ *
+ * Queries combine both layers on the fly: the out neighbours are sorted in
+ * increasing order, @ref hasEdge and @ref getEdgeLabel are binary searches
+ * and the graph is accepted by the algorithms that only read the neighbours
+ * of vertices. When the delta grows too large (see @ref getDeltaSize), @ref
+ * merge folds it into a new base in \f$O(V+E)\f$.
+ *
+ * The base is shared by the copies of the graph, so a copy only duplicates
+ * the delta. The new base can thus be built from a snapshot in another thread
+ * while the graph keeps receiving updates:
+ * \code{.cpp}
+ * BaseGraph::DeltaDirectedGraph snapshot = graph;
+ * auto merging = std::async(std::launch::async, [&snapshot]() {
+ *     return snapshot.getMergedGraph();
+ * });
+ * // ... graph.addEdge(...), graph.removeEdge(...)
+ * graph.merge(merging.get(), snapshot);
+ * \endcode
+ *
+ * The base must not contain duplicate edges.
+ *
+ * @tparam EdgeLabel Container of edge information. Requires a default
+ * constructor and `operator==`.
+ */
+template <typename EdgeLabel>
+class LabeledDeltaDirectedGraph {
+  public:
+    /// Type of the immutable base.
+    typedef LabeledCompactDirectedGraph<EdgeLabel> Base;
+    /// Contains the out neighbours of a vertex, sorted in increasing order.
+    typedef DeltaNeighbours Successors;
+
+  protected:
+    std::shared_ptr<const Base> base;
+    size_t size = 0;
+    size_t edgeNumber = 0;
+    size_t deltaSize = 0;
+
+    /// Sorted destinations of the edges inserted since the last merge.
+    std::vector<std::vector<VertexIndex>> insertedNeighbours;
+    /// Labels of the inserted edges. Empty for unlabeled graphs.
+    std::vector<std::vector<EdgeLabel>> insertedLabels;
+    /// Sorted destinations of the base edges deleted since the last merge.
+    std::vector<std::vector<VertexIndex>> deletedNeighbours;
+
+  public:
+    /// Constructs a graph of \p size vertices without edges.
+    explicit LabeledDeltaDirectedGraph(size_t size = 0)
+        : LabeledDeltaDirectedGraph(Base(size)) {}
+
+    /// Constructs a graph whose base is \p base and whose delta is empty.
+    explicit LabeledDeltaDirectedGraph(Base base)
+        : base(std::make_shared<const Base>(std::move(base))) {
+        size = this->base->getSize();
+        edgeNumber = this->base->getEdgeNumber();
+        insertedNeighbours.resize(size);
+        if (isLabeled())
+            insertedLabels.resize(size);
+        deletedNeighbours.resize(size);
+    }
+
+    /// Returns the number of vertices.
+    size_t getSize() const { return size; }
+    /// Returns the number of edges.
+    size_t getEdgeNumber() const { return edgeNumber; }
+    /// Returns the number of inserted edges and tombstones stored in the
+    /// delta.
+    size_t getDeltaSize() const { return deltaSize; }
+    /// Returns the immutable base, which doesn't include the delta.
+    const Base &getBaseGraph() const { return *base; }
+
+    /// Sets the number of vertices to \p newSize. The new vertices are only
+    /// in the delta until the next merge.
+    /// @param newSize Number of vertices. Must be larger than the current
+    /// number of vertices.
+    void resize(size_t newSize) {
+        if (newSize < size)
+            throw std::invalid_argument("Graph's size cannot be reduced.");
+        size = newSize;
+        insertedNeighbours.resize(newSize);
+        if (isLabeled())
+            insertedLabels.resize(newSize);
+        deletedNeighbours.resize(newSize);
+    }
+
+    /**
+     * Adds labeled directed edge from vertex \p source to \p destination, if
+     * it doesn't exist. A base edge that was deleted is restored, unless its
+     * label differs from \p label.
+     */
+    void addEdge(
+        VertexIndex source, VertexIndex destination, const EdgeLabel &label
+    );
+    /// Adds edge from vertex \p source to \p destination with the default
+    /// label constructor.
+    void addEdge(VertexIndex source, VertexIndex destination) {
+        addEdge(source, destination, EdgeLabel());
+    }
+    /// Removes the directed edge from \p source to \p destination, if it
+    /// exists. A base edge is marked with a tombstone.
+    void removeEdge(VertexIndex source, VertexIndex destination);
+
+    /// Returns if a directed edge of any label connects \p source to \p
+    /// destination.
+    bool hasEdge(VertexIndex source, VertexIndex destination) const {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
+        return std::binary_search(
+                   insertedNeighbours[source].begin(),
+                   insertedNeighbours[source].end(), destination
+               ) ||
+               isAliveInBase(source, destination);
+    }
+    /// @copydoc LabeledDirectedGraph::getEdgeLabel
+    EdgeLabel getEdgeLabel(
+        VertexIndex source, VertexIndex destination,
+        bool throwIfInexistent = true
+    ) const;
+
+    /// Returns vertices to which \p vertex is connected, in increasing order.
+    /// The range is invalidated by the updates of \p vertex and by @ref
+    /// merge.
+    Successors getOutNeighbours(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return Successors(
+            getBaseNeighbours(vertex), deletedNeighbours[vertex],
+            insertedNeighbours[vertex]
+        );
+    }
+    /// Counts the number of edges coming from \p vertex, in constant time.
+    size_t getOutDegree(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return getBaseNeighbours(vertex).size() -
+               deletedNeighbours[vertex].size() +
+               insertedNeighbours[vertex].size();
+    }
+
+    /**
+     * Calls \p visitor with the destination and the label of each out edge of
+     * \p vertex, by increasing destination.
+     */
+    template <typename Visitor>
+    void forEachOutEdge(VertexIndex vertex, Visitor visitor) const;
+
+    /// Returns a compact graph that contains the edges of the base and of the
+    /// delta, in \f$O(V+E)\f$. The graph isn't modified, so this can run
+    /// concurrently with the other const methods.
+    Base getMergedGraph() const;
+    /// Replaces the base by @ref getMergedGraph and clears the delta.
+    void merge() {
+        base = std::make_shared<const Base>(getMergedGraph());
+        for (VertexIndex i : *this) {
+            std::vector<VertexIndex>().swap(insertedNeighbours[i]);
+            if (isLabeled())
+                std::vector<EdgeLabel>().swap(insertedLabels[i]);
+            std::vector<VertexIndex>().swap(deletedNeighbours[i]);
+        }
+        deltaSize = 0;
+    }
+    /**
+     * Replaces the base by \p mergedBase, the result of @ref getMergedGraph
+     * called on \p snapshot, a copy of this graph taken earlier. The updates
+     * made since the copy are kept in the delta. Only the vertices with a
+     * delta in the graph or in \p snapshot are visited, which is much faster
+     * than @ref merge when few vertices are updated.
+     *
+     * Throws `std::invalid_argument` if the graph was merged since \p
+     * snapshot was copied.
+     */
+    void merge(Base mergedBase, const LabeledDeltaDirectedGraph &snapshot);
+
+    /// Throws `std::out_of_range` if \p vertex is not contained in the graph.
+    void assertVertexInRange(VertexIndex vertex) const {
+        if (vertex >= size)
+            throw std::out_of_range(
+                "Vertex index (" + std::to_string(vertex) +
+                ") greater than the graph's size(" + std::to_string(size) + ")."
+            );
+    }
+
+    /// Returns VertexIterator of first vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator begin() const { return VertexIterator(0); }
+    /// Returns VertexIterator of last vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator end() const { return VertexIterator(size); }
+
+  protected:
+    static constexpr bool isLabeled() {
+        return !std::is_same<EdgeLabel, NoLabel>::value;
+    }
+
+    /// Returns the neighbours of \p vertex in the base, deleted or not.
+    ArrayView<VertexIndex> getBaseNeighbours(VertexIndex vertex) const {
+        if (vertex >= base->size)
+            return ArrayView<VertexIndex>();
+        return ArrayView<VertexIndex>(
+            base->neighbours.data() + base->offsets[vertex],
+            base->neighbours.data() + base->offsets[vertex + 1]
+        );
+    }
+    /// Returns if edge (\p source, \p destination) is in the base and sets \p
+    /// position to its index in the arrays of the base.
+    bool findInBase(
+        VertexIndex source, VertexIndex destination, size_t &position
+    ) const {
+        if (source >= base->size || destination >= base->size)
+            return false;
+        return base->findEdge(source, destination, position);
+    }
+    /// Returns if edge (\p source, \p destination) is in the base and not
+    /// deleted.
+    bool isAliveInBase(VertexIndex source, VertexIndex destination) const {
+        size_t position;
+        return findInBase(source, destination, position) &&
+               !std::binary_search(
+                   deletedNeighbours[source].begin(),
+                   deletedNeighbours[source].end(), destination
+               );
+    }
+};
+
+/// Unlabeled delta directed graph.
+using DeltaDirectedGraph = LabeledDeltaDirectedGraph<NoLabel>;
+
+template <typename EdgeLabel>
+void LabeledDeltaDirectedGraph<EdgeLabel>::addEdge(
+    VertexIndex source, VertexIndex destination, const EdgeLabel &label
+) {
+    assertVertexInRange(source);
+    assertVertexInRange(destination);
+
+    auto &inserted = insertedNeighbours[source];
+    auto insertedPosition =
+        std::lower_bound(inserted.begin(), inserted.end(), destination);
+    if (insertedPosition != inserted.end() && *insertedPosition == destination)
+        return;
+
+    size_t basePosition;
+    if (findInBase(source, destination, basePosition)) {
+        auto &deleted = deletedNeighbours[source];
+        auto tombstone =
+            std::lower_bound(deleted.begin(), deleted.end(), destination);
+        if (tombstone == deleted.end() || *tombstone != destination)
+            return;
+        if (!isLabeled() || base->labels[basePosition] == label) {
+            deleted.erase(tombstone);
+            --deltaSize;
+            ++edgeNumber;
+            return;
+        }
+    }
+    if (isLabeled())
+        insertedLabels[source].insert(
+            insertedLabels[source].begin() +
+                (insertedPosition - inserted.begin()),
+            label
+        );
+    inserted.insert(insertedPosition, destination);
+    ++deltaSize;
+    ++edgeNumber;
+}
+
+template <typename EdgeLabel>
+void LabeledDeltaDirectedGraph<EdgeLabel>::removeEdge(
+    VertexIndex source, VertexIndex destination
+) {
+    assertVertexInRange(source);
+    assertVertexInRange(destination);
+
+    auto &inserted = insertedNeighbours[source];
+    auto insertedPosition =
+        std::lower_bound(inserted.begin(), inserted.end(), destination);
+    if (insertedPosition != inserted.end() &&
+        *insertedPosition == destination) {
+        if (isLabeled())
+            insertedLabels[source].erase(
+                insertedLabels[source].begin() +
+                (insertedPosition - inserted.begin())
+            );
+        inserted.erase(insertedPosition);
+        --deltaSize;
+        --edgeNumber;
+        return;
+    }
+
+    size_t basePosition;
+    if (!findInBase(source, destination, basePosition))
+        return;
+    auto &deleted = deletedNeighbours[source];
+    auto tombstone =
+        std::lower_bound(deleted.begin(), deleted.end(), destination);
+    if (tombstone != deleted.end() && *tombstone == destination)
+        return;
+    deleted.insert(tombstone, destination);
+    ++deltaSize;
+    --edgeNumber;
+}
+
+template <typename EdgeLabel>
+EdgeLabel LabeledDeltaDirectedGraph<EdgeLabel>::getEdgeLabel(
+    VertexIndex source, VertexIndex destination, bool throwIfInexistent
+) const {
+    assertVertexInRange(source);
+    assertVertexInRange(destination);
+
+    const auto &inserted = insertedNeighbours[source];
+    auto insertedPosition =
+        std::lower_bound(inserted.begin(), inserted.end(), destination);
+    if (insertedPosition != inserted.end() && *insertedPosition == destination)
+        return isLabeled() ? insertedLabels[source][insertedPosition -
+                                                    inserted.begin()]
+                           : EdgeLabel();
+
+    size_t basePosition;
+    if (findInBase(source, destination, basePosition) &&
+        !std::binary_search(
+            deletedNeighbours[source].begin(), deletedNeighbours[source].end(),
+            destination
+        ))
+        return isLabeled() ? base->labels[basePosition] : EdgeLabel();
+
+    if (throwIfInexistent)
+        throw std::invalid_argument("Edge does not exist.");
+    return EdgeLabel();
+}
+
+template <typename EdgeLabel>
+template <typename Visitor>
+void LabeledDeltaDirectedGraph<EdgeLabel>::forEachOutEdge(
+    VertexIndex vertex, Visitor visitor
+) const {
+    assertVertexInRange(vertex);
+    static const EdgeLabel noLabel = EdgeLabel();
+
+    size_t position = 0, positionEnd = 0;
+    if (vertex < base->size) {
+        position = base->offsets[vertex];
+        positionEnd = base->offsets[vertex + 1];
+    }
+    const auto &inserted = insertedNeighbours[vertex];
+    const auto &deleted = deletedNeighbours[vertex];
+    auto tombstone = deleted.begin();
+    size_t k = 0;
+
+    while (position < positionEnd || k < inserted.size()) {
+        if (k == inserted.size() ||
+            (position < positionEnd &&
+             base->neighbours[position] <= inserted[k])) {
+            VertexIndex neighbour = base->neighbours[position];
+            while (tombstone != deleted.end() && *tombstone < neighbour)
+                ++tombstone;
+            if (tombstone == deleted.end() || *tombstone != neighbour)
+                visitor(
+                    neighbour, isLabeled() ? base->labels[position] : noLabel
+                );
+            ++position;
+        } else {
+            visitor(
+                inserted[k], isLabeled() ? insertedLabels[vertex][k] : noLabel
+            );
+            ++k;
+        }
+    }
+}
+
+template <typename EdgeLabel>
+LabeledCompactDirectedGraph<EdgeLabel>
+LabeledDeltaDirectedGraph<EdgeLabel>::getMergedGraph() const {
+    Base mergedGraph(size);
+    for (VertexIndex i : *this)
+        mergedGraph.offsets[i + 1] = mergedGraph.offsets[i] + getOutDegree(i);
+    mergedGraph.edgeNumber = edgeNumber;
+    mergedGraph.neighbours.reserve(edgeNumber);
+    if (isLabeled())
+        mergedGraph.labels.reserve(edgeNumber);
+
+    // Each row is visited in increasing order, so it stays sorted.
+    for (VertexIndex i : *this)
+        forEachOutEdge(i, [&](VertexIndex j, const EdgeLabel &label) {
+            mergedGraph.neighbours.push_back(j);
+            if (isLabeled())
+                mergedGraph.labels.push_back(label);
+        });
+    return mergedGraph;
+}
+
+template <typename EdgeLabel>
+void LabeledDeltaDirectedGraph<EdgeLabel>::merge(
+    Base mergedBase, const LabeledDeltaDirectedGraph &snapshot
+) {
+    if (snapshot.base != base)
+        throw std::invalid_argument(
+            "The snapshot must share the base of the graph."
+        );
+    if (mergedBase.getSize() != snapshot.size)
+        throw std::invalid_argument(
+            "The merged base must have the size of the snapshot."
+        );
+
+    std::shared_ptr<const Base> newBase =
+        std::make_shared<const Base>(std::move(mergedBase));
+    auto hasDelta = [](const LabeledDeltaDirectedGraph &graph,
+                       VertexIndex vertex) {
+        return vertex < graph.size &&
+               (!graph.insertedNeighbours[vertex].empty() ||
+                !graph.deletedNeighbours[vertex].empty());
+    };
+
+    std::vector<std::pair<VertexIndex, EdgeLabel>> edges;
+    std::vector<VertexIndex> inserted, deleted;
+    std::vector<EdgeLabel> insertedEdgeLabels;
+    deltaSize = 0;
+    for (VertexIndex i : *this) {
+        // Vertices without delta have the same edges in both bases.
+        if (!hasDelta(*this, i) && !hasDelta(snapshot, i))
+            continue;
+
+        edges.clear();
+        forEachOutEdge(i, [&](VertexIndex j, const EdgeLabel &label) {
+            edges.emplace_back(j, label);
+        });
+        inserted.clear();
+        insertedEdgeLabels.clear();
+        deleted.clear();
+
+        // Both rows are sorted: the difference is found in a single pass.
+        size_t position = 0, positionEnd = 0;
+        if (i < newBase->size) {
+            position = newBase->offsets[i];
+            positionEnd = newBase->offsets[i + 1];
+        }
+        auto insert = [&](const std::pair<VertexIndex, EdgeLabel> &edge) {
+            inserted.push_back(edge.first);
+            if (isLabeled())
+                insertedEdgeLabels.push_back(edge.second);
+        };
+        for (const auto &edge : edges) {
+            while (position < positionEnd &&
+                   newBase->neighbours[position] < edge.first)
+                deleted.push_back(newBase->neighbours[position++]);
+            if (position < positionEnd &&
+                newBase->neighbours[position] == edge.first) {
+                if (isLabeled() &&
+                    !(newBase->labels[position] == edge.second)) {
+                    deleted.push_back(edge.first);
+                    insert(edge);
+                }
+                ++position;
+            } else
+                insert(edge);
+        }
+        while (position < positionEnd)
+            deleted.push_back(newBase->neighbours[position++]);
+
+        insertedNeighbours[i] = inserted;
+        if (isLabeled())
+            insertedLabels[i] = insertedEdgeLabels;
+        deletedNeighbours[i] = deleted;
+        deltaSize += inserted.size() + deleted.size();
+    }
+    base = std::move(newBase);
+}
+
+} // namespace BaseGraph
+
+#endif
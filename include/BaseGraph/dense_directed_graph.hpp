@@ -0,0 +1,491 @@
+#ifndef BASE_GRAPH_DENSE_DIRECTED_GRAPH_HPP
+#define BASE_GRAPH_DENSE_DIRECTED_GRAPH_HPP
+
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/types.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace BaseGraph {
+
+/// Returns the number of bits set in \p word.
+inline size_t countSetBits(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) +
+           ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (word * 0x0101010101010101ULL) >> 56;
+#endif
+}
+
+/// Returns the position of the lowest bit set in \p word. \p word must not be
+/// 0.
+inline size_t findLowestSetBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    size_t position = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        ++position;
+    }
+    return position;
+#endif
+}
+
+/**
+ * Unlabeled directed graph stored as an adjacency matrix of bits.
+ *
+ * The row of each vertex is packed in 64-bit words, where bit \c j of row \c i
+ * is set when edge \f$(i,j)\f$ exists. The graph therefore uses
+ * \f$V^2/8\f$ bytes regardless of its number of edges, which is much less
+ * than the adjacency lists when the graph is dense. Edges are added, removed
+ * and queried in \f$O(1)\f$ and the operations on whole rows (degrees,
+ * intersections and unions of neighbourhoods) process 64 vertices at a time.
+ * Like a matrix of 0 and 1, the graph cannot contain multiedges.
+ */
+class DenseDirectedGraph {
+  public:
+    /// Forward range over the vertices whose bit is set in a row, in
+    /// increasing order.
+    class Successors {
+        const uint64_t *words = nullptr;
+        size_t wordNumber = 0;
+
+      public:
+        typedef VertexIndex value_type;
+
+        class const_iterator {
+            const uint64_t *words = nullptr;
+            size_t wordNumber = 0;
+            size_t wordIndex = 0;
+            uint64_t remainingBits = 0;
+
+          public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef VertexIndex value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const VertexIndex *pointer;
+            typedef VertexIndex reference;
+
+            const_iterator(
+                const uint64_t *words, size_t wordNumber, size_t wordIndex
+            )
+                : words(words), wordNumber(wordNumber), wordIndex(wordIndex) {
+                if (wordIndex < wordNumber) {
+                    remainingBits = words[wordIndex];
+                    skipEmptyWords();
+                }
+            }
+
+            reference operator*() const {
+                return VertexIndex(
+                    wordIndex * 64 + findLowestSetBit(remainingBits)
+                );
+            }
+            const_iterator &operator++() {
+                remainingBits &= remainingBits - 1;
+                skipEmptyWords();
+                return *this;
+            }
+            const_iterator operator++(int) {
+                const_iterator tmp = *this;
+                operator++();
+                return tmp;
+            }
+            bool operator==(const const_iterator &rhs) const {
+                return wordIndex == rhs.wordIndex &&
+                       remainingBits == rhs.remainingBits;
+            }
+            bool operator!=(const const_iterator &rhs) const {
+                return !(*this == rhs);
+            }
+
+          private:
+            void skipEmptyWords() {
+                while (remainingBits == 0 && ++wordIndex < wordNumber)
+                    remainingBits = words[wordIndex];
+            }
+        };
+        typedef const_iterator iterator;
+
+        Successors() {}
+        Successors(const uint64_t *words, size_t wordNumber)
+            : words(words), wordNumber(wordNumber) {}
+
+        const_iterator begin() const {
+            return const_iterator(words, wordNumber, 0);
+        }
+        const_iterator end() const {
+            return const_iterator(words, wordNumber, wordNumber);
+        }
+        /// Counts the set bits of the row.
+        size_t size() const {
+            size_t count = 0;
+            for (size_t k = 0; k < wordNumber; ++k)
+                count += countSetBits(words[k]);
+            return count;
+        }
+        bool empty() const { return begin() == end(); }
+    };
+
+  protected:
+    size_t size = 0;
+    size_t edgeNumber = 0;
+    /// Number of 64-bit words in each row.
+    size_t wordsPerRow = 0;
+    /// Bit \c j of row \c i is bit `j%64` of `bits[i*wordsPerRow + j/64]`.
+    std::vector<uint64_t> bits;
+
+  public:
+    /// Constructs a graph of \p size vertices without edges.
+    explicit DenseDirectedGraph(size_t size = 0)
+        : size(size), wordsPerRow((size + 63) / 64),
+          bits(size * wordsPerRow, 0) {}
+
+    /// Constructs a dense copy of \p graph. Duplicate edges are merged and
+    /// edge labels are discarded.
+    template <typename EdgeLabel, typename Storage>
+    explicit DenseDirectedGraph(
+        const LabeledDirectedGraph<EdgeLabel, Storage> &graph
+    )
+        : DenseDirectedGraph(graph.getSize()) {
+        for (VertexIndex i : graph)
+            for (VertexIndex j : graph.getOutNeighbours(i))
+                addEdge(i, j);
+    }
+
+    /// Returns the number of vertices.
+    size_t getSize() const { return size; }
+    /// Returns the number of edges.
+    size_t getEdgeNumber() const { return edgeNumber; }
+
+    /// Changes the number of vertices to \p newSize. The edges of the removed
+    /// vertices are removed.
+    void resize(size_t newSize) {
+        DenseDirectedGraph resizedGraph(newSize);
+        for (auto edge : edges())
+            if (edge.first < newSize && edge.second < newSize)
+                resizedGraph.addEdge(edge.first, edge.second);
+        *this = std::move(resizedGraph);
+    }
+
+    /// Returns if graph instance and \p other have the same size and edges.
+    bool operator==(const DenseDirectedGraph &other) const {
+        return size == other.size && edgeNumber == other.edgeNumber &&
+               bits == other.bits;
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const DenseDirectedGraph &other) const {
+        return !(this->operator==(other));
+    }
+
+    /// Adds a directed edge from \p source to \p destination. Does nothing if
+    /// the edge already exists.
+    void addEdge(VertexIndex source, VertexIndex destination) {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
+        if (setBit(source, destination))
+            ++edgeNumber;
+    }
+    /// Removes the directed edge from \p source to \p destination, if it
+    /// exists.
+    void removeEdge(VertexIndex source, VertexIndex destination) {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
+        if (clearBit(source, destination))
+            --edgeNumber;
+    }
+    /// Returns if a directed edge connects \p source to \p destination.
+    bool hasEdge(VertexIndex source, VertexIndex destination) const {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
+        return testBit(source, destination);
+    }
+    /// Removes all edges.
+    void clearEdges() {
+        std::fill(bits.begin(), bits.end(), 0);
+        edgeNumber = 0;
+    }
+
+    /// Returns vertices to which \p vertex is connected, in increasing order.
+    Successors getOutNeighbours(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return Successors(row(vertex), wordsPerRow);
+    }
+
+    /// Returns the out neighbours shared by \p vertex1 and \p vertex2, in
+    /// increasing order.
+    std::vector<VertexIndex>
+    getCommonOutNeighbours(VertexIndex vertex1, VertexIndex vertex2) const {
+        return combineRows(vertex1, vertex2, [](uint64_t a, uint64_t b) {
+            return a & b;
+        });
+    }
+    /// Counts the out neighbours shared by \p vertex1 and \p vertex2 without
+    /// listing them.
+    size_t
+    countCommonOutNeighbours(VertexIndex vertex1, VertexIndex vertex2) const {
+        return countCombinedRows(vertex1, vertex2, [](uint64_t a, uint64_t b) {
+            return a & b;
+        });
+    }
+    /// Returns the vertices that are out neighbours of \p vertex1 or \p
+    /// vertex2, in increasing order.
+    std::vector<VertexIndex>
+    getOutNeighbourUnion(VertexIndex vertex1, VertexIndex vertex2) const {
+        return combineRows(vertex1, vertex2, [](uint64_t a, uint64_t b) {
+            return a | b;
+        });
+    }
+    /// Counts the vertices that are out neighbours of \p vertex1 or \p vertex2
+    /// without listing them.
+    size_t
+    countOutNeighbourUnion(VertexIndex vertex1, VertexIndex vertex2) const {
+        return countCombinedRows(vertex1, vertex2, [](uint64_t a, uint64_t b) {
+            return a | b;
+        });
+    }
+
+    /// Counts the number of edges coming from \p vertex.
+    size_t getOutDegree(VertexIndex vertex) const {
+        return getOutNeighbours(vertex).size();
+    }
+    /// Counts the number of out edges of each vertex.
+    std::vector<size_t> getOutDegrees() const {
+        std::vector<size_t> outDegrees(size);
+        for (VertexIndex i : *this)
+            outDegrees[i] = getOutDegree(i);
+        return outDegrees;
+    }
+    /// Counts the number of edges going to \p vertex by reading its column.
+    size_t getInDegree(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        size_t inDegree = 0;
+        for (VertexIndex i : *this)
+            inDegree += testBit(i, vertex);
+        return inDegree;
+    }
+    /// Counts the number of in edges of each vertex.
+    std::vector<size_t> getInDegrees() const {
+        std::vector<size_t> inDegrees(size, 0);
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                ++inDegrees[j];
+        return inDegrees;
+    }
+
+    /// Constructs the adjacency matrix.
+    AdjacencyMatrix getAdjacencyMatrix() const {
+        AdjacencyMatrix adjacencyMatrix(size, std::vector<size_t>(size, 0));
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                adjacencyMatrix[i][j] = 1;
+        return adjacencyMatrix;
+    }
+
+    /// @copydoc LabeledDirectedGraph::getSparseAdjacency
+    SparseMatrix<size_t> getSparseAdjacency(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        triplets.reserve(getEdgeNumber());
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                triplets.addEntry(i, j, 1);
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// Returns the bytes allocated by the bit matrix in
+    /// MemoryUsage::adjacency.
+    MemoryUsage getMemoryUsage() const {
+        MemoryUsage usage;
+        usage.adjacency = bits.capacity() * sizeof(uint64_t);
+        usage.bookkeeping = sizeof(*this);
+        return usage;
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    DenseDirectedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        getInversePermutation(newIndices, size);
+        DenseDirectedGraph permutedGraph(size);
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                permutedGraph.setBit(newIndices[i], newIndices[j]);
+        permutedGraph.edgeNumber = edgeNumber;
+        return permutedGraph;
+    }
+
+    /// @copydoc LabeledDirectedGraph::removeVertices
+    std::vector<VertexIndex>
+    removeVertices(const std::vector<VertexIndex> &vertices) {
+        std::vector<VertexIndex> newIndices =
+            getIndicesAfterRemoval(vertices, size);
+        size_t newSize = 0;
+        for (VertexIndex newIndex : newIndices)
+            newSize += newIndex != REMOVED_VERTEX;
+
+        DenseDirectedGraph compactedGraph(newSize);
+        for (VertexIndex i : *this)
+            if (newIndices[i] != REMOVED_VERTEX)
+                for (VertexIndex j : getOutNeighbours(i))
+                    if (newIndices[j] != REMOVED_VERTEX)
+                        compactedGraph.addEdge(newIndices[i], newIndices[j]);
+        *this = std::move(compactedGraph);
+        return newIndices;
+    }
+
+    /// Outputs graph's size and edges in text to a given `std::stream` object.
+    friend std::ostream &
+    operator<<(std::ostream &stream, const DenseDirectedGraph &graph) {
+        stream << "Dense directed graph of size: " << graph.getSize() << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            for (VertexIndex neighbour : graph.getOutNeighbours(i))
+                stream << neighbour << ", ";
+            stream << "\n";
+        }
+        return stream;
+    }
+
+    /// Returns VertexIterator of first vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator begin() const { return VertexIterator(0); }
+    /// Returns VertexIterator of last vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator end() const { return VertexIterator(size); }
+
+    /// Structure that iterates on the graph's edges.
+    struct Edges {
+        struct constEdgeIterator {
+            const DenseDirectedGraph &graph;
+            VertexIndex vertex;
+            Successors::const_iterator neighbour;
+
+            constEdgeIterator(
+                const DenseDirectedGraph &graph, VertexIndex vertex
+            )
+                : graph(graph), vertex(vertex),
+                  neighbour(rowBegin(graph, vertex)) {
+                skipEmptyVertices();
+            }
+
+            bool operator==(const constEdgeIterator &rhs) const {
+                return vertex == rhs.vertex && neighbour == rhs.neighbour;
+            }
+            bool operator!=(const constEdgeIterator &rhs) const {
+                return !(*this == rhs);
+            }
+            Edge operator*() { return {vertex, *neighbour}; }
+            constEdgeIterator &operator++() {
+                ++neighbour;
+                skipEmptyVertices();
+                return *this;
+            }
+            // The end of every row compares equal, so the position of the
+            // iterator is given by the vertex.
+            void skipEmptyVertices() {
+                while (vertex < graph.size &&
+                       neighbour == rowBegin(graph, graph.size))
+                    neighbour = rowBegin(graph, ++vertex);
+            }
+            static Successors::const_iterator
+            rowBegin(const DenseDirectedGraph &graph, VertexIndex vertex) {
+                if (vertex < graph.size)
+                    return graph.getOutNeighbours(vertex).begin();
+                return Successors(nullptr, graph.wordsPerRow).end();
+            }
+        };
+
+        const DenseDirectedGraph &graph;
+        Edges(const DenseDirectedGraph &graph) : graph(graph) {}
+
+        constEdgeIterator begin() const { return constEdgeIterator(graph, 0); }
+        constEdgeIterator end() const {
+            return constEdgeIterator(graph, graph.size);
+        }
+    };
+    /// Creates @ref DenseDirectedGraph::Edges object that supports
+    /// range-based for loop.
+    Edges edges() const { return Edges(*this); }
+
+    /// Throws `std::out_of_range` if \p vertex is not contained in the graph.
+    void assertVertexInRange(VertexIndex vertex) const {
+        if (vertex >= size)
+            throw std::out_of_range(
+                "Vertex index (" + std::to_string(vertex) +
+                ") greater than the graph's size(" + std::to_string(size) + ")."
+            );
+    }
+
+  protected:
+    const uint64_t *row(VertexIndex vertex) const {
+        return bits.data() + vertex * wordsPerRow;
+    }
+    bool testBit(VertexIndex i, VertexIndex j) const {
+        return row(i)[j / 64] >> (j % 64) & 1;
+    }
+    /// Sets bit \p j of row \p i and returns if it was unset.
+    bool setBit(VertexIndex i, VertexIndex j) {
+        uint64_t &word = bits[i * wordsPerRow + j / 64];
+        uint64_t mask = uint64_t(1) << (j % 64);
+        bool wasUnset = !(word & mask);
+        word |= mask;
+        return wasUnset;
+    }
+    /// Clears bit \p j of row \p i and returns if it was set.
+    bool clearBit(VertexIndex i, VertexIndex j) {
+        uint64_t &word = bits[i * wordsPerRow + j / 64];
+        uint64_t mask = uint64_t(1) << (j % 64);
+        bool wasSet = word & mask;
+        word &= ~mask;
+        return wasSet;
+    }
+
+    /// Lists the bits set in `combine(row1[k], row2[k])` for every word \c k.
+    template <typename Combine>
+    std::vector<VertexIndex> combineRows(
+        VertexIndex vertex1, VertexIndex vertex2, Combine combine
+    ) const {
+        assertVertexInRange(vertex1);
+        assertVertexInRange(vertex2);
+        std::vector<VertexIndex> vertices;
+        const uint64_t *row1 = row(vertex1), *row2 = row(vertex2);
+        for (size_t k = 0; k < wordsPerRow; ++k)
+            for (uint64_t word = combine(row1[k], row2[k]); word != 0;
+                 word &= word - 1) {
+                size_t bit = findLowestSetBit(word);
+                vertices.push_back(VertexIndex(k * 64 + bit));
+            }
+        return vertices;
+    }
+    /// Counts the bits set in `combine(row1[k], row2[k])` for every word \c k.
+    template <typename Combine>
+    size_t countCombinedRows(
+        VertexIndex vertex1, VertexIndex vertex2, Combine combine
+    ) const {
+        assertVertexInRange(vertex1);
+        assertVertexInRange(vertex2);
+        size_t count = 0;
+        const uint64_t *row1 = row(vertex1), *row2 = row(vertex2);
+        for (size_t k = 0; k < wordsPerRow; ++k)
+            count += countSetBits(combine(row1[k], row2[k]));
+        return count;
+    }
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,244 @@
+#ifndef BASE_GRAPH_DENSE_UNDIRECTED_GRAPH_HPP
+#define BASE_GRAPH_DENSE_UNDIRECTED_GRAPH_HPP
+
+#include "BaseGraph/dense_directed_graph.hpp"
+#include "BaseGraph/types.h"
+#include "BaseGraph/undirected_graph.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace BaseGraph {
+
+/**
+ * Unlabeled undirected graph stored as a symmetric adjacency matrix of bits.
+ * See @ref DenseDirectedGraph for the memory layout.
+ */
+class DenseUndirectedGraph : protected DenseDirectedGraph {
+    using Directed = DenseDirectedGraph;
+
+  public:
+    using Directed::Successors;
+
+    /// Constructs a graph of \p size vertices without edges.
+    explicit DenseUndirectedGraph(size_t size = 0) : Directed(size) {}
+
+    /// Constructs a dense copy of \p graph. Duplicate edges are merged and
+    /// edge labels are discarded.
+    template <typename EdgeLabel, typename Storage>
+    explicit DenseUndirectedGraph(
+        const LabeledUndirectedGraph<EdgeLabel, Storage> &graph
+    )
+        : Directed(graph.getSize()) {
+        for (VertexIndex i : graph)
+            for (VertexIndex j : graph.getNeighbours(i))
+                if (i <= j)
+                    addEdge(i, j);
+    }
+
+    using Directed::assertVertexInRange;
+    using Directed::begin;
+    using Directed::clearEdges;
+    using Directed::end;
+    using Directed::getEdgeNumber;
+    using Directed::getMemoryUsage;
+    using Directed::getOutNeighbours;
+    using Directed::getSize;
+    using Directed::hasEdge;
+
+    /// Changes the number of vertices to \p newSize. The edges of the removed
+    /// vertices are removed.
+    void resize(size_t newSize) {
+        DenseUndirectedGraph resizedGraph(newSize);
+        for (auto edge : edges())
+            if (edge.second < newSize)
+                resizedGraph.addEdge(edge.first, edge.second);
+        *this = std::move(resizedGraph);
+    }
+
+    /// Returns if graph instance and \p other have the same size and edges.
+    bool operator==(const DenseUndirectedGraph &other) const {
+        return Directed::operator==(other);
+    }
+    /// Returns `not` @ref operator==.
+    bool operator!=(const DenseUndirectedGraph &other) const {
+        return Directed::operator!=(other);
+    }
+
+    /// Adds an undirected edge between \p vertex1 and \p vertex2. Does
+    /// nothing if the edge already exists.
+    void addEdge(VertexIndex vertex1, VertexIndex vertex2) {
+        Directed::addEdge(vertex1, vertex2);
+        setBit(vertex2, vertex1);
+    }
+    /// Removes the undirected edge between \p vertex1 and \p vertex2, if it
+    /// exists.
+    void removeEdge(VertexIndex vertex1, VertexIndex vertex2) {
+        Directed::removeEdge(vertex1, vertex2);
+        clearBit(vertex2, vertex1);
+    }
+
+    /// Returns vertices to which \p vertex is connected, in increasing order.
+    Successors getNeighbours(VertexIndex vertex) const {
+        return getOutNeighbours(vertex);
+    }
+
+    /// Returns the neighbours shared by \p vertex1 and \p vertex2, in
+    /// increasing order.
+    std::vector<VertexIndex>
+    getCommonNeighbours(VertexIndex vertex1, VertexIndex vertex2) const {
+        return getCommonOutNeighbours(vertex1, vertex2);
+    }
+    /// Counts the neighbours shared by \p vertex1 and \p vertex2 without
+    /// listing them.
+    size_t
+    countCommonNeighbours(VertexIndex vertex1, VertexIndex vertex2) const {
+        return countCommonOutNeighbours(vertex1, vertex2);
+    }
+    /// Returns the vertices that are neighbours of \p vertex1 or \p vertex2, in
+    /// increasing order.
+    std::vector<VertexIndex>
+    getNeighbourUnion(VertexIndex vertex1, VertexIndex vertex2) const {
+        return getOutNeighbourUnion(vertex1, vertex2);
+    }
+    /// Counts the vertices that are neighbours of \p vertex1 or \p vertex2
+    /// without listing them.
+    size_t
+    countNeighbourUnion(VertexIndex vertex1, VertexIndex vertex2) const {
+        return countOutNeighbourUnion(vertex1, vertex2);
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getDegree
+    size_t
+    getDegree(VertexIndex vertex, bool countSelfLoopsTwice = true) const {
+        size_t degree = getOutDegree(vertex);
+        if (countSelfLoopsTwice && testBit(vertex, vertex))
+            ++degree;
+        return degree;
+    }
+    /// @copydoc LabeledUndirectedGraph::getDegrees
+    std::vector<size_t> getDegrees(bool countSelfLoopsTwice = true) const {
+        std::vector<size_t> degrees(size);
+        for (VertexIndex i : *this)
+            degrees[i] = getDegree(i, countSelfLoopsTwice);
+        return degrees;
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getAdjacencyMatrix
+    AdjacencyMatrix getAdjacencyMatrix(bool countSelfLoopsTwice = true) const {
+        AdjacencyMatrix adjacencyMatrix(size, std::vector<size_t>(size, 0));
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                adjacencyMatrix[i][j] = i == j && countSelfLoopsTwice ? 2 : 1;
+        return adjacencyMatrix;
+    }
+
+    /// @copydoc LabeledUndirectedGraph::getSparseAdjacency
+    SparseMatrix<size_t> getSparseAdjacency(
+        bool countSelfLoopsTwice = true,
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        for (VertexIndex i : *this)
+            for (VertexIndex j : getOutNeighbours(i))
+                triplets.addEntry(i, j, i == j && countSelfLoopsTwice ? 2 : 1);
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    DenseUndirectedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        DenseUndirectedGraph permutedGraph;
+        static_cast<Directed &>(permutedGraph) =
+            Directed::getPermutedGraph(newIndices);
+        return permutedGraph;
+    }
+
+    /// @copydoc LabeledDirectedGraph::removeVertices
+    std::vector<VertexIndex>
+    removeVertices(const std::vector<VertexIndex> &vertices) {
+        std::vector<VertexIndex> newIndices =
+            getIndicesAfterRemoval(vertices, getSize());
+        size_t newSize = 0;
+        for (VertexIndex newIndex : newIndices)
+            newSize += newIndex != REMOVED_VERTEX;
+
+        DenseUndirectedGraph compactedGraph(newSize);
+        for (VertexIndex i : *this)
+            if (newIndices[i] != REMOVED_VERTEX)
+                for (VertexIndex j : getNeighbours(i))
+                    if (j >= i && newIndices[j] != REMOVED_VERTEX)
+                        compactedGraph.addEdge(newIndices[i], newIndices[j]);
+        *this = std::move(compactedGraph);
+        return newIndices;
+    }
+
+    /// @copydoc DenseDirectedGraph::operator<<
+    friend std::ostream &
+    operator<<(std::ostream &stream, const DenseUndirectedGraph &graph) {
+        stream << "Dense undirected graph of size: " << graph.getSize() << "\n"
+               << "Neighbours of:\n";
+
+        for (VertexIndex i : graph) {
+            stream << i << ": ";
+            for (VertexIndex neighbour : graph.getOutNeighbours(i))
+                stream << neighbour << ", ";
+            stream << "\n";
+        }
+        return stream;
+    }
+
+    /// Structure that iterates on the graph's edges. Each edge is returned
+    /// once, as \f$(i,j)\f$ where \f$i \leq j\f$.
+    struct Edges {
+        struct constEdgeIterator {
+            Directed::Edges::constEdgeIterator edge, last;
+
+            constEdgeIterator(
+                Directed::Edges::constEdgeIterator edge,
+                Directed::Edges::constEdgeIterator last
+            )
+                : edge(edge), last(last) {
+                skipToNextEdge();
+            }
+
+            bool operator==(const constEdgeIterator &rhs) const {
+                return edge == rhs.edge;
+            }
+            bool operator!=(const constEdgeIterator &rhs) const {
+                return !(*this == rhs);
+            }
+            Edge operator*() { return *edge; }
+            constEdgeIterator &operator++() {
+                ++edge;
+                skipToNextEdge();
+                return *this;
+            }
+            // Skips the edges (i,j) where j<i, since they were already
+            // returned as (j,i).
+            void skipToNextEdge() {
+                while (edge != last && (*edge).second < (*edge).first)
+                    ++edge;
+            }
+        };
+
+        Directed::Edges directedEdges;
+        Edges(const DenseUndirectedGraph &graph) : directedEdges(graph) {}
+
+        constEdgeIterator begin() const {
+            return constEdgeIterator(
+                directedEdges.begin(), directedEdges.end()
+            );
+        }
+        constEdgeIterator end() const {
+            return constEdgeIterator(directedEdges.end(), directedEdges.end());
+        }
+    };
+    /// Creates @ref DenseUndirectedGraph::Edges object that supports
+    /// range-based for loop.
+    Edges edges() const { return Edges(*this); }
+};
+
+} // namespace BaseGraph
+
+#endif
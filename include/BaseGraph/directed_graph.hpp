@@ -1,42 +1,82 @@
 #ifndef BASE_GRAPH_DIRECTED_GRAPH_HPP
 #define BASE_GRAPH_DIRECTED_GRAPH_HPP
 
-#include "BaseGraph/boost_hash.hpp"
+#include "BaseGraph/flat_edge_map.hpp"
+#include "BaseGraph/graph_views.hpp"
+#include "BaseGraph/small_vector.hpp"
+#include "BaseGraph/sparse_matrix.hpp"
 #include "BaseGraph/types.h"
+#include "BaseGraph/vertex_properties.hpp"
 
 #include <algorithm>
 #include <iostream>
-#include <set>
+#include <iterator>
+#include <limits>
 #include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <type_traits>
 
 namespace BaseGraph {
 
+template <typename Graph>
+class ConcurrentEdgeInserter;
+
 /**
  * Directed graph with edge labels, self-loops and without multiedges. When no
  * \p EdgeLabel is specified, it acts as an unlabeled graph.
  *
  * Vertices are identified an integer index between 0 and \c size -1. Vertices
- * can be added using @ref resize. Vertices cannot be removed because it
- * requires reindexing. However, a vertex can be effectively removed by erasing
- * all of its edges with @ref removeVertexFromEdgeList.
+ * can be added using @ref resize and removed with @ref removeVertices, which
+ * renumbers the remaining vertices. A vertex can also be isolated without
+ * reindexing by erasing all of its edges with @ref removeVertexFromEdgeList.
+ *
+ * The label of each edge is stored next to its destination, in a container
+ * parallel to the out neighbours of its source (see @ref getOutEdgeLabels).
+ * Unlabeled graphs store no label at all.
+ *
+ * The in neighbours of each vertex can also be maintained with @ref
+ * trackInNeighbours, which makes in degrees and vertex removals proportional
+ * to the degree instead of the number of edges.
  *
  * @tparam EdgeLabel Container of edge information. Requires a default
  * constructor.
+ * @tparam Storage Policy that chooses the container of the neighbours of each
+ * vertex (e.g. @ref BaseGraph::ListStorage or @ref BaseGraph::VectorStorage)
+ * and whether the neighbours are kept sorted (@ref BaseGraph::SortedStorage).
  */
-template <typename EdgeLabel>
+template <typename EdgeLabel, typename Storage = ListStorage>
 class LabeledDirectedGraph {
+  public:
+    /// Contains the out neighbours of a vertex.
+    typedef typename Storage::template Container<VertexIndex> Successors;
+    /// Contains the labels of the out edges of a vertex.
+    typedef typename Storage::template Container<EdgeLabel> EdgeLabels;
+
   protected:
-    AdjacencyLists adjacencyList;
+    std::vector<Successors> adjacencyList;
+    /// Labels of the out edges of each vertex, in the order of
+    /// `adjacencyList`. Empty for unlabeled graphs.
+    std::vector<EdgeLabels> adjacencyLabels;
+    /// Sources of the in edges of each vertex, one entry per edge. Empty
+    /// unless the in neighbours are tracked.
+    std::vector<Successors> inAdjacencyList;
+    bool inNeighboursTracked = false;
     size_t size = 0;
     size_t edgeNumber = 0;
+    /// Sum of @ref getEdgeHash over the stored edges, modulo \f$2^{64}\f$,
+    /// which doesn't depend on the order of the edges.
+    uint64_t edgeHashSum = 0;
+    /// Property columns, kept with one row per vertex.
+    VertexProperties vertexProperties;
 
-    std::unordered_map<Edge, EdgeLabel, hashEdge> edgeLabels;
+    // Inserts neighbours from many threads and updates the edge number and
+    // the edge hash sum.
+    template <typename Graph>
+    friend class ConcurrentEdgeInserter;
 
   public:
     /// Constructs an empty graph with \p _size vertices.
-    explicit LabeledDirectedGraph<EdgeLabel>(size_t _size = 0) {
+    explicit LabeledDirectedGraph(size_t _size = 0) {
         resize(_size);
     }
 
@@ -59,19 +99,13 @@ class LabeledDirectedGraph {
     template <
         template <class...> class Container, class... Args,
         typename U = EdgeLabel>
-    explicit LabeledDirectedGraph<EdgeLabel>(
+    explicit LabeledDirectedGraph(
         const Container<Edge, Args...> &edgeSequence,
         typename std::enable_if<
             std::is_same<U, NoLabel>::value, long long int>::type * = 0
     )
-        : LabeledDirectedGraph<EdgeLabel>(0) {
-        VertexIndex maxIndex = 0;
-        for (const Edge &edge : edgeSequence) {
-            maxIndex = std::max(edge.first, edge.second);
-            if (maxIndex >= getSize())
-                resize(maxIndex + 1);
-            addEdge(edge.first, edge.second);
-        }
+        : LabeledDirectedGraph(0) {
+        addEdges(edgeSequence);
     }
 
     /**
@@ -92,22 +126,11 @@ class LabeledDirectedGraph {
      * \endcode
      */
     template <template <class...> class Container, class... Args>
-    explicit LabeledDirectedGraph<EdgeLabel>(
+    explicit LabeledDirectedGraph(
         const Container<LabeledEdge<EdgeLabel>, Args...> &edgeSequence
     )
         : LabeledDirectedGraph(0) {
-
-        VertexIndex maxIndex = 0;
-        for (const LabeledEdge<EdgeLabel> &labeledEdge : edgeSequence) {
-            maxIndex =
-                std::max(std::get<0>(labeledEdge), std::get<1>(labeledEdge));
-            if (maxIndex >= getSize())
-                resize(maxIndex + 1);
-            addEdge(
-                std::get<0>(labeledEdge), std::get<1>(labeledEdge),
-                std::get<2>(labeledEdge)
-            );
-        }
+        addEdges(edgeSequence);
     }
 
     /// Returns the number of vertices.
@@ -120,12 +143,51 @@ class LabeledDirectedGraph {
 
     /// Returns the number of edges.
     size_t getEdgeNumber() const { return edgeNumber; }
+    /**
+     * Returns a 64-bit hash of the size, the edges and the edge labels of the
+     * graph, in \f$O(1)\f$. It is maintained by every method that modifies
+     * the edges and doesn't depend on the order of the neighbours, so equal
+     * graphs (see @ref operator==) have the same fingerprint, whatever their
+     * storage or the order in which their edges were added. Labels that
+     * `std::hash` doesn't support are ignored.
+     *
+     * The fingerprint is useful to detect that a graph changed or to find
+     * candidate duplicates among many graphs, which must then be compared
+     * with @ref operator==.
+     */
+    uint64_t getFingerprint() const {
+        return edgeHashSum ^ mixHashBits(uint64_t(size));
+    }
+
+    /// Returns the property columns of the vertices (see @ref
+    /// BaseGraph::VertexProperties), which follow the vertices when they are
+    /// added, removed or renumbered.
+    VertexProperties &getVertexProperties() { return vertexProperties; }
+    /// @copydoc getVertexProperties
+    const VertexProperties &getVertexProperties() const {
+        return vertexProperties;
+    }
+
+    /**
+     * Preallocates memory for \p vertexCapacity vertices and \p
+     * edgeCapacity edges, without changing the size of the graph. The edge
+     * capacity is spread evenly over the current vertices and only applies to
+     * storages with contiguous neighbours (e.g. @ref
+     * BaseGraph::VectorStorage).
+     */
+    void reserve(size_t vertexCapacity, size_t edgeCapacity = 0);
+    /// Releases the memory that was reserved but isn't used by the vertices
+    /// and edges.
+    void shrinkToFit();
+    /// Returns the number of bytes allocated by the graph.
+    MemoryUsage getMemoryUsage() const;
 
     /// Returns if graph instance and \p other have the same size, edges and
-    /// edge labels.
-    bool operator==(const LabeledDirectedGraph<EdgeLabel> &other) const;
+    /// edge labels. Linear in the number of edges, and constant when their
+    /// fingerprints differ (see @ref getFingerprint).
+    bool operator==(const LabeledDirectedGraph &other) const;
     /// Returns `not` @ref operator==.
-    bool operator!=(const LabeledDirectedGraph<EdgeLabel> &other) const {
+    bool operator!=(const LabeledDirectedGraph &other) const {
         return !(this->operator==(other));
     }
 
@@ -172,6 +234,36 @@ class LabeledDirectedGraph {
     ) {
         addReciprocalEdge(vertex1, vertex2, EdgeLabel(), force);
     }
+
+    /**
+     * Adds each edge of \p edgeSequence as @ref addEdge would, and adjusts
+     * the graph size to the largest index in \p edgeSequence. The edges are
+     * copied in a flat buffer and grouped by source in linear time, then each
+     * vertex receives its new neighbours at once. Existence checks are table
+     * lookups instead of scans of the neighbours, so this is much faster than
+     * successive calls to @ref addEdge for large sequences.
+     *
+     * @tparam Container Any container of @ref BaseGraph::Edge (added with the
+     * label `EdgeLabel()`) or of @ref BaseGraph::LabeledEdge that supports
+     * range-based loops.
+     * @param edgeSequence Edges to add. The neighbours of each vertex keep
+     * the order of \p edgeSequence, unless the storage is sorted.
+     * @param force If \c false, an edge is skipped if it already exists in
+     * the graph or earlier in \p edgeSequence. If \c true, every edge is
+     * added.
+     */
+    template <typename Container>
+    void addEdges(const Container &edgeSequence, bool force = false) {
+        size_t requiredSize = size;
+        auto newEdges = gatherEdges(edgeSequence, false, requiredSize);
+        if (requiredSize > size)
+            resize(requiredSize);
+        insertEdges(
+            newEdges, force,
+            [&](VertexIndex, VertexIndex, const EdgeLabel &) { ++edgeNumber; },
+            IgnoreDuplicate()
+        );
+    }
     /// Returns if a directed edge of any label connects \p source to \p
     /// destination.
     bool hasEdge(VertexIndex source, VertexIndex destination) const;
@@ -190,6 +282,29 @@ class LabeledDirectedGraph {
         return adjacencyList[vertex];
     }
 
+    /**
+     * Starts (or stops, if \p track is `false`) maintaining the in neighbours
+     * of each vertex. They are built in \f$O(V+E)\f$ and then updated by
+     * every edge insertion and removal, which costs an additional
+     * `VertexIndex` per edge. When they are tracked, @ref getInNeighbours is
+     * available, @ref getInDegree takes constant time and @ref
+     * removeVertexFromEdgeList only visits the edges of the removed vertex.
+     */
+    void trackInNeighbours(bool track = true);
+    /// Returns if the in neighbours are maintained (see @ref
+    /// trackInNeighbours).
+    bool isTrackingInNeighbours() const { return inNeighboursTracked; }
+    /// Returns vertices connected to \p vertex, once per edge. Throws
+    /// `std::logic_error` if the in neighbours are not tracked.
+    const Successors &getInNeighbours(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        if (!inNeighboursTracked)
+            throw std::logic_error(
+                "In neighbours are not tracked. Call trackInNeighbours first."
+            );
+        return inAdjacencyList[vertex];
+    }
+
     /// Removes directed edges (including duplicates) from \p source to \p
     /// destination.
     void removeEdge(VertexIndex source, VertexIndex destination);
@@ -206,34 +321,55 @@ class LabeledDirectedGraph {
         VertexIndex source, VertexIndex destination,
         bool throwIfInexistent = true
     ) const {
-        return _getLabel({source, destination}, throwIfInexistent);
+        return _getLabel(source, destination, throwIfInexistent);
     }
     /**
      * Changes the label of directed edge connecting \p source to \p
-     * destination.
+     * destination. Duplicate edges all receive the new label.
      * @param source, destination Index of the source and destination vertices.
      * @param label New edge label.
-     * @param force If `true`, the method will not check if the edge exists.
-     * This may create a label for an inexistent edge. If `false`, the method
-     * throws `std::invalid_argument` if the directed edge doesn't exist.
+     * @param force If `true`, the method does nothing when the edge doesn't
+     * exist. If `false`, the method throws `std::invalid_argument` if the
+     * directed edge doesn't exist.
      */
     void setEdgeLabel(
         VertexIndex source, VertexIndex destination, const EdgeLabel &label,
         bool force = false
     );
 
+    /// Returns the labels of the out edges of \p vertex, in the same order as
+    /// @ref getOutNeighbours. Unavailable for unlabeled graphs.
+    template <typename... Dummy, typename U = EdgeLabel>
+    const typename std::enable_if<
+        !std::is_same<U, NoLabel>::value, EdgeLabels>::type &
+    getOutEdgeLabels(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return adjacencyLabels[vertex];
+    }
+
     /// Constructs a graph where each edge orientation is reversed.
-    LabeledDirectedGraph<EdgeLabel> getReversedGraph() const {
-        LabeledDirectedGraph<EdgeLabel> reversedGraph(size);
-        for (auto edge : edges())
-            reversedGraph.addEdge(
-                edge.second, edge.first, getEdgeLabel(edge.first, edge.second)
-            );
+    LabeledDirectedGraph getReversedGraph() const {
+        LabeledDirectedGraph reversedGraph(size);
+        for (VertexIndex i : *this)
+            forEachOutEdge(i, [&](VertexIndex j, const EdgeLabel &label) {
+                reversedGraph.addEdge(j, i, label);
+            });
         return reversedGraph;
     }
 
+    /**
+     * Constructs a copy of the graph in which vertex \c i becomes
+     * `newIndices[i]`, in \f$O(V+E)\f$. The neighbours of each vertex keep
+     * their order, unless the storage is sorted. Throws
+     * `std::invalid_argument` if \p newIndices is not a permutation of the
+     * vertices.
+     */
+    LabeledDirectedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const;
+
     /// Removes duplicate edges that have been created using the flag
-    /// `force=true` in @ref addEdge.
+    /// `force=true` in @ref addEdge, keeping the first edge of each source
+    /// and destination, in \f$O(V+E)\f$.
     void removeDuplicateEdges();
 
     /// Removes each edge which connects a vertex to itself.
@@ -246,17 +382,44 @@ class LabeledDirectedGraph {
     /// nearly equivalent to removing a vertex from the graph.
     void removeVertexFromEdgeList(VertexIndex vertex);
 
+    /**
+     * Removes \p vertices and their edges, then renumbers the remaining
+     * vertices from 0 in their current order. Unlike @ref
+     * removeVertexFromEdgeList, the graph shrinks. The whole batch is removed
+     * in a single \f$O(V+E)\f$ pass and the neighbours keep their order.
+     * Throws `std::out_of_range` if a vertex is not in the graph.
+     *
+     * @param vertices Vertices to remove. Repeated vertices are ignored.
+     * @return New index of each vertex of the graph before the removal, or
+     * @ref BaseGraph::REMOVED_VERTEX for the removed vertices.
+     */
+    std::vector<VertexIndex>
+    removeVertices(const std::vector<VertexIndex> &vertices) {
+        std::vector<VertexIndex> newIndices =
+            getIndicesAfterRemoval(vertices, size);
+        edgeNumber -= compactVertices(newIndices);
+        return newIndices;
+    }
+
     /// Removes all the edges from the graph.
     void clearEdges() {
         for (VertexIndex i : *this)
             adjacencyList[i].clear();
+        for (auto &labels : adjacencyLabels)
+            labels.clear();
+        for (auto &sources : inAdjacencyList)
+            sources.clear();
         edgeNumber = 0;
+        edgeHashSum = 0;
     }
 
-    /// Counts the number of in edges of \p vertex. @ref getInDegrees is more
+    /// Counts the number of in edges of \p vertex. Takes constant time when
+    /// the in neighbours are tracked, otherwise @ref getInDegrees is more
     /// efficient when more than one in degree is needed.
     size_t getInDegree(VertexIndex vertex) const {
         assertVertexInRange(vertex);
+        if (inNeighboursTracked)
+            return inAdjacencyList[vertex].size();
         size_t inDegree = 0;
         for (auto edge : edges())
             if (edge.second == vertex)
@@ -267,6 +430,11 @@ class LabeledDirectedGraph {
     /// Counts the number of in edges of each vertex.
     std::vector<size_t> getInDegrees() const {
         std::vector<size_t> inDegrees(size, 0);
+        if (inNeighboursTracked) {
+            for (VertexIndex i : *this)
+                inDegrees[i] = inAdjacencyList[i].size();
+            return inDegrees;
+        }
         for (auto edge : edges())
             ++inDegrees[edge.second];
         return inDegrees;
@@ -294,9 +462,29 @@ class LabeledDirectedGraph {
         return adjacencyMatrix;
     }
 
+    /**
+     * Constructs the adjacency matrix in compressed sparse form in
+     * \f$O(V+E)\f$. The element \f$a_{ij}\f$ is the number of edges
+     * \f$(i,j)\f$, as in @ref getAdjacencyMatrix.
+     *
+     * @param orientation SparseOrientation::Rows groups the entries by row
+     * (out edges), SparseOrientation::Columns groups them by column (in
+     * edges).
+     */
+    SparseMatrix<size_t> getSparseAdjacency(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        triplets.reserve(edgeNumber);
+        for (VertexIndex i = 0; i < size; ++i)
+            for (VertexIndex j : adjacencyList[i])
+                triplets.addEntry(i, j, 1);
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
     /// Outputs graph's size and edges in text to a given `std::stream` object.
     friend std::ostream &operator<<(
-        std::ostream &stream, const LabeledDirectedGraph<EdgeLabel> &graph
+        std::ostream &stream, const LabeledDirectedGraph &graph
     ) {
         stream << "Directed graph of size: " << graph.getSize() << "\n"
                << "Neighbours of:\n";
@@ -322,12 +510,12 @@ class LabeledDirectedGraph {
         struct constEdgeIterator {
             VertexIndex vertex;
             const VertexIndex endVertex;
-            Successors::const_iterator neighbour;
-            const LabeledDirectedGraph<EdgeLabel> &graph;
+            typename Successors::const_iterator neighbour;
+            const LabeledDirectedGraph &graph;
 
             constEdgeIterator(
-                const LabeledDirectedGraph<EdgeLabel> &graph,
-                VertexIndex vertex, Successors::const_iterator neighbour
+                const LabeledDirectedGraph &graph, VertexIndex vertex,
+                typename Successors::const_iterator neighbour
             )
                 : vertex(vertex), neighbour(neighbour), graph(graph),
                   endVertex(getEndVertex(graph)) {}
@@ -355,14 +543,14 @@ class LabeledDirectedGraph {
             }
         };
 
-        const LabeledDirectedGraph<EdgeLabel> &graph;
-        Edges(const LabeledDirectedGraph<EdgeLabel> &graph) : graph(graph) {}
+        const LabeledDirectedGraph &graph;
+        Edges(const LabeledDirectedGraph &graph) : graph(graph) {}
 
         constEdgeIterator begin() const {
             VertexIndex endVertex = getEndVertex(graph);
 
             VertexIndex vertexWithFirstEdge = 0;
-            Successors::const_iterator neighbour =
+            typename Successors::const_iterator neighbour =
                 graph.getOutNeighbours(0).begin();
 
             while (neighbour ==
@@ -379,8 +567,7 @@ class LabeledDirectedGraph {
                 graph, endVertex, graph.getOutNeighbours(endVertex).end()
             );
         }
-        static VertexIndex
-        getEndVertex(const LabeledDirectedGraph<EdgeLabel> &graph) {
+        static VertexIndex getEndVertex(const LabeledDirectedGraph &graph) {
             auto vertexNumber = graph.getSize();
             if (vertexNumber == 0)
                 return 0;
@@ -401,159 +588,1090 @@ class LabeledDirectedGraph {
     }
 
   protected:
-    template <typename... Dummy, typename U = EdgeLabel>
-    typename std::enable_if<std::is_same<U, NoLabel>::value>::type
-    _setLabel(const Edge &edge, const EdgeLabel &label) {}
-    template <typename... Dummy, typename U = EdgeLabel>
-    typename std::enable_if<!std::is_same<U, NoLabel>::value>::type
-    _setLabel(const Edge &edge, const EdgeLabel &label) {
-        edgeLabels[edge] = label;
+    /// Returns if the edges carry a label that must be stored.
+    static constexpr bool isLabeled() {
+        return !std::is_same<EdgeLabel, NoLabel>::value;
+    }
+
+    /// Returns the entry of \p label in \p counts, or `counts.end()`.
+    template <typename LabelCounts>
+    static typename LabelCounts::iterator
+    findLabelCount(LabelCounts &counts, const EdgeLabel &label) {
+        return std::find_if(
+            counts.begin(), counts.end(),
+            [&](const typename LabelCounts::value_type &count) {
+                return count.first == label;
+            }
+        );
+    }
+
+    /// Edge callback that does nothing.
+    struct IgnoreEdge {
+        void operator()(VertexIndex, const EdgeLabel &) const {}
+    };
+
+    /// Duplicate edge callback of @ref insertEdges and @ref
+    /// eraseDuplicateEdges that keeps the stored label.
+    struct IgnoreDuplicate {
+        void operator()(
+            VertexIndex, VertexIndex, EdgeLabel &, const EdgeLabel &
+        ) const {}
+    };
+
+    /// Erased edge callback of @ref compactVertices that does nothing.
+    struct IgnoreErasedEdge {
+        void operator()(VertexIndex, VertexIndex, const EdgeLabel &) const {}
+    };
+
+    template <typename U = EdgeLabel>
+    static typename std::enable_if<IsHashable<U>::value, uint64_t>::type
+    getLabelHash(const U &label) {
+        return std::hash<U>()(label);
+    }
+    template <typename U = EdgeLabel>
+    static typename std::enable_if<!IsHashable<U>::value, uint64_t>::type
+    getLabelHash(const U &) {
+        return 0;
+    }
+    /// Returns the hash of the edge from \p source to \p destination with
+    /// \p label, which is summed in `edgeHashSum`.
+    static uint64_t getEdgeHash(
+        VertexIndex source, VertexIndex destination, const EdgeLabel &label
+    ) {
+        return mixHashBits(
+            hashEdgeKey({source, destination}) + getLabelHash(label)
+        );
+    }
+    /// Returns the sum of @ref getEdgeHash over the stored edges.
+    uint64_t sumEdgeHashes() const {
+        uint64_t sum = 0;
+        for (VertexIndex i = 0; i < size; ++i)
+            forEachOutEdge(i, [&](VertexIndex j, const EdgeLabel &label) {
+                sum += getEdgeHash(i, j, label);
+            });
+        return sum;
+    }
+    /// Replaces \p label, the label of an edge from \p source to \p
+    /// destination (e.g. returned by @ref findLabel), by \p newLabel.
+    void replaceLabel(
+        VertexIndex source, VertexIndex destination, EdgeLabel &label,
+        const EdgeLabel &newLabel
+    ) {
+        edgeHashSum -= getEdgeHash(source, destination, label);
+        label = newLabel;
+        edgeHashSum += getEdgeHash(source, destination, label);
+    }
+
+    static LabeledEdge<EdgeLabel>
+    toLabeledEdge(const Edge &edge, const EdgeLabel &label) {
+        return LabeledEdge<EdgeLabel>(edge.first, edge.second, label);
+    }
+    static const LabeledEdge<EdgeLabel> &
+    toLabeledEdge(const LabeledEdge<EdgeLabel> &edge, const EdgeLabel &) {
+        return edge;
+    }
+
+    /// Copies \p edgeSequence in a flat buffer, giving \p unlabeledEdgeLabel
+    /// to the elements that are a @ref BaseGraph::Edge. The reversed edges
+    /// (except self-loops) are also added if \p bothOrientations is `true`.
+    /// \p requiredSize is increased to fit the largest vertex index.
+    template <typename Container>
+    static std::vector<LabeledEdge<EdgeLabel>> gatherEdges(
+        const Container &edgeSequence, bool bothOrientations,
+        size_t &requiredSize, const EdgeLabel &unlabeledEdgeLabel = EdgeLabel()
+    ) {
+        std::vector<LabeledEdge<EdgeLabel>> edges;
+        for (const auto &edge : edgeSequence) {
+            const LabeledEdge<EdgeLabel> &labeledEdge =
+                toLabeledEdge(edge, unlabeledEdgeLabel);
+            VertexIndex source = std::get<0>(labeledEdge);
+            VertexIndex destination = std::get<1>(labeledEdge);
+            requiredSize = std::max(
+                requiredSize, size_t(std::max(source, destination)) + 1
+            );
+            edges.push_back(labeledEdge);
+            if (bothOrientations && source != destination)
+                edges.emplace_back(
+                    destination, source, std::get<2>(labeledEdge)
+                );
+        }
+        return edges;
+    }
+
+    template <typename OnInsert, typename OnDuplicate>
+    void insertEdges(
+        const std::vector<LabeledEdge<EdgeLabel>> &newEdges, bool force,
+        OnInsert onInsert, OnDuplicate onDuplicate
+    );
+
+    /// Calls \p onDuplicate on the labels of the out edges of \p vertex at
+    /// the positions of \p duplicates, which are sorted in place.
+    template <typename OnDuplicate>
+    void mergeDuplicates(
+        VertexIndex vertex,
+        std::vector<std::tuple<size_t, VertexIndex, EdgeLabel>> &duplicates,
+        OnDuplicate onDuplicate
+    );
+
+    /// Adds \p newNeighbours, with their labels, to the out edges of
+    /// \p vertex. Sorted storages merge them with the current neighbours.
+    void appendNeighbours(
+        VertexIndex vertex,
+        std::vector<std::pair<VertexIndex, EdgeLabel>> &newNeighbours
+    );
+
+    /// Adds \p neighbour with \p label to the out edges of \p vertex. When
+    /// the storage is sorted, \p neighbour is inserted after the neighbours
+    /// smaller or equal to it. Returns the hash of the edge (see @ref
+    /// getEdgeHash), which the caller adds to `edgeHashSum`.
+    uint64_t insertNeighbour(
+        VertexIndex vertex, VertexIndex neighbour, const EdgeLabel &label
+    ) {
+        if (inNeighboursTracked)
+            insertVertex(inAdjacencyList[neighbour], vertex);
+
+        auto &neighbours = adjacencyList[vertex];
+        if (!Storage::isSorted) {
+            neighbours.push_back(neighbour);
+            if (isLabeled())
+                adjacencyLabels[vertex].push_back(label);
+            return getEdgeHash(vertex, neighbour, label);
+        }
+        auto position =
+            std::upper_bound(neighbours.begin(), neighbours.end(), neighbour);
+        if (isLabeled()) {
+            auto &labels = adjacencyLabels[vertex];
+            labels.insert(
+                std::next(
+                    labels.begin(), std::distance(neighbours.begin(), position)
+                ),
+                label
+            );
+        }
+        neighbours.insert(position, neighbour);
+        return getEdgeHash(vertex, neighbour, label);
+    }
+
+    /// Adds \p vertex to \p vertices, after the vertices smaller or equal to
+    /// it when the storage is sorted.
+    static void insertVertex(Successors &vertices, VertexIndex vertex) {
+        if (Storage::isSorted)
+            vertices.insert(
+                std::upper_bound(vertices.begin(), vertices.end(), vertex),
+                vertex
+            );
+        else
+            vertices.push_back(vertex);
+    }
+
+    /// Erases one occurrence of \p vertex from \p vertices, if any.
+    static void eraseVertex(Successors &vertices, VertexIndex vertex) {
+        auto it =
+            Storage::isSorted
+                ? std::lower_bound(vertices.begin(), vertices.end(), vertex)
+                : std::find(vertices.begin(), vertices.end(), vertex);
+        if (it != vertices.end() && *it == vertex)
+            vertices.erase(it);
+    }
+
+    /// Returns the number of bytes allocated by \p container for its
+    /// elements. Each element of a node-based container costs its size and
+    /// two pointers. The inline elements of a SmallVector cost nothing more
+    /// than the container itself.
+    template <typename Container>
+    static size_t containerMemory(const Container &container) {
+        return container.size() *
+               (sizeof(typename Container::value_type) + 2 * sizeof(void *));
+    }
+    template <typename T, typename Allocator>
+    static size_t containerMemory(const std::vector<T, Allocator> &container) {
+        return container.capacity() * sizeof(T);
+    }
+    template <typename T, size_t N, typename Allocator>
+    static size_t
+    containerMemory(const SmallVector<T, N, Allocator> &container) {
+        return container.isInline() ? 0 : container.capacity() * sizeof(T);
+    }
+    template <typename Container>
+    static size_t containersMemory(const std::vector<Container> &containers) {
+        size_t bytes = containers.capacity() * sizeof(Container);
+        for (const auto &container : containers)
+            bytes += containerMemory(container);
+        return bytes;
+    }
+
+    template <typename Container>
+    static void reserveContainer(Container &, size_t) {}
+    template <typename T, typename Allocator>
+    static void
+    reserveContainer(std::vector<T, Allocator> &container, size_t capacity) {
+        container.reserve(capacity);
+    }
+    template <typename T, size_t N, typename Allocator>
+    static void reserveContainer(
+        SmallVector<T, N, Allocator> &container, size_t capacity
+    ) {
+        container.reserve(capacity);
+    }
+
+    template <typename Container>
+    static void shrinkContainer(Container &) {}
+    template <typename T, typename Allocator>
+    static void shrinkContainer(std::vector<T, Allocator> &container) {
+        container.shrink_to_fit();
+    }
+    template <typename T, size_t N, typename Allocator>
+    static void shrinkContainer(SmallVector<T, N, Allocator> &container) {
+        container.shrink_to_fit();
+    }
+
+    /// Returns if \p vertex is in \p neighbours.
+    static bool
+    containsNeighbour(const Successors &neighbours, VertexIndex vertex) {
+        if (Storage::isSorted)
+            return std::binary_search(
+                neighbours.begin(), neighbours.end(), vertex
+            );
+        return std::find(neighbours.begin(), neighbours.end(), vertex) !=
+               neighbours.end();
+    }
+
+    /// Returns the position of the first occurrence of \p destination in the
+    /// out neighbours of \p source, or the out degree of \p source if there
+    /// is none.
+    size_t findNeighbour(VertexIndex source, VertexIndex destination) const {
+        const auto &neighbours = adjacencyList[source];
+        auto it = Storage::isSorted ? std::lower_bound(
+                                          neighbours.begin(), neighbours.end(),
+                                          destination
+                                      )
+                                    : std::find(
+                                          neighbours.begin(), neighbours.end(),
+                                          destination
+                                      );
+        if (it == neighbours.end() || *it != destination)
+            return neighbours.size();
+        return std::distance(neighbours.begin(), it);
+    }
+
+    /// Returns the label of the first edge from \p source to \p destination
+    /// or `nullptr` if there is none. Labeled graphs only. The label must be
+    /// modified with @ref replaceLabel.
+    const EdgeLabel *
+    findLabel(VertexIndex source, VertexIndex destination) const {
+        size_t position = findNeighbour(source, destination);
+        if (position == adjacencyList[source].size())
+            return nullptr;
+        return &*std::next(adjacencyLabels[source].begin(), position);
+    }
+    EdgeLabel *findLabel(VertexIndex source, VertexIndex destination) {
+        return const_cast<EdgeLabel *>(
+            static_cast<const LabeledDirectedGraph &>(*this).findLabel(
+                source, destination
+            )
+        );
+    }
+
+    /// Calls \p visit on the label of every edge from \p source to \p
+    /// destination and returns the number of such edges. \p visit is not
+    /// called for unlabeled graphs.
+    template <typename Visitor>
+    size_t
+    visitLabels(VertexIndex source, VertexIndex destination, Visitor visit) {
+        auto &neighbours = adjacencyList[source];
+        auto first = neighbours.begin();
+        auto last = neighbours.end();
+        if (Storage::isSorted) {
+            auto occurrences = std::equal_range(first, last, destination);
+            first = occurrences.first;
+            last = occurrences.second;
+        }
+        if (!isLabeled())
+            return std::count(first, last, destination);
+
+        size_t occurrences = 0;
+        auto label = std::next(
+            adjacencyLabels[source].begin(),
+            std::distance(neighbours.begin(), first)
+        );
+        for (; first != last; ++first, ++label)
+            if (*first == destination) {
+                edgeHashSum -= getEdgeHash(source, destination, *label);
+                visit(*label);
+                edgeHashSum += getEdgeHash(source, destination, *label);
+                ++occurrences;
+            }
+        return occurrences;
+    }
+
+    /// Calls \p visit with the destination and the label of each out edge of
+    /// \p vertex.
+    template <typename Visitor>
+    void forEachOutEdge(VertexIndex vertex, Visitor visit) const {
+        if (!isLabeled()) {
+            const EdgeLabel label = EdgeLabel();
+            for (VertexIndex neighbour : adjacencyList[vertex])
+                visit(neighbour, label);
+            return;
+        }
+        auto label = adjacencyLabels[vertex].begin();
+        for (VertexIndex neighbour : adjacencyList[vertex])
+            visit(neighbour, *label++);
+    }
+
+    /// Erases the out edges of \p vertex for which \p shouldErase, called
+    /// with the destination and the label of each edge, returns `true`.
+    /// Returns the number of edges erased.
+    template <typename Predicate>
+    size_t eraseNeighboursIf(VertexIndex vertex, Predicate shouldErase) {
+        auto &neighbours = adjacencyList[vertex];
+        size_t sizeBefore = neighbours.size();
+
+        auto shouldEraseEdge = [&](VertexIndex neighbour,
+                                   const EdgeLabel &label) {
+            if (!shouldErase(neighbour, label))
+                return false;
+            if (inNeighboursTracked)
+                eraseVertex(inAdjacencyList[neighbour], vertex);
+            edgeHashSum -= getEdgeHash(vertex, neighbour, label);
+            return true;
+        };
+
+        if (!isLabeled()) {
+            const EdgeLabel label = EdgeLabel();
+            neighbours.erase(
+                std::remove_if(
+                    neighbours.begin(), neighbours.end(),
+                    [&](VertexIndex neighbour) {
+                        return shouldEraseEdge(neighbour, label);
+                    }
+                ),
+                neighbours.end()
+            );
+            return sizeBefore - neighbours.size();
+        }
+
+        auto &labels = adjacencyLabels[vertex];
+        auto keptNeighbour = neighbours.begin();
+        auto keptLabel = labels.begin();
+        auto label = labels.begin();
+        for (auto neighbour = neighbours.begin(); neighbour != neighbours.end();
+             ++neighbour, ++label) {
+            if (shouldEraseEdge(*neighbour, *label))
+                continue;
+            if (neighbour != keptNeighbour) {
+                *keptNeighbour = *neighbour;
+                *keptLabel = std::move(*label);
+            }
+            ++keptNeighbour;
+            ++keptLabel;
+        }
+        neighbours.erase(keptNeighbour, neighbours.end());
+        labels.erase(keptLabel, labels.end());
+        return sizeBefore - neighbours.size();
+    }
+
+    /// Erases every occurrence of \p neighbour in the out edges of \p vertex
+    /// and returns the number of edges erased. \p onErase is called with the
+    /// destination and the label of each erased edge.
+    template <typename Callback = IgnoreEdge>
+    size_t eraseNeighbour(
+        VertexIndex vertex, VertexIndex neighbour,
+        Callback onErase = Callback()
+    ) {
+        if (!Storage::isSorted)
+            return eraseNeighboursIf(
+                vertex,
+                [&](VertexIndex destination, const EdgeLabel &label) {
+                    if (destination != neighbour)
+                        return false;
+                    onErase(destination, label);
+                    return true;
+                }
+            );
+
+        auto &neighbours = adjacencyList[vertex];
+        auto occurrences =
+            std::equal_range(neighbours.begin(), neighbours.end(), neighbour);
+        size_t erased = std::distance(occurrences.first, occurrences.second);
+
+        if (inNeighboursTracked && erased > 0) {
+            auto &sources = inAdjacencyList[neighbour];
+            auto sourceOccurrences =
+                std::equal_range(sources.begin(), sources.end(), vertex);
+            sources.erase(sourceOccurrences.first, sourceOccurrences.second);
+        }
+
+        if (isLabeled()) {
+            auto &labels = adjacencyLabels[vertex];
+            auto firstLabel = std::next(
+                labels.begin(),
+                std::distance(neighbours.begin(), occurrences.first)
+            );
+            auto lastLabel = std::next(firstLabel, erased);
+            for (auto label = firstLabel; label != lastLabel; ++label) {
+                edgeHashSum -= getEdgeHash(vertex, neighbour, *label);
+                onErase(neighbour, *label);
+            }
+            labels.erase(firstLabel, lastLabel);
+        } else {
+            for (size_t i = 0; i < erased; ++i) {
+                edgeHashSum -= getEdgeHash(vertex, neighbour, EdgeLabel());
+                onErase(neighbour, EdgeLabel());
+            }
+        }
+        neighbours.erase(occurrences.first, occurrences.second);
+        return erased;
+    }
+
+    /// Erases the first occurrence of \p neighbour in the out edges of
+    /// \p vertex. Returns if an edge was erased.
+    bool eraseFirstNeighbour(VertexIndex vertex, VertexIndex neighbour) {
+        auto &neighbours = adjacencyList[vertex];
+        size_t position = findNeighbour(vertex, neighbour);
+        if (position == neighbours.size())
+            return false;
+
+        neighbours.erase(std::next(neighbours.begin(), position));
+        if (inNeighboursTracked)
+            eraseVertex(inAdjacencyList[neighbour], vertex);
+        if (isLabeled()) {
+            auto label = std::next(adjacencyLabels[vertex].begin(), position);
+            edgeHashSum -= getEdgeHash(vertex, neighbour, *label);
+            adjacencyLabels[vertex].erase(label);
+        } else {
+            edgeHashSum -= getEdgeHash(vertex, neighbour, EdgeLabel());
+        }
+        return true;
+    }
+
+    /// Erases every out edge of \p vertex and returns the number of edges
+    /// erased. \p onErase is called with the destination and the label of
+    /// each erased edge.
+    template <typename Callback = IgnoreEdge>
+    size_t eraseOutEdges(VertexIndex vertex, Callback onErase = Callback()) {
+        forEachOutEdge(vertex, [&](VertexIndex j, const EdgeLabel &label) {
+            edgeHashSum -= getEdgeHash(vertex, j, label);
+            onErase(j, label);
+        });
+        if (inNeighboursTracked)
+            for (VertexIndex neighbour : adjacencyList[vertex])
+                eraseVertex(inAdjacencyList[neighbour], vertex);
+
+        size_t erased = adjacencyList[vertex].size();
+        adjacencyList[vertex].clear();
+        if (isLabeled())
+            adjacencyLabels[vertex].clear();
+        return erased;
+    }
+
+    /// Erases every edge whose destination is \p vertex and returns the
+    /// number of edges erased. Only the in neighbours of \p vertex are
+    /// visited when they are tracked. \p onErase is called with the
+    /// <b>source</b> and the label of each erased edge.
+    template <typename Callback = IgnoreEdge>
+    size_t eraseInEdges(VertexIndex vertex, Callback onErase = Callback()) {
+        auto eraseFrom = [&](VertexIndex source) {
+            return eraseNeighbour(
+                source, vertex,
+                [&](VertexIndex, const EdgeLabel &label) {
+                    onErase(source, label);
+                }
+            );
+        };
+
+        size_t erased = 0;
+        if (!inNeighboursTracked) {
+            for (VertexIndex i = 0; i < size; ++i)
+                erased += eraseFrom(i);
+            return erased;
+        }
+        // Duplicate edges are all erased with their first source.
+        Successors sources(inAdjacencyList[vertex].get_allocator());
+        sources.swap(inAdjacencyList[vertex]);
+        for (VertexIndex source : sources)
+            erased += eraseFrom(source);
+        return erased;
+    }
+
+    /**
+     * Erases the out edges whose destination appeared earlier in the out
+     * neighbours of their source and returns the number of edges erased.
+     * Before being erased, each duplicate is passed to \p onDuplicate with
+     * its source, its destination, the label of the first edge of the same
+     * source and destination and its own label. The neighbours are scanned
+     * with the markers of @ref insertEdges, so this takes \f$O(V+E)\f$.
+     */
+    template <typename OnDuplicate = IgnoreDuplicate>
+    size_t eraseDuplicateEdges(OnDuplicate onDuplicate = OnDuplicate()) {
+        // The in neighbours are rebuilt once instead of being updated for
+        // each erased edge.
+        bool wasTrackingInNeighbours = inNeighboursTracked;
+        trackInNeighbours(false);
+
+        // position[j] is the position of the first edge from the current
+        // source to j. It is valid only if lastSource[j] is the current
+        // source.
+        const VertexIndex NONE = std::numeric_limits<VertexIndex>::max();
+        std::vector<VertexIndex> lastSource(size, NONE);
+        std::vector<size_t> position(isLabeled() ? size : 0);
+        std::vector<EdgeLabel *> firstLabel(isLabeled() ? size : 0);
+
+        size_t erased = 0;
+        for (VertexIndex source = 0; source < size; ++source) {
+            if (!isLabeled()) {
+                EdgeLabel label;
+                erased += eraseNeighboursIf(
+                    source,
+                    [&](VertexIndex neighbour, const EdgeLabel &) {
+                        if (lastSource[neighbour] != source) {
+                            lastSource[neighbour] = source;
+                            return false;
+                        }
+                        onDuplicate(source, neighbour, label, label);
+                        return true;
+                    }
+                );
+                continue;
+            }
+
+            // Erasing moves the labels, so the duplicates are passed to
+            // onDuplicate beforehand.
+            size_t i = 0;
+            auto label = adjacencyLabels[source].begin();
+            for (VertexIndex neighbour : adjacencyList[source]) {
+                if (lastSource[neighbour] != source) {
+                    lastSource[neighbour] = source;
+                    position[neighbour] = i;
+                    firstLabel[neighbour] = &*label;
+                } else {
+                    EdgeLabel &storedLabel = *firstLabel[neighbour];
+                    edgeHashSum -= getEdgeHash(source, neighbour, storedLabel);
+                    onDuplicate(source, neighbour, storedLabel, *label);
+                    edgeHashSum += getEdgeHash(source, neighbour, storedLabel);
+                }
+                ++i;
+                ++label;
+            }
+            i = 0;
+            erased += eraseNeighboursIf(
+                source, [&](VertexIndex neighbour, const EdgeLabel &) {
+                    return position[neighbour] != i++;
+                }
+            );
+        }
+        trackInNeighbours(wasTrackingInNeighbours);
+        return erased;
+    }
+
+    /**
+     * Erases the vertices whose new index is @ref BaseGraph::REMOVED_VERTEX,
+     * with their edges, and moves every other vertex \c i to
+     * `newIndices[i]`, which must keep the remaining vertices in the same
+     * relative order. Each vertex is visited once, so this takes
+     * \f$O(V+E)\f$. \p onErase is called with the source, the destination
+     * and the label of each erased edge. Returns the number of edges erased.
+     */
+    template <typename Callback = IgnoreErasedEdge>
+    size_t compactVertices(
+        const std::vector<VertexIndex> &newIndices,
+        Callback onErase = Callback()
+    ) {
+        // The in neighbours are rebuilt once instead of being updated for
+        // each erased edge.
+        bool wasTrackingInNeighbours = inNeighboursTracked;
+        trackInNeighbours(false);
+
+        size_t erased = 0;
+        size_t newSize = 0;
+        for (VertexIndex i = 0; i < size; ++i) {
+            if (newIndices[i] == REMOVED_VERTEX) {
+                forEachOutEdge(i, [&](VertexIndex j, const EdgeLabel &label) {
+                    onErase(i, j, label);
+                });
+                erased += adjacencyList[i].size();
+                continue;
+            }
+            erased += eraseNeighboursIf(
+                i,
+                [&](VertexIndex j, const EdgeLabel &label) {
+                    if (newIndices[j] != REMOVED_VERTEX)
+                        return false;
+                    onErase(i, j, label);
+                    return true;
+                }
+            );
+            // The new indices are increasing, so sorted neighbours stay
+            // sorted.
+            for (VertexIndex &j : adjacencyList[i])
+                j = newIndices[j];
+
+            // The slot of the new index belongs to a vertex that was already
+            // moved or erased.
+            if (newIndices[i] != i) {
+                adjacencyList[newIndices[i]].swap(adjacencyList[i]);
+                if (isLabeled())
+                    adjacencyLabels[newIndices[i]].swap(adjacencyLabels[i]);
+            }
+            ++newSize;
+        }
+        adjacencyList.erase(
+            adjacencyList.begin() + newSize, adjacencyList.end()
+        );
+        if (isLabeled())
+            adjacencyLabels.erase(
+                adjacencyLabels.begin() + newSize, adjacencyLabels.end()
+            );
+        size = newSize;
+        // The hashes of the edges changed with the indices of their vertices.
+        edgeHashSum = sumEdgeHashes();
+        vertexProperties.applyIndicesAfterRemoval(newIndices);
+        trackInNeighbours(wasTrackingInNeighbours);
+        return erased;
     }
 
     template <typename... Dummy, typename U = EdgeLabel>
     typename std::enable_if<std::is_same<U, NoLabel>::value, EdgeLabel>::type
-    _getLabel(const Edge &edge, bool throwIfInexistent) const {
-        assertVertexInRange(edge.first);
-        assertVertexInRange(edge.second);
+    _getLabel(
+        VertexIndex source, VertexIndex destination, bool throwIfInexistent
+    ) const {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
         return NoLabel();
     }
     template <typename... Dummy, typename U = EdgeLabel>
     typename std::enable_if<!std::is_same<U, NoLabel>::value, EdgeLabel>::type
-    _getLabel(const Edge &edge, bool throwIfInexistent) const {
-        assertVertexInRange(edge.first);
-        assertVertexInRange(edge.second);
-        try {
-            return edgeLabels.at(edge);
-        } catch (std::out_of_range &err) {
-            if (throwIfInexistent)
-                throw std::invalid_argument("Edge label does not exist.");
-            return EdgeLabel();
-        }
+    _getLabel(
+        VertexIndex source, VertexIndex destination, bool throwIfInexistent
+    ) const {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
+
+        const EdgeLabel *label = findLabel(source, destination);
+        if (label != nullptr)
+            return *label;
+        if (throwIfInexistent)
+            throw std::invalid_argument("Edge label does not exist.");
+        return EdgeLabel();
     }
 };
 
 /// Unlabeled directed graph.
 using DirectedGraph = LabeledDirectedGraph<NoLabel>;
 
-template <typename EdgeLabel>
-void LabeledDirectedGraph<EdgeLabel>::resize(size_t newSize) {
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::resize(size_t newSize) {
     if (newSize < size)
         throw std::invalid_argument("Graph's size cannot be reduced.");
     size = newSize;
-    adjacencyList.resize(newSize, std::list<VertexIndex>());
+    adjacencyList.resize(newSize, Successors());
+    if (isLabeled())
+        adjacencyLabels.resize(newSize, EdgeLabels());
+    if (inNeighboursTracked)
+        inAdjacencyList.resize(newSize, Successors());
+    vertexProperties.resize(newSize);
 }
 
-template <typename EdgeLabel>
-bool LabeledDirectedGraph<EdgeLabel>::operator==(
-    const LabeledDirectedGraph<EdgeLabel> &other
-) const {
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::reserve(
+    size_t vertexCapacity, size_t edgeCapacity
+) {
+    adjacencyList.reserve(vertexCapacity);
+    if (isLabeled())
+        adjacencyLabels.reserve(vertexCapacity);
+    if (inNeighboursTracked)
+        inAdjacencyList.reserve(vertexCapacity);
+
+    if (edgeCapacity == 0 || size == 0)
+        return;
+    size_t edgesPerVertex = (edgeCapacity + size - 1) / size;
+    for (VertexIndex i = 0; i < size; ++i) {
+        reserveContainer(adjacencyList[i], edgesPerVertex);
+        if (isLabeled())
+            reserveContainer(adjacencyLabels[i], edgesPerVertex);
+        if (inNeighboursTracked)
+            reserveContainer(inAdjacencyList[i], edgesPerVertex);
+    }
+}
 
-    bool isEqual = size == other.size && edgeNumber == other.edgeNumber &&
-                   edgeLabels == other.edgeLabels;
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::shrinkToFit() {
+    for (auto &neighbours : adjacencyList)
+        shrinkContainer(neighbours);
+    for (auto &labels : adjacencyLabels)
+        shrinkContainer(labels);
+    for (auto &sources : inAdjacencyList)
+        shrinkContainer(sources);
+    adjacencyList.shrink_to_fit();
+    adjacencyLabels.shrink_to_fit();
+    inAdjacencyList.shrink_to_fit();
+}
 
-    std::list<VertexIndex>::const_iterator it;
-    for (VertexIndex i = 0; i < size && isEqual; ++i) {
-        for (it = adjacencyList[i].begin();
-             it != adjacencyList[i].end() && isEqual; ++it) {
-            if (!other.hasEdge(i, *it))
-                isEqual = false;
+template <typename EdgeLabel, typename Storage>
+MemoryUsage LabeledDirectedGraph<EdgeLabel, Storage>::getMemoryUsage() const {
+    MemoryUsage usage;
+    usage.adjacency =
+        containersMemory(adjacencyList) + containersMemory(inAdjacencyList);
+    usage.labels = containersMemory(adjacencyLabels);
+    usage.bookkeeping = sizeof(*this);
+    return usage;
+}
+
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::trackInNeighbours(bool track) {
+    inNeighboursTracked = track;
+    std::vector<Successors>().swap(inAdjacencyList);
+    if (!track)
+        return;
+
+    // Sources are visited in increasing order, so sorted storages stay sorted.
+    inAdjacencyList.resize(size, Successors());
+    for (VertexIndex i = 0; i < size; ++i)
+        for (VertexIndex j : adjacencyList[i])
+            inAdjacencyList[j].push_back(i);
+}
+
+/**
+ * Inserts \p newEdges in the out edges of their source in a single pass. The
+ * edges are grouped by source with a counting sort, which preserves their
+ * relative order. Unless \p force is `true`, an edge whose destination is
+ * already a neighbour of its source (in the graph or earlier in \p newEdges)
+ * isn't inserted. Instead, \p onDuplicate is called with the source, the
+ * destination, the stored label and the label of the duplicate. \p onInsert
+ * is called with the source, the destination and the label of each inserted
+ * edge, before its duplicates are merged into it.
+ */
+template <typename EdgeLabel, typename Storage>
+template <typename OnInsert, typename OnDuplicate>
+void LabeledDirectedGraph<EdgeLabel, Storage>::insertEdges(
+    const std::vector<LabeledEdge<EdgeLabel>> &newEdges, bool force,
+    OnInsert onInsert, OnDuplicate onDuplicate
+) {
+    std::vector<size_t> offsets(size + 1, 0);
+    for (const auto &edge : newEdges) {
+        assertVertexInRange(std::get<0>(edge));
+        assertVertexInRange(std::get<1>(edge));
+        ++offsets[std::get<0>(edge) + 1];
+    }
+    for (size_t i = 0; i < size; ++i)
+        offsets[i + 1] += offsets[i];
+
+    std::vector<size_t> order(newEdges.size());
+    std::vector<size_t> nextPosition(offsets.begin(), offsets.end() - 1);
+    for (size_t k = 0; k < newEdges.size(); ++k)
+        order[nextPosition[std::get<0>(newEdges[k])]++] = k;
+    std::vector<size_t>().swap(nextPosition);
+
+    // position[j] is the position of the first edge from the current source
+    // to j, counting the new edges after the current neighbours. It is valid
+    // only if lastSource[j] is the current source.
+    const VertexIndex NONE = std::numeric_limits<VertexIndex>::max();
+    std::vector<VertexIndex> lastSource(force ? 0 : size, NONE);
+    std::vector<size_t> position(force ? 0 : size);
+
+    std::vector<std::pair<VertexIndex, EdgeLabel>> newNeighbours;
+    std::vector<std::tuple<size_t, VertexIndex, EdgeLabel>> duplicates;
+
+    for (VertexIndex source = 0; source < size; ++source) {
+        if (offsets[source] == offsets[source + 1])
+            continue;
+
+        size_t degree = adjacencyList[source].size();
+        if (!force) {
+            size_t i = 0;
+            for (VertexIndex neighbour : adjacencyList[source]) {
+                if (lastSource[neighbour] != source) {
+                    lastSource[neighbour] = source;
+                    position[neighbour] = i;
+                }
+                ++i;
+            }
         }
 
-        for (it = other.adjacencyList[i].begin();
-             it != other.adjacencyList[i].end() && isEqual; ++it) {
-            if (!hasEdge(i, *it))
-                isEqual = false;
+        newNeighbours.clear();
+        duplicates.clear();
+        for (size_t k = offsets[source]; k < offsets[source + 1]; ++k) {
+            const auto &edge = newEdges[order[k]];
+            VertexIndex destination = std::get<1>(edge);
+
+            if (!force && lastSource[destination] == source) {
+                size_t i = position[destination];
+                if (i < degree)
+                    duplicates.emplace_back(i, destination, std::get<2>(edge));
+                else
+                    onDuplicate(
+                        source, destination, newNeighbours[i - degree].second,
+                        std::get<2>(edge)
+                    );
+                continue;
+            }
+            if (!force) {
+                lastSource[destination] = source;
+                position[destination] = degree + newNeighbours.size();
+            }
+            onInsert(source, destination, std::get<2>(edge));
+            newNeighbours.emplace_back(destination, std::get<2>(edge));
+        }
+
+        if (!duplicates.empty())
+            mergeDuplicates(source, duplicates, onDuplicate);
+        appendNeighbours(source, newNeighbours);
+    }
+}
+
+template <typename EdgeLabel, typename Storage>
+template <typename OnDuplicate>
+void LabeledDirectedGraph<EdgeLabel, Storage>::mergeDuplicates(
+    VertexIndex vertex,
+    std::vector<std::tuple<size_t, VertexIndex, EdgeLabel>> &duplicates,
+    OnDuplicate onDuplicate
+) {
+    if (!isLabeled()) {
+        EdgeLabel label;
+        for (const auto &duplicate : duplicates)
+            onDuplicate(
+                vertex, std::get<1>(duplicate), label, std::get<2>(duplicate)
+            );
+        return;
+    }
+
+    std::stable_sort(
+        duplicates.begin(), duplicates.end(),
+        [](const std::tuple<size_t, VertexIndex, EdgeLabel> &duplicate1,
+           const std::tuple<size_t, VertexIndex, EdgeLabel> &duplicate2) {
+            return std::get<0>(duplicate1) < std::get<0>(duplicate2);
+        }
+    );
+    auto label = adjacencyLabels[vertex].begin();
+    size_t position = 0;
+    for (const auto &duplicate : duplicates) {
+        std::advance(label, std::get<0>(duplicate) - position);
+        position = std::get<0>(duplicate);
+        VertexIndex neighbour = std::get<1>(duplicate);
+        edgeHashSum -= getEdgeHash(vertex, neighbour, *label);
+        onDuplicate(vertex, neighbour, *label, std::get<2>(duplicate));
+        edgeHashSum += getEdgeHash(vertex, neighbour, *label);
+    }
+}
+
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::appendNeighbours(
+    VertexIndex vertex,
+    std::vector<std::pair<VertexIndex, EdgeLabel>> &newNeighbours
+) {
+    for (const auto &neighbour : newNeighbours) {
+        if (inNeighboursTracked)
+            insertVertex(inAdjacencyList[neighbour.first], vertex);
+        edgeHashSum += getEdgeHash(vertex, neighbour.first, neighbour.second);
+    }
+
+    if (Storage::isSorted)
+        std::stable_sort(
+            newNeighbours.begin(), newNeighbours.end(),
+            [](const std::pair<VertexIndex, EdgeLabel> &neighbour1,
+               const std::pair<VertexIndex, EdgeLabel> &neighbour2) {
+                return neighbour1.first < neighbour2.first;
+            }
+        );
+
+    auto &neighbours = adjacencyList[vertex];
+    if (!Storage::isSorted || neighbours.empty()) {
+        for (auto &neighbour : newNeighbours) {
+            neighbours.push_back(neighbour.first);
+            if (isLabeled())
+                adjacencyLabels[vertex].push_back(std::move(neighbour.second));
+        }
+        return;
+    }
+
+    // New neighbours are placed after the equal current neighbours, as in
+    // insertNeighbour. The merged containers keep the allocators of the
+    // containers they replace.
+    Successors mergedNeighbours(neighbours.get_allocator());
+    EdgeLabels mergedLabels(
+        isLabeled() ? adjacencyLabels[vertex].get_allocator()
+                    : typename EdgeLabels::allocator_type()
+    );
+    auto newNeighbour = newNeighbours.begin();
+    auto appendNewNeighbour = [&]() {
+        mergedNeighbours.push_back(newNeighbour->first);
+        if (isLabeled())
+            mergedLabels.push_back(std::move(newNeighbour->second));
+        ++newNeighbour;
+    };
+    forEachOutEdge(vertex, [&](VertexIndex neighbour, const EdgeLabel &label) {
+        while (newNeighbour != newNeighbours.end() &&
+               newNeighbour->first < neighbour)
+            appendNewNeighbour();
+        mergedNeighbours.push_back(neighbour);
+        if (isLabeled())
+            mergedLabels.push_back(label);
+    });
+    while (newNeighbour != newNeighbours.end())
+        appendNewNeighbour();
+
+    neighbours.swap(mergedNeighbours);
+    if (isLabeled())
+        adjacencyLabels[vertex].swap(mergedLabels);
+}
+
+template <typename EdgeLabel, typename Storage>
+LabeledDirectedGraph<EdgeLabel, Storage>
+LabeledDirectedGraph<EdgeLabel, Storage>::getPermutedGraph(
+    const std::vector<VertexIndex> &newIndices
+) const {
+    std::vector<VertexIndex> oldIndices =
+        getInversePermutation(newIndices, size);
+
+    LabeledDirectedGraph permutedGraph(size);
+    std::vector<std::pair<VertexIndex, EdgeLabel>> newNeighbours;
+    for (VertexIndex i = 0; i < size; ++i) {
+        newNeighbours.clear();
+        forEachOutEdge(
+            oldIndices[i],
+            [&](VertexIndex j, const EdgeLabel &label) {
+                newNeighbours.emplace_back(newIndices[j], label);
+            }
+        );
+        permutedGraph.appendNeighbours(i, newNeighbours);
+    }
+    permutedGraph.edgeNumber = edgeNumber;
+    permutedGraph.trackInNeighbours(inNeighboursTracked);
+    permutedGraph.vertexProperties = vertexProperties.getSelected(oldIndices);
+    return permutedGraph;
+}
+
+template <typename EdgeLabel, typename Storage>
+bool LabeledDirectedGraph<EdgeLabel, Storage>::operator==(
+    const LabeledDirectedGraph<EdgeLabel, Storage> &other
+) const {
+
+    bool isEqual = size == other.size && edgeNumber == other.edgeNumber &&
+                   edgeHashSum == other.edgeHashSum;
+
+    if (!isEqual)
+        return false;
+
+    // Sorted neighbours are equal only if they contain the same vertices. The
+    // labels of parallel edges are stored in insertion order, so they are
+    // compared as multisets.
+    if (Storage::isSorted) {
+        if (!(adjacencyList == other.adjacencyList))
+            return false;
+        if (!isLabeled())
+            return true;
+
+        for (VertexIndex i = 0; i < size; ++i) {
+            const Successors &neighbours = adjacencyList[i];
+            auto labels = adjacencyLabels[i].begin();
+            auto otherLabels = other.adjacencyLabels[i].begin();
+            for (auto run = neighbours.begin(); run != neighbours.end();) {
+                auto runEnd = std::upper_bound(run, neighbours.end(), *run);
+                auto runLength = std::distance(run, runEnd);
+                auto labelsEnd = std::next(labels, runLength);
+                if (!std::is_permutation(labels, labelsEnd, otherLabels))
+                    return false;
+                labels = labelsEnd;
+                std::advance(otherLabels, runLength);
+                run = runEnd;
+            }
         }
+        return true;
     }
+
+    // Each edge of a graph must be found in the other one. Parallel edges can
+    // carry different labels, so each edge of the other graph maps to the
+    // number of its parallel edges with each label that remain unmatched.
+    typedef std::vector<std::pair<EdgeLabel, size_t>> LabelCounts;
+    FlatEdgeMap<LabelCounts> otherEdges(other.edgeNumber);
+    for (VertexIndex i = 0; i < size; ++i)
+        other.forEachOutEdge(i, [&](VertexIndex j, const EdgeLabel &label) {
+            LabelCounts &counts = otherEdges[{i, j}];
+            auto count = findLabelCount(counts, label);
+            if (count == counts.end())
+                counts.emplace_back(label, 1);
+            else
+                ++count->second;
+        });
+
+    for (VertexIndex i = 0; i < size && isEqual; ++i)
+        forEachOutEdge(i, [&](VertexIndex j, const EdgeLabel &label) {
+            LabelCounts *counts = otherEdges.find({i, j});
+            if (!isEqual || counts == nullptr) {
+                isEqual = false;
+                return;
+            }
+            auto count = findLabelCount(*counts, label);
+            if (count == counts->end() || count->second == 0)
+                isEqual = false;
+            else
+                --count->second;
+        });
+
+    // Both graphs have the same number of edges, so every edge of the other
+    // graph was matched.
     return isEqual;
 }
 
-template <typename EdgeLabel>
-void LabeledDirectedGraph<EdgeLabel>::addEdge(
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::addEdge(
     VertexIndex source, VertexIndex destination, const EdgeLabel &label,
     bool force
 ) {
     if (force || !hasEdge(source, destination)) {
-        adjacencyList[source].push_back(destination);
+        edgeHashSum += insertNeighbour(source, destination, label);
         ++edgeNumber;
-        _setLabel({source, destination}, label);
     }
 }
 
-template <typename EdgeLabel>
-bool LabeledDirectedGraph<EdgeLabel>::hasEdge(
+template <typename EdgeLabel, typename Storage>
+bool LabeledDirectedGraph<EdgeLabel, Storage>::hasEdge(
     VertexIndex source, VertexIndex destination
 ) const {
     assertVertexInRange(source);
     assertVertexInRange(destination);
 
-    const auto &outEdges = getOutNeighbours(source);
-    return find(outEdges.begin(), outEdges.end(), destination) !=
-           outEdges.end();
+    return containsNeighbour(adjacencyList[source], destination);
 }
 
-template <typename EdgeLabel>
-void LabeledDirectedGraph<EdgeLabel>::setEdgeLabel(
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::setEdgeLabel(
     VertexIndex source, VertexIndex destination, const EdgeLabel &label,
     bool force
 ) {
     assertVertexInRange(source);
     assertVertexInRange(destination);
 
-    if (!force && !hasEdge(source, destination))
+    size_t edges = visitLabels(
+        source, destination, [&](EdgeLabel &current) { current = label; }
+    );
+    if (edges == 0 && !force)
         throw std::invalid_argument("Cannot set label of inexistent edge.");
-    _setLabel({source, destination}, label);
 }
 
-template <typename EdgeLabel>
-void LabeledDirectedGraph<EdgeLabel>::removeEdge(
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::removeEdge(
     VertexIndex source, VertexIndex destination
 ) {
     assertVertexInRange(source);
     assertVertexInRange(destination);
 
-    size_t sizeBefore = adjacencyList[source].size();
-    adjacencyList[source].remove(destination);
-    edgeNumber -= sizeBefore - adjacencyList[source].size();
-
-    edgeLabels.erase({source, destination});
+    edgeNumber -= eraseNeighbour(source, destination);
 }
 
-template <typename EdgeLabel>
-void LabeledDirectedGraph<EdgeLabel>::removeDuplicateEdges() {
-
-    for (VertexIndex i : *this) {
-        std::set<VertexIndex> seenVertices;
-        auto j = adjacencyList[i].begin();
-
-        while (j != adjacencyList[i].end()) {
-            if (!seenVertices.count(*j)) {
-                seenVertices.insert(*j);
-                ++j;
-            } else {
-                adjacencyList[i].erase(j++);
-                edgeNumber--;
-            }
-        }
-        seenVertices.clear();
-    }
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::removeDuplicateEdges() {
+    edgeNumber -= eraseDuplicateEdges();
 }
 
-template <typename EdgeLabel>
-void LabeledDirectedGraph<EdgeLabel>::removeVertexFromEdgeList(
+template <typename EdgeLabel, typename Storage>
+void LabeledDirectedGraph<EdgeLabel, Storage>::removeVertexFromEdgeList(
     VertexIndex vertex
 ) {
     assertVertexInRange(vertex);
 
-    auto &successors = adjacencyList[vertex];
-    auto j = successors.begin();
-    while (j != successors.end()) {
-        successors.erase(j++);
-        edgeNumber--;
-    }
-
-    for (VertexIndex i = 0; i < size; ++i)
-        removeEdge(i, vertex);
+    edgeNumber -= eraseOutEdges(vertex);
+    edgeNumber -= eraseInEdges(vertex);
 }
 
 } // namespace BaseGraph
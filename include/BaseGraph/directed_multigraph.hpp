@@ -12,25 +12,49 @@ namespace BaseGraph {
  * Behaves nearly identically to @ref BaseGraph::DirectedGraph. The main
  * difference is that @ref addEdge and @ref removeEdge count parallel edges
  * (multiedges). The number of parallel edges is stored in a @ref
- * BaseGraph::EdgeMultiplicity.
+ * BaseGraph::EdgeMultiplicity, next to the neighbour it applies to. The
+ * total multiplicity of the out and in edges of each vertex is maintained, so
+ * that degrees are obtained in constant time.
+ *
+ * @tparam Storage Policy that chooses the container of the neighbours of each
+ * vertex. See @ref BaseGraph::LabeledDirectedGraph.
  */
-class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
-    using BaseClass = LabeledDirectedGraph<EdgeMultiplicity>;
+template <typename Storage = ListStorage>
+class BasicDirectedMultigraph
+    : private LabeledDirectedGraph<EdgeMultiplicity, Storage> {
+    using BaseClass = LabeledDirectedGraph<EdgeMultiplicity, Storage>;
+    using BaseClass::adjacencyLabels;
+    using BaseClass::adjacencyList;
+    using BaseClass::edgeNumber;
+    using BaseClass::size;
+    using BaseClass::assertVertexInRange;
+    using BaseClass::getEdgeLabel;
     size_t totalEdgeNumber = 0;
+    std::vector<size_t> outDegrees;
+    std::vector<size_t> inDegrees;
 
   public:
+    using typename BaseClass::Successors;
+    /// Contains the multiplicities of the out edges of a vertex.
+    typedef typename BaseClass::EdgeLabels EdgeMultiplicities;
+
     /// Returns the edge number excluding parallel edges (any multiplicity
     /// counts as a single edge).
     using BaseClass::begin;
     using BaseClass::edges;
     using BaseClass::end;
     using BaseClass::getEdgeNumber;
+    using BaseClass::getFingerprint;
+    using BaseClass::getInNeighbours;
     using BaseClass::getOutNeighbours;
     using BaseClass::getSize;
-    using BaseClass::resize;
+    using BaseClass::getVertexProperties;
+    using BaseClass::isTrackingInNeighbours;
+    using BaseClass::trackInNeighbours;
 
     /// Constructs an empty graph with \p size vertices.
-    explicit DirectedMultigraph(size_t size = 0) : BaseClass(size) {}
+    explicit BasicDirectedMultigraph(size_t size = 0)
+        : BaseClass(size), outDegrees(size, 0), inDegrees(size, 0) {}
 
     /**
      * Constructs graph containing every vertex in \p multiedgeList. Graph size
@@ -51,21 +75,39 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
      * \endcode
      */
     template <template <class...> class Container, class... Args>
-    explicit DirectedMultigraph(
+    explicit BasicDirectedMultigraph(
         const Container<LabeledEdge<EdgeMultiplicity>, Args...> &multiedgeList
     )
         : BaseClass(0) {
+        addEdges(multiedgeList);
+    }
 
-        VertexIndex maxIndex = 0;
-        for (const auto &multiedge : multiedgeList) {
-            maxIndex = std::max(std::get<0>(multiedge), std::get<1>(multiedge));
-            if (maxIndex >= getSize())
-                resize(maxIndex + 1);
-            addMultiedge(
-                std::get<0>(multiedge), std::get<1>(multiedge),
-                std::get<2>(multiedge)
-            );
-        }
+    /// @copydoc LabeledDirectedGraph::resize
+    void resize(size_t newSize) {
+        BaseClass::resize(newSize);
+        outDegrees.resize(newSize, 0);
+        inDegrees.resize(newSize, 0);
+    }
+
+    /// @copydoc LabeledDirectedGraph::reserve
+    void reserve(size_t vertexCapacity, size_t edgeCapacity = 0) {
+        BaseClass::reserve(vertexCapacity, edgeCapacity);
+        outDegrees.reserve(vertexCapacity);
+        inDegrees.reserve(vertexCapacity);
+    }
+    /// @copydoc LabeledDirectedGraph::shrinkToFit
+    void shrinkToFit() {
+        BaseClass::shrinkToFit();
+        outDegrees.shrink_to_fit();
+        inDegrees.shrink_to_fit();
+    }
+    /// @copydoc LabeledDirectedGraph::getMemoryUsage
+    MemoryUsage getMemoryUsage() const {
+        MemoryUsage usage = BaseClass::getMemoryUsage();
+        usage.bookkeeping += sizeof(*this) - sizeof(BaseClass) +
+                             outDegrees.capacity() * sizeof(size_t) +
+                             inDegrees.capacity() * sizeof(size_t);
+        return usage;
     }
 
     /// Returns the edge number including parallel edges.
@@ -73,11 +115,11 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
 
     /// Returns if graph instance and \p other have the same size, edges and
     /// edge multiplicities.
-    bool operator==(const DirectedMultigraph &other) const {
+    bool operator==(const BasicDirectedMultigraph &other) const {
         return BaseClass::operator==(other);
     }
     /// Returns `not` @ref operator==.
-    bool operator!=(const DirectedMultigraph &other) const {
+    bool operator!=(const BasicDirectedMultigraph &other) const {
         return BaseClass::operator!=(other);
     }
 
@@ -104,7 +146,8 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
      * unexpectedly in some algorithms. Remove duplicate edges with
      * @ref removeDuplicateEdges. Note that
      * @ref removeDuplicateEdges does not merge duplicate edges,
-     * it only removes them. <b>Duplicate edges are not multiedges</b>.
+     * it only removes them. Use @ref mergeDuplicateEdges to sum their
+     * multiplicities. <b>Duplicate edges are not multiedges</b>.
      *
      * @param source, destination Index of the source and destination vertices.
      * @param multiplicity Edge multiplicity.
@@ -122,15 +165,63 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
         if (multiplicity == 0)
             return;
 
-        auto edgeExists = hasEdge(source, destination);
-        if (force || !edgeExists) {
+        EdgeMultiplicity *currentMultiplicity =
+            force ? nullptr : BaseClass::findLabel(source, destination);
+        if (currentMultiplicity == nullptr)
             BaseClass::addEdge(source, destination, multiplicity, true);
-            totalEdgeNumber += multiplicity;
-        } else if (edgeExists) {
-            totalEdgeNumber += multiplicity;
-            BaseClass::edgeLabels[{source, destination}] += multiplicity;
-        }
+        else
+            BaseClass::replaceLabel(
+                source, destination, *currentMultiplicity,
+                *currentMultiplicity + multiplicity
+            );
+        addToDegrees(source, destination, multiplicity);
+    }
+    /**
+     * Adds each multiedge of \p edgeSequence as @ref addMultiedge would, and
+     * adjusts the graph size to the largest index in \p edgeSequence. The
+     * multiplicities of repeated edges are summed. See @ref
+     * LabeledDirectedGraph::addEdges for the complexity.
+     *
+     * @tparam Container Any container of @ref BaseGraph::Edge (of
+     * multiplicity 1) or of
+     * BaseGraph::LabeledEdge<BaseGraph::EdgeMultiplicity> that supports
+     * range-based loops.
+     * @param edgeSequence Multiedges to add.
+     * @param force If \c false, the multiplicity of an edge that already
+     * exists (in the graph or earlier in \p edgeSequence) is increased. If
+     * \c true, every multiedge is added as a new edge.
+     */
+    template <typename Container>
+    void addEdges(const Container &edgeSequence, bool force = false) {
+        size_t requiredSize = size;
+        auto newEdges =
+            BaseClass::gatherEdges(edgeSequence, false, requiredSize, 1);
+        if (requiredSize > size)
+            resize(requiredSize);
+        newEdges.erase(
+            std::remove_if(
+                newEdges.begin(), newEdges.end(),
+                [](const LabeledEdge<EdgeMultiplicity> &edge) {
+                    return std::get<2>(edge) == 0;
+                }
+            ),
+            newEdges.end()
+        );
+        BaseClass::insertEdges(
+            newEdges, force,
+            [&](VertexIndex source, VertexIndex destination,
+                EdgeMultiplicity multiplicity) {
+                ++edgeNumber;
+                addToDegrees(source, destination, multiplicity);
+            },
+            [&](VertexIndex source, VertexIndex destination,
+                EdgeMultiplicity &stored, EdgeMultiplicity multiplicity) {
+                stored += multiplicity;
+                addToDegrees(source, destination, multiplicity);
+            }
+        );
     }
+
     /// Adds reciprocal edges. Calls @ref addMultiedge for both edge
     /// orientations.
     void addReciprocalMultiedge(
@@ -161,22 +252,21 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
         assertVertexInRange(source);
         assertVertexInRange(destination);
 
-        const auto &neighbours = getOutNeighbours(source);
-        for (auto j = neighbours.begin(); j != neighbours.end(); ++j) {
-            if (*j != destination)
-                continue;
-
-            auto &currentMultiplicity = edgeLabels[{source, destination}];
-            if (currentMultiplicity > multiplicity) {
-                currentMultiplicity -= multiplicity;
-                totalEdgeNumber -= multiplicity;
-            } else {
-                edgeNumber--;
-                totalEdgeNumber -= currentMultiplicity;
-                adjacencyList[source].erase(j);
-                edgeLabels.erase({source, destination});
-            }
-            break;
+        EdgeMultiplicity *currentMultiplicity =
+            BaseClass::findLabel(source, destination);
+        if (currentMultiplicity == nullptr)
+            return;
+
+        if (*currentMultiplicity > multiplicity) {
+            BaseClass::replaceLabel(
+                source, destination, *currentMultiplicity,
+                *currentMultiplicity - multiplicity
+            );
+            subtractFromDegrees(source, destination, multiplicity);
+        } else {
+            edgeNumber--;
+            subtractFromDegrees(source, destination, *currentMultiplicity);
+            BaseClass::eraseFirstNeighbour(source, destination);
         }
     }
 
@@ -193,9 +283,15 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
         assertVertexInRange(source);
         assertVertexInRange(destination);
 
-        return edgeLabels.count({source, destination}) == 0
-                   ? 0
-                   : getEdgeLabel(source, destination);
+        const EdgeMultiplicity *multiplicity =
+            BaseClass::findLabel(source, destination);
+        return multiplicity == nullptr ? 0 : *multiplicity;
+    }
+    /// Returns the multiplicities of the out edges of \p vertex, in the same
+    /// order as @ref getOutNeighbours.
+    const EdgeMultiplicities &getOutEdgeMultiplicities(VertexIndex vertex
+    ) const {
+        return BaseClass::getOutEdgeLabels(vertex);
     }
     /**
      * Change the multiplicity of the edge connecting \p source to \p
@@ -214,12 +310,23 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
 
         if (multiplicity == 0) {
             removeAllEdges(source, destination);
-        } else if (hasEdge(source, destination)) {
-            auto &currentMultiplicity = edgeLabels[{source, destination}];
-            totalEdgeNumber +=
-                ((long long int)multiplicity -
-                 (long long int)currentMultiplicity);
-            currentMultiplicity = multiplicity;
+            return;
+        }
+
+        EdgeMultiplicity *currentMultiplicity =
+            BaseClass::findLabel(source, destination);
+        if (currentMultiplicity != nullptr) {
+            if (multiplicity > *currentMultiplicity)
+                addToDegrees(
+                    source, destination, multiplicity - *currentMultiplicity
+                );
+            else
+                subtractFromDegrees(
+                    source, destination, *currentMultiplicity - multiplicity
+                );
+            BaseClass::replaceLabel(
+                source, destination, *currentMultiplicity, multiplicity
+            );
         } else {
             addMultiedge(source, destination, multiplicity, true);
         }
@@ -227,28 +334,29 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
 
     /**
      * Removes duplicate edges that have been created using the flag
-     * `force=true` in @ref addMultiedge.
+     * `force=true` in @ref addMultiedge, in \f$O(V+E)\f$.
      *
      * \warning
-     * The duplicate edges are <b>not</b> merged, meaning that the edge
-     * multiplicities are not changed by this method.
+     * The duplicate edges are <b>not</b> merged: the multiplicity of the
+     * first edge is kept and the others are lost. Use @ref
+     * mergeDuplicateEdges to keep the total multiplicity.
      */
     void removeDuplicateEdges() {
-        for (VertexIndex i : *this) {
-            std::set<VertexIndex> seenVertices;
-            auto j = adjacencyList[i].begin();
-
-            while (j != adjacencyList[i].end()) {
-                if (!seenVertices.count(*j)) {
-                    seenVertices.insert(*j);
-                    ++j;
-                } else {
-                    totalEdgeNumber -= getEdgeLabel(i, *j, false);
-                    adjacencyList[i].erase(j++);
-                    edgeNumber--;
-                }
+        edgeNumber -= BaseClass::eraseDuplicateEdges(
+            [&](VertexIndex i, VertexIndex j, EdgeMultiplicity &,
+                EdgeMultiplicity multiplicity) {
+                subtractFromDegrees(i, j, multiplicity);
             }
-        }
+        );
+    }
+    /// Replaces the duplicate edges that have been created using the flag
+    /// `force=true` in @ref addMultiedge by a single edge whose multiplicity
+    /// is their sum, in \f$O(V+E)\f$.
+    void mergeDuplicateEdges() {
+        edgeNumber -= BaseClass::eraseDuplicateEdges(
+            [](VertexIndex, VertexIndex, EdgeMultiplicity &stored,
+               EdgeMultiplicity multiplicity) { stored += multiplicity; }
+        );
     }
 
     /// @copydoc LabeledDirectedGraph::removeSelfLoops
@@ -261,23 +369,43 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
     void removeVertexFromEdgeList(VertexIndex vertex) {
         assertVertexInRange(vertex);
 
-        auto &successors = adjacencyList[vertex];
-        auto j = successors.begin();
-        while (j != successors.end()) {
-            totalEdgeNumber -= getEdgeLabel(vertex, *j, false);
-            successors.erase(j++);
-            edgeNumber--;
-        }
-        for (VertexIndex i = 0; i < size; ++i)
-            removeAllEdges(i, vertex);
+        edgeNumber -= BaseClass::eraseOutEdges(
+            vertex,
+            [&](VertexIndex destination, EdgeMultiplicity multiplicity) {
+                subtractFromDegrees(vertex, destination, multiplicity);
+            }
+        );
+        edgeNumber -= BaseClass::eraseInEdges(
+            vertex,
+            [&](VertexIndex source, EdgeMultiplicity multiplicity) {
+                subtractFromDegrees(source, vertex, multiplicity);
+            }
+        );
+    }
+
+    /// @copydoc LabeledDirectedGraph::removeVertices
+    std::vector<VertexIndex>
+    removeVertices(const std::vector<VertexIndex> &vertices) {
+        std::vector<VertexIndex> newIndices =
+            getIndicesAfterRemoval(vertices, size);
+        edgeNumber -= BaseClass::compactVertices(
+            newIndices,
+            [&](VertexIndex source, VertexIndex destination,
+                EdgeMultiplicity multiplicity) {
+                subtractFromDegrees(source, destination, multiplicity);
+            }
+        );
+        applyIndicesAfterRemoval(outDegrees, newIndices);
+        applyIndicesAfterRemoval(inDegrees, newIndices);
+        return newIndices;
     }
 
     /// @copydoc LabeledDirectedGraph::clearEdges
     void clearEdges() {
-        for (VertexIndex i : *this)
-            adjacencyList[i].clear();
-        edgeNumber = 0;
+        BaseClass::clearEdges();
         totalEdgeNumber = 0;
+        std::fill(outDegrees.begin(), outDegrees.end(), 0);
+        std::fill(inDegrees.begin(), inDegrees.end(), 0);
     }
 
     /// Casts the multigraph to a labeled graph, thus ignoring edge
@@ -286,6 +414,22 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
         return static_cast<const BaseClass &>(*this);
     }
 
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    BasicDirectedMultigraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        BasicDirectedMultigraph permutedGraph;
+        static_cast<BaseClass &>(permutedGraph) =
+            BaseClass::getPermutedGraph(newIndices);
+        permutedGraph.totalEdgeNumber = totalEdgeNumber;
+        permutedGraph.outDegrees.resize(size);
+        permutedGraph.inDegrees.resize(size);
+        for (VertexIndex i = 0; i < size; ++i) {
+            permutedGraph.outDegrees[newIndices[i]] = outDegrees[i];
+            permutedGraph.inDegrees[newIndices[i]] = inDegrees[i];
+        }
+        return permutedGraph;
+    }
+
     /// Constructs the adjacency matrix. The element \f$a_{ij}\f$ of the matrix
     /// is the multiplicity of edge \f$(i,j)\f$.
     AdjacencyMatrix getAdjacencyMatrix() const {
@@ -293,62 +437,64 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
         adjacencyMatrix.resize(size, std::vector<size_t>(size, 0));
 
         for (VertexIndex i = 0; i < size; ++i)
-            for (auto &j : getOutNeighbours(i))
-                adjacencyMatrix[i][j] += getEdgeMultiplicity(i, j);
+            BaseClass::forEachOutEdge(
+                i,
+                [&](VertexIndex j, EdgeMultiplicity multiplicity) {
+                    adjacencyMatrix[i][j] += multiplicity;
+                }
+            );
 
         return adjacencyMatrix;
     }
 
-    /// Counts the number of out edges of \p vertex, including parallel edges.
+    /// Constructs the adjacency matrix in compressed sparse form in
+    /// \f$O(V+E)\f$. The element \f$a_{ij}\f$ of the matrix is the
+    /// multiplicity of edge \f$(i,j)\f$.
+    SparseMatrix<size_t> getSparseAdjacency(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        for (VertexIndex i = 0; i < size; ++i)
+            BaseClass::forEachOutEdge(
+                i,
+                [&](VertexIndex j, EdgeMultiplicity multiplicity) {
+                    triplets.addEntry(i, j, multiplicity);
+                }
+            );
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// Returns the number of out edges of \p vertex, including parallel edges.
     size_t getOutDegree(VertexIndex vertex) const {
         assertVertexInRange(vertex);
-        size_t degree = 0;
-        for (auto neighbour : adjacencyList[vertex])
-            degree += getEdgeMultiplicity(vertex, neighbour);
-        return degree;
+        return outDegrees[vertex];
     }
 
-    /// Counts the number of out edges of each vertex, including parallel edges.
-    std::vector<size_t> getOutDegrees() const {
-        std::vector<size_t> degrees(getSize(), 0);
-        for (auto edge : edges())
-            degrees[edge.first] += getEdgeMultiplicity(edge.first, edge.second);
-        return degrees;
-    }
+    /// Returns the number of out edges of each vertex, including parallel
+    /// edges.
+    const std::vector<size_t> &getOutDegrees() const { return outDegrees; }
 
-    /// Counts the number of in edges of \p vertex, including parallel edges.
-    /// @ref getInDegrees is more efficient when more than one
-    /// in degree is needed.
+    /// Returns the number of in edges of \p vertex, including parallel edges.
     size_t getInDegree(VertexIndex vertex) const {
         assertVertexInRange(vertex);
-        size_t degree = 0;
-
-        for (auto edge : edges())
-            if (edge.second == vertex)
-                degree += getEdgeLabel(edge.first, edge.second);
-        return degree;
+        return inDegrees[vertex];
     }
 
-    /// Counts the number of in edges of each vertex, including parallel edges.
-    std::vector<size_t> getInDegrees() const {
-        std::vector<size_t> inDegrees(getSize(), 0);
-
-        for (auto edge : edges())
-            inDegrees[edge.second] += getEdgeLabel(edge.first, edge.second);
-        return inDegrees;
-    }
+    /// Returns the number of in edges of each vertex, including parallel
+    /// edges.
+    const std::vector<size_t> &getInDegrees() const { return inDegrees; }
 
     /// @copydoc LabeledDirectedGraph::operator<<
     friend std::ostream &
-    operator<<(std::ostream &stream, const DirectedMultigraph &graph) {
+    operator<<(std::ostream &stream, const BasicDirectedMultigraph &graph) {
         stream << "DirectedMultigraph of size: " << graph.getSize() << "\n"
                << "Neighbours of:\n";
 
         for (VertexIndex i : graph) {
             stream << i << ": ";
+            auto multiplicity = graph.getOutEdgeMultiplicities(i).begin();
             for (auto &neighbour : graph.getOutNeighbours(i))
-                stream << neighbour << "("
-                       << graph.getEdgeMultiplicity(i, neighbour) << "), ";
+                stream << neighbour << "(" << *multiplicity++ << "), ";
             stream << "\n";
         }
         return stream;
@@ -359,15 +505,38 @@ class DirectedMultigraph : private LabeledDirectedGraph<EdgeMultiplicity> {
         assertVertexInRange(source);
         assertVertexInRange(destination);
 
-        size_t sizeBefore = adjacencyList[source].size();
-        adjacencyList[source].remove(destination);
-        size_t sizeAfter = sizeBefore - adjacencyList[source].size();
+        edgeNumber -= BaseClass::eraseNeighbour(
+            source, destination,
+            [&](VertexIndex, EdgeMultiplicity multiplicity) {
+                subtractFromDegrees(source, destination, multiplicity);
+            }
+        );
+    }
+
+    /// Counts \p multiplicity more edges from \p source to \p destination.
+    void addToDegrees(
+        VertexIndex source, VertexIndex destination,
+        EdgeMultiplicity multiplicity
+    ) {
+        outDegrees[source] += multiplicity;
+        inDegrees[destination] += multiplicity;
+        totalEdgeNumber += multiplicity;
+    }
 
-        edgeNumber -= sizeAfter;
-        totalEdgeNumber -= getEdgeLabel(source, destination, false) * sizeAfter;
-        edgeLabels.erase({source, destination});
+    /// Counts \p multiplicity less edges from \p source to \p destination.
+    void subtractFromDegrees(
+        VertexIndex source, VertexIndex destination,
+        EdgeMultiplicity multiplicity
+    ) {
+        outDegrees[source] -= multiplicity;
+        inDegrees[destination] -= multiplicity;
+        totalEdgeNumber -= multiplicity;
     }
 };
+
+/// Directed multigraph with the default storage.
+using DirectedMultigraph = BasicDirectedMultigraph<>;
+
 } // namespace BaseGraph
 
 #endif
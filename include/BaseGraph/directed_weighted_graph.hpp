@@ -12,19 +12,40 @@ namespace BaseGraph {
  * Behaves nearly identically to @ref BaseGraph::LabeledDirectedGraph. The
  * difference is that each edge must have a weight stored in a @ref
  * EdgeMultiplicity.
+ *
+ * @tparam Storage Policy that chooses the container of the neighbours of each
+ * vertex. See @ref BaseGraph::LabeledDirectedGraph.
  */
-class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
-    using BaseClass = LabeledDirectedGraph<double>;
+template <typename Storage = ListStorage>
+class BasicDirectedWeightedGraph
+    : private LabeledDirectedGraph<EdgeWeight, Storage> {
+    using BaseClass = LabeledDirectedGraph<EdgeWeight, Storage>;
+    using BaseClass::adjacencyLabels;
+    using BaseClass::adjacencyList;
+    using BaseClass::edgeHashSum;
+    using BaseClass::edgeNumber;
+    using BaseClass::size;
+    using BaseClass::assertVertexInRange;
+    using BaseClass::getEdgeLabel;
     long double totalWeight = 0;
 
   public:
+    using typename BaseClass::Successors;
+    /// Contains the weights of the out edges of a vertex.
+    typedef typename BaseClass::EdgeLabels EdgeWeights;
     using BaseClass::begin;
     using BaseClass::edges;
     using BaseClass::end;
     using BaseClass::getAdjacencyMatrix;
+    using BaseClass::getSparseAdjacency;
     using BaseClass::getEdgeNumber;
+    using BaseClass::getFingerprint;
+    using BaseClass::getMemoryUsage;
+    using BaseClass::reserve;
+    using BaseClass::shrinkToFit;
     using BaseClass::getOutNeighbours;
     using BaseClass::getSize;
+    using BaseClass::getVertexProperties;
     using BaseClass::resize;
     /// @copydoc LabeledDirectedGraph::getInDegree
     /// Doesn't consider the edge weights.
@@ -38,10 +59,13 @@ class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
     /// @copydoc LabeledDirectedGraph::getOutDegrees
     /// Doesn't consider the edge weights.
     using BaseClass::getOutDegrees;
+    using BaseClass::getInNeighbours;
     using BaseClass::hasEdge;
+    using BaseClass::isTrackingInNeighbours;
+    using BaseClass::trackInNeighbours;
 
     /// Constructs an empty graph with \p size vertices.
-    explicit DirectedWeightedGraph(size_t size = 0) : BaseClass(size) {}
+    explicit BasicDirectedWeightedGraph(size_t size = 0) : BaseClass(size) {}
 
     /**
      * Constructs a graph containing each edge in \p edgeSequence. The graph
@@ -60,21 +84,11 @@ class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
      * \endcode
      */
     template <template <class...> class Container, class... Args>
-    explicit DirectedWeightedGraph(
+    explicit BasicDirectedWeightedGraph(
         const Container<LabeledEdge<EdgeWeight>, Args...> &weightedEdgeList
     )
         : BaseClass(0) {
-
-        VertexIndex maxIndex = 0;
-        for (const auto &multiedge : weightedEdgeList) {
-            maxIndex = std::max(std::get<0>(multiedge), std::get<1>(multiedge));
-            if (maxIndex >= getSize())
-                resize(maxIndex + 1);
-            addMultiedge(
-                std::get<0>(multiedge), std::get<1>(multiedge),
-                std::get<2>(multiedge)
-            );
-        }
+        addEdges(weightedEdgeList);
     }
 
     /**
@@ -87,11 +101,11 @@ class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
 
     /// Returns if graph instance and \p other have the same size, edges and
     /// edge weights.
-    bool operator==(const DirectedWeightedGraph &other) const {
+    bool operator==(const BasicDirectedWeightedGraph &other) const {
         return BaseClass::operator==(other);
     }
     /// Returns `not` @ref operator==.
-    bool operator!=(const DirectedWeightedGraph &other) const {
+    bool operator!=(const BasicDirectedWeightedGraph &other) const {
         return BaseClass::operator!=(other);
     }
 
@@ -115,18 +129,37 @@ class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
         bool force = false
     ) {
         if (force || !hasEdge(source, destination)) {
-            adjacencyList[source].push_back(destination);
+            edgeHashSum +=
+                BaseClass::insertNeighbour(source, destination, weight);
             ++edgeNumber;
-            _setLabel({source, destination}, weight);
             totalWeight += weight;
         }
     }
     /// @copydoc LabeledDirectedGraph::addReciprocalEdge
     void addReciprocalEdge(
-        VertexIndex source, VertexIndex destination, bool force = false
+        VertexIndex source, VertexIndex destination, EdgeWeight weight,
+        bool force = false
     ) {
-        addEdge(source, destination, force);
-        addEdge(destination, source, force);
+        addEdge(source, destination, weight, force);
+        addEdge(destination, source, weight, force);
+    }
+
+    /// @copydoc LabeledDirectedGraph::addEdges
+    template <typename Container>
+    void addEdges(const Container &edgeSequence, bool force = false) {
+        size_t requiredSize = size;
+        auto newEdges =
+            BaseClass::gatherEdges(edgeSequence, false, requiredSize);
+        if (requiredSize > size)
+            resize(requiredSize);
+        BaseClass::insertEdges(
+            newEdges, force,
+            [&](VertexIndex, VertexIndex, EdgeWeight weight) {
+                ++edgeNumber;
+                totalWeight += weight;
+            },
+            typename BaseClass::IgnoreDuplicate()
+        );
     }
 
     /// @copydoc LabeledDirectedGraph::removeEdge
@@ -134,13 +167,10 @@ class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
         assertVertexInRange(source);
         assertVertexInRange(destination);
 
-        size_t sizeBefore = adjacencyList[source].size();
-        adjacencyList[source].remove(destination);
-        size_t sizeAfter = sizeBefore - adjacencyList[source].size();
-
-        edgeNumber -= sizeAfter;
-        totalWeight -= getEdgeLabel(source, destination, false) * sizeAfter;
-        edgeLabels.erase({source, destination});
+        edgeNumber -= BaseClass::eraseNeighbour(
+            source, destination,
+            [&](VertexIndex, EdgeWeight weight) { totalWeight -= weight; }
+        );
     }
 
     /// Returns the weight of an edge connnecting \p source to \p destination.
@@ -151,37 +181,37 @@ class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
     ) const {
         return getEdgeLabel(source, destination, throwIfInexistent);
     }
+    /// Returns the weights of the out edges of \p vertex, in the same order as
+    /// @ref getOutNeighbours.
+    const EdgeWeights &getOutEdgeWeights(VertexIndex vertex) const {
+        return BaseClass::getOutEdgeLabels(vertex);
+    }
     /// Changes the weight of the edge connecting \p source to \p destination to
     /// \p newWeight. If the edge doesn't exist, it is created.
     void setEdgeWeight(
         VertexIndex source, VertexIndex destination, EdgeWeight newWeight
     ) {
-        if (hasEdge(source, destination)) {
-            auto &currentWeight = edgeLabels[{source, destination}];
-            totalWeight += newWeight - currentWeight;
-            currentWeight = newWeight;
-        } else {
+        assertVertexInRange(source);
+        assertVertexInRange(destination);
+
+        size_t edges = BaseClass::visitLabels(
+            source, destination,
+            [&](EdgeWeight &currentWeight) {
+                totalWeight += newWeight - currentWeight;
+                currentWeight = newWeight;
+            }
+        );
+        if (edges == 0)
             addEdge(source, destination, newWeight);
-        }
     }
 
     /// @copydoc LabeledDirectedGraph::removeDuplicateEdges
     void removeDuplicateEdges() {
-        for (VertexIndex i : *this) {
-            std::set<VertexIndex> seenVertices;
-            auto j = adjacencyList[i].begin();
-
-            while (j != adjacencyList[i].end()) {
-                if (!seenVertices.count(*j)) {
-                    seenVertices.insert(*j);
-                    ++j;
-                } else {
-                    totalWeight -= getEdgeLabel(i, *j, false);
-                    adjacencyList[i].erase(j++);
-                    edgeNumber--;
-                }
+        edgeNumber -= BaseClass::eraseDuplicateEdges(
+            [&](VertexIndex, VertexIndex, EdgeWeight &, EdgeWeight weight) {
+                totalWeight -= weight;
             }
-        }
+        );
     }
 
     /// @copydoc LabeledDirectedGraph::removeSelfLoops
@@ -200,19 +230,39 @@ class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
         return static_cast<const BaseClass &>(*this);
     }
 
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    BasicDirectedWeightedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        BasicDirectedWeightedGraph permutedGraph;
+        static_cast<BaseClass &>(permutedGraph) =
+            BaseClass::getPermutedGraph(newIndices);
+        permutedGraph.totalWeight = totalWeight;
+        return permutedGraph;
+    }
+
     /// @copydoc LabeledDirectedGraph::removeVertexFromEdgeList
     void removeVertexFromEdgeList(VertexIndex vertex) {
         assertVertexInRange(vertex);
 
-        auto &successors = adjacencyList[vertex];
-        auto j = successors.begin();
-        while (j != successors.end()) {
-            totalWeight -= getEdgeLabel(vertex, *j, false);
-            successors.erase(j++);
-            edgeNumber--;
-        }
-        for (VertexIndex i = 0; i < size; ++i)
-            removeEdge(i, vertex);
+        auto subtractWeight = [&](VertexIndex, EdgeWeight weight) {
+            totalWeight -= weight;
+        };
+        edgeNumber -= BaseClass::eraseOutEdges(vertex, subtractWeight);
+        edgeNumber -= BaseClass::eraseInEdges(vertex, subtractWeight);
+    }
+
+    /// @copydoc LabeledDirectedGraph::removeVertices
+    std::vector<VertexIndex>
+    removeVertices(const std::vector<VertexIndex> &vertices) {
+        std::vector<VertexIndex> newIndices =
+            getIndicesAfterRemoval(vertices, size);
+        edgeNumber -= BaseClass::compactVertices(
+            newIndices,
+            [&](VertexIndex, VertexIndex, EdgeWeight weight) {
+                totalWeight -= weight;
+            }
+        );
+        return newIndices;
     }
 
     /// Constructs a matrix in which the element \f$w_{ij}\f$ is the weight of
@@ -223,29 +273,54 @@ class DirectedWeightedGraph : private LabeledDirectedGraph<EdgeWeight> {
         );
 
         for (VertexIndex i = 0; i < size; ++i)
-            for (auto &j : getOutNeighbours(i))
-                weightMatrix[i][j] = getEdgeWeight(i, j);
+            BaseClass::forEachOutEdge(i, [&](VertexIndex j, EdgeWeight weight) {
+                weightMatrix[i][j] = weight;
+            });
 
         return weightMatrix;
     }
 
+    /**
+     * Constructs the weight matrix in compressed sparse form in
+     * \f$O(V+E)\f$. The element \f$w_{ij}\f$ is the weight of the edge
+     * \f$(i,j)\f$, as in @ref getWeightMatrix.
+     *
+     * @param orientation SparseOrientation::Rows groups the entries by row
+     * (out edges), SparseOrientation::Columns groups them by column (in
+     * edges).
+     */
+    SparseMatrix<EdgeWeight> getSparseWeights(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<EdgeWeight> triplets;
+        triplets.reserve(edgeNumber);
+        for (VertexIndex i = 0; i < size; ++i)
+            BaseClass::forEachOutEdge(i, [&](VertexIndex j, EdgeWeight weight) {
+                triplets.addEntry(i, j, weight);
+            });
+        return buildSparseMatrix(size, triplets, orientation, KeepLastEntry());
+    }
+
     /// @copydoc LabeledDirectedGraph::operator<<
     friend std::ostream &
-    operator<<(std::ostream &stream, const DirectedWeightedGraph &graph) {
+    operator<<(std::ostream &stream, const BasicDirectedWeightedGraph &graph) {
         stream << "DirectedWeightedGraph of size: " << graph.getSize() << "\n"
                << "Neighbours of:\n";
 
         for (VertexIndex i : graph) {
             stream << i << ": ";
+            auto weight = graph.getOutEdgeWeights(i).begin();
             for (auto &neighbour : graph.getOutNeighbours(i))
-                stream << neighbour << "(" << graph.getEdgeWeight(i, neighbour)
-                       << "), ";
+                stream << neighbour << "(" << *weight++ << "), ";
             stream << "\n";
         }
         return stream;
     }
 };
 
+/// Directed weighted graph with the default storage.
+using DirectedWeightedGraph = BasicDirectedWeightedGraph<>;
+
 } // namespace BaseGraph
 
 #endif
@@ -0,0 +1,124 @@
+#ifndef BASE_GRAPH_EDGE_PROPERTY_HPP
+#define BASE_GRAPH_EDGE_PROPERTY_HPP
+
+#include "BaseGraph/types.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace BaseGraph {
+
+/// Out edge of a vertex: the neighbour it leads to and its @ref EdgeId.
+struct OutEdge {
+    VertexIndex neighbour;
+    EdgeId id;
+};
+
+/**
+ * Range of the out edges of a vertex, returned by the `getOutEdges` method of
+ * the compact graphs. Iterating yields an @ref OutEdge for each neighbour, in
+ * the order of `getOutNeighbours`.
+ */
+class OutEdges {
+    const VertexIndex *neighbours = nullptr;
+    const VertexIndex *neighboursEnd = nullptr;
+    /// Identifier of each neighbour. When null, the identifiers are
+    /// consecutive and start at \c firstId.
+    const EdgeId *ids = nullptr;
+    EdgeId firstId = 0;
+
+  public:
+    class const_iterator {
+        const OutEdges *edges;
+        size_t position;
+
+      public:
+        const_iterator(const OutEdges &edges, size_t position)
+            : edges(&edges), position(position) {}
+
+        OutEdge operator*() const {
+            return {
+                edges->neighbours[position],
+                edges->ids == nullptr ? edges->firstId + position
+                                      : edges->ids[position]
+            };
+        }
+        const_iterator &operator++() {
+            ++position;
+            return *this;
+        }
+        bool operator==(const const_iterator &other) const {
+            return position == other.position;
+        }
+        bool operator!=(const const_iterator &other) const {
+            return position != other.position;
+        }
+    };
+
+    OutEdges() {}
+    /// Out edges whose identifiers are \p firstId, \p firstId +1, ...
+    OutEdges(ArrayView<VertexIndex> neighbours, EdgeId firstId)
+        : neighbours(neighbours.begin()), neighboursEnd(neighbours.end()),
+          firstId(firstId) {}
+    /// Out edges whose identifiers are in \p ids, parallel to \p neighbours.
+    OutEdges(ArrayView<VertexIndex> neighbours, const EdgeId *ids)
+        : neighbours(neighbours.begin()), neighboursEnd(neighbours.end()),
+          ids(ids) {}
+
+    const_iterator begin() const { return const_iterator(*this, 0); }
+    const_iterator end() const { return const_iterator(*this, size()); }
+    size_t size() const { return neighboursEnd - neighbours; }
+    bool empty() const { return neighbours == neighboursEnd; }
+};
+
+/**
+ * Value of type \p T for each edge of a graph, stored in a flat array indexed
+ * by @ref EdgeId. It replaces the hash maps keyed by @ref Edge for per-edge
+ * values (weights, flows, scores, ...):
+ *
+ *     auto graph = BaseGraph::freeze(mutableGraph);
+ *     BaseGraph::EdgeProperty<double> flows(graph, 0);
+ *     for (VertexIndex i : graph)
+ *         for (auto edge : graph.getOutEdges(i))
+ *             flows[edge.id] += computeFlow(i, edge.neighbour);
+ *
+ * The identifiers of a compact graph never change, so the property remains
+ * valid for the lifetime of the graph.
+ */
+template <typename T>
+class EdgeProperty {
+    std::vector<T> values;
+
+  public:
+    /// Constructs a property of \p edgeNumber edges, all equal to \p value.
+    explicit EdgeProperty(size_t edgeNumber = 0, const T &value = T())
+        : values(edgeNumber, value) {}
+    /// Constructs a property of every edge of \p graph, all equal to \p value.
+    template <
+        typename Graph, typename = typename std::enable_if<
+                            !std::is_arithmetic<Graph>::value>::type>
+    explicit EdgeProperty(const Graph &graph, const T &value = T())
+        : values(graph.getEdgeNumber(), value) {}
+
+    /// Returns the number of edges.
+    size_t size() const { return values.size(); }
+
+    T &operator[](EdgeId id) { return values[id]; }
+    const T &operator[](EdgeId id) const { return values[id]; }
+
+    typename std::vector<T>::iterator begin() { return values.begin(); }
+    typename std::vector<T>::iterator end() { return values.end(); }
+    typename std::vector<T>::const_iterator begin() const {
+        return values.begin();
+    }
+    typename std::vector<T>::const_iterator end() const {
+        return values.end();
+    }
+
+    /// Returns the values, ordered by edge identifier.
+    const std::vector<T> &getValues() const { return values; }
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -51,15 +51,17 @@ std::ifstream &readBinaryValue(std::ifstream &fileStream, T &value) {
     return fileStream;
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 void writeTextEdgeList(
-    const Graph<EdgeLabel> &graph, const std::string &fileName,
+    const Graph<EdgeLabel, Storage...> &graph, const std::string &fileName,
     const std::function<std::string(const EdgeLabel &)> toString =
         std::to_string
 );
 
-template <template <class...> class Graph, typename EdgeLabel>
-std::pair<Graph<EdgeLabel>, std::vector<std::string>>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
+std::pair<Graph<EdgeLabel, Storage...>, std::vector<std::string>>
 loadTextVertexLabeledEdgeList(
     const std::string &fileName,
     const std::function<EdgeLabel(const std::string &)> edgeFromString =
@@ -68,33 +70,40 @@ loadTextVertexLabeledEdgeList(
         VertexCountMapper()
 );
 
-template <template <class...> class Graph, typename EdgeLabel>
-std::pair<Graph<EdgeLabel>, std::vector<std::string>> loadTextEdgeList(
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
+std::pair<Graph<EdgeLabel, Storage...>, std::vector<std::string>>
+loadTextEdgeList(
     const std::string &fileName,
     const std::function<EdgeLabel(const std::string &)> fromString =
         [](const std::string &s) { return EdgeLabel(); }
 ) {
-    return loadTextVertexLabeledEdgeList<Graph, EdgeLabel>(
-        fileName, fromString, [](const std::string &str) { return stoi(str); }
+    return loadTextVertexLabeledEdgeList<Graph, EdgeLabel, Storage...>(
+        fileName, fromString,
+        [](const std::string &str) { return VertexIndex(std::stoull(str)); }
     );
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 typename std::enable_if<!std::is_same<EdgeLabel, NoLabel>::value>::type
-writeBinaryEdgeList(const Graph<EdgeLabel> &graph, const std::string &fileName, const std::function<void(std::ofstream &, EdgeLabel)> toBinary = writeBinaryValue<EdgeLabel>);
+writeBinaryEdgeList(const Graph<EdgeLabel, Storage...> &graph, const std::string &fileName, const std::function<void(std::ofstream &, EdgeLabel)> toBinary = writeBinaryValue<EdgeLabel>);
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 typename std::enable_if<std::is_same<EdgeLabel, NoLabel>::value>::type
-writeBinaryEdgeList(const Graph<EdgeLabel> &graph, const std::string &fileName);
+writeBinaryEdgeList(const Graph<EdgeLabel, Storage...> &graph, const std::string &fileName);
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 typename std::enable_if<
-    !std::is_same<EdgeLabel, NoLabel>::value, Graph<EdgeLabel>>::type
+    !std::is_same<EdgeLabel, NoLabel>::value, Graph<EdgeLabel, Storage...>>::type
 loadBinaryEdgeList(const std::string &fileName, const std::function<std::ifstream &(std::ifstream &, EdgeLabel &)> fromBinary = readBinaryValue<EdgeLabel>);
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 typename std::enable_if<
-    std::is_same<EdgeLabel, NoLabel>::value, Graph<EdgeLabel>>::type
+    std::is_same<EdgeLabel, NoLabel>::value, Graph<EdgeLabel, Storage...>>::type
 loadBinaryEdgeList(const std::string &fileName);
 
 template <typename T>
@@ -107,9 +116,10 @@ verifyStreamOpened(const T &fileStream, const std::string &fileName) {
 inline std::array<std::string, 3>
 findEdgeFromString(std::string &s, const char *t = " \t\n\r\f\v");
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 void writeTextEdgeList(
-    const Graph<EdgeLabel> &graph, const std::string &fileName,
+    const Graph<EdgeLabel, Storage...> &graph, const std::string &fileName,
     const std::function<std::string(const EdgeLabel &)> toString
 ) {
 
@@ -124,9 +134,9 @@ void writeTextEdgeList(
                    << '\n';
 }
 
-template <template <class...> class Graph>
+template <template <class...> class Graph, typename... Storage>
 void writeTextEdgeList(
-    const Graph<NoLabel> &graph, const std::string &fileName,
+    const Graph<NoLabel, Storage...> &graph, const std::string &fileName,
     const std::function<std::string(const NoLabel &)> toString =
         [](const NoLabel &) { return ""; }
 ) {
@@ -140,10 +150,11 @@ void writeTextEdgeList(
         fileStream << edge.first << " " << edge.second << '\n';
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 typename std::enable_if<!std::is_same<EdgeLabel, NoLabel>::value>::type
 writeBinaryEdgeList(
-    const Graph<EdgeLabel> &graph, const std::string &fileName,
+    const Graph<EdgeLabel, Storage...> &graph, const std::string &fileName,
     const std::function<void(std::ofstream &, EdgeLabel)> toBinary
 ) {
 
@@ -164,10 +175,11 @@ writeBinaryEdgeList(
     }
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 typename std::enable_if<std::is_same<EdgeLabel, NoLabel>::value>::type
 writeBinaryEdgeList(
-    const Graph<EdgeLabel> &graph, const std::string &fileName
+    const Graph<EdgeLabel, Storage...> &graph, const std::string &fileName
 ) {
 
     std::ofstream fileStream(
@@ -181,8 +193,9 @@ writeBinaryEdgeList(
     }
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
-std::pair<Graph<EdgeLabel>, std::vector<std::string>>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
+std::pair<Graph<EdgeLabel, Storage...>, std::vector<std::string>>
 loadTextVertexLabeledEdgeList(
     const std::string &fileName,
     const std::function<EdgeLabel(const std::string &)> edgeFromString,
@@ -192,7 +205,7 @@ loadTextVertexLabeledEdgeList(
     std::ifstream fileStream(fileName);
     verifyStreamOpened(fileStream, fileName);
 
-    Graph<EdgeLabel> returnedGraph(0);
+    Graph<EdgeLabel, Storage...> returnedGraph(0);
     std::vector<std::string> vertexLabels;
 
     std::string fullLine;
@@ -218,9 +231,10 @@ loadTextVertexLabeledEdgeList(
     return {std::move(returnedGraph), std::move(vertexLabels)};
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 typename std::enable_if<
-    !std::is_same<EdgeLabel, NoLabel>::value, Graph<EdgeLabel>>::type
+    !std::is_same<EdgeLabel, NoLabel>::value, Graph<EdgeLabel, Storage...>>::type
 loadBinaryEdgeList(
     const std::string &fileName,
     const std::function<std::ifstream &(std::ifstream &, EdgeLabel &)>
@@ -235,7 +249,7 @@ loadBinaryEdgeList(
     std::ifstream fileStream(fileName.c_str(), std::ios::in | std::ios::binary);
     verifyStreamOpened(fileStream, fileName);
 
-    Graph<EdgeLabel> returnedGraph(0);
+    Graph<EdgeLabel, Storage...> returnedGraph(0);
 
     VertexIndex vertex1, vertex2;
     EdgeLabel label;
@@ -253,14 +267,15 @@ loadBinaryEdgeList(
     return returnedGraph;
 }
 
-template <template <class...> class Graph, typename EdgeLabel>
+template <
+    template <class...> class Graph, typename EdgeLabel, typename... Storage>
 typename std::enable_if<
-    std::is_same<EdgeLabel, NoLabel>::value, Graph<EdgeLabel>>::type
+    std::is_same<EdgeLabel, NoLabel>::value, Graph<EdgeLabel, Storage...>>::type
 loadBinaryEdgeList(const std::string &fileName) {
     std::ifstream fileStream(fileName.c_str(), std::ios::in | std::ios::binary);
     verifyStreamOpened(fileStream, fileName);
 
-    Graph<NoLabel> returnedGraph(0);
+    Graph<NoLabel, Storage...> returnedGraph(0);
 
     VertexIndex vertex1, vertex2;
     NoLabel label;
@@ -0,0 +1,205 @@
+#ifndef BASE_GRAPH_FLAT_EDGE_MAP_HPP
+#define BASE_GRAPH_FLAT_EDGE_MAP_HPP
+
+#include "BaseGraph/types.h"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace BaseGraph {
+
+/// Mixes the bits of \p key with the finalizer of SplitMix64.
+inline uint64_t mixHashBits(uint64_t key) {
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+/// Packs \p edge in a 64-bit integer and mixes its bits with @ref
+/// mixHashBits. Edges that share a vertex end up far apart in a hash table.
+/// 64-bit vertex indices don't fit together in a single integer, so the
+/// source is mixed before being combined with the destination.
+inline uint64_t hashEdgeKey(const Edge &edge) {
+    if (sizeof(VertexIndex) <= 4)
+        return mixHashBits(uint64_t(edge.first) << 32 | uint64_t(edge.second));
+    return mixHashBits(
+        mixHashBits(uint64_t(edge.first)) + uint64_t(edge.second)
+    );
+}
+
+/// Is `true` when \p T can be hashed with `std::hash`.
+template <typename T>
+class IsHashable {
+    template <typename U>
+    static auto test(int) -> decltype(
+        std::hash<U>()(std::declval<const U &>()), std::true_type()
+    );
+    template <typename>
+    static std::false_type test(...);
+
+  public:
+    static constexpr bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Hash table that maps each @ref BaseGraph::Edge to a \p Value. The entries
+ * are stored in a single array (open addressing with linear probing), which
+ * avoids the allocation and the pointer chasing of each node of a
+ * `std::unordered_map`. The capacity is a power of two and the table grows
+ * when it is three quarters full.
+ *
+ * The edge whose source is the largest @ref BaseGraph::VertexIndex marks the
+ * empty slots and cannot be inserted. Pointers returned by the table are
+ * invalidated when elements are inserted or erased.
+ *
+ * @tparam Value Default constructible type associated to each edge.
+ */
+template <typename Value>
+class FlatEdgeMap {
+    struct Slot {
+        Edge key;
+        Value value;
+    };
+
+    static constexpr VertexIndex EMPTY =
+        std::numeric_limits<VertexIndex>::max();
+
+    std::vector<Slot> slots;
+    size_t elementNumber = 0;
+
+  public:
+    /// Constructs an empty table able to hold \p expectedSize edges without
+    /// growing.
+    explicit FlatEdgeMap(size_t expectedSize = 0) { reserve(expectedSize); }
+
+    /// Returns the number of edges in the table.
+    size_t size() const { return elementNumber; }
+    /// Returns if the table contains no edge.
+    bool empty() const { return elementNumber == 0; }
+    /// Returns the number of slots of the table.
+    size_t capacity() const { return slots.size(); }
+
+    /// Grows the table so that it holds \p expectedSize edges without
+    /// growing again.
+    void reserve(size_t expectedSize) {
+        size_t newCapacity = slots.empty() ? 8 : slots.size();
+        while (expectedSize * 4 > newCapacity * 3)
+            newCapacity *= 2;
+        if (newCapacity != slots.size())
+            rehash(newCapacity);
+    }
+
+    /// Removes every edge without releasing the memory.
+    void clear() {
+        for (auto &slot : slots)
+            slot = {{EMPTY, EMPTY}, Value()};
+        elementNumber = 0;
+    }
+
+    /// Returns the value of \p edge or `nullptr` if it is not in the table.
+    const Value *find(const Edge &edge) const {
+        const Slot &slot = slots[findSlot(edge)];
+        return slot.key.first == EMPTY ? nullptr : &slot.value;
+    }
+    /// Returns the value of \p edge or `nullptr` if it is not in the table.
+    Value *find(const Edge &edge) {
+        Slot &slot = slots[findSlot(edge)];
+        return slot.key.first == EMPTY ? nullptr : &slot.value;
+    }
+
+    /// Returns if \p edge is in the table.
+    bool contains(const Edge &edge) const { return find(edge) != nullptr; }
+
+    /// Adds \p edge with \p value if it is not already in the table. Returns
+    /// the value of \p edge and if it was inserted.
+    std::pair<Value *, bool>
+    insert(const Edge &edge, const Value &value = Value()) {
+        if (edge.first == EMPTY)
+            throw std::invalid_argument("Edge source is reserved.");
+
+        size_t position = findSlot(edge);
+        if (slots[position].key.first != EMPTY)
+            return {&slots[position].value, false};
+
+        if ((elementNumber + 1) * 4 > slots.size() * 3) {
+            rehash(slots.size() * 2);
+            position = findSlot(edge);
+        }
+        slots[position] = {edge, value};
+        ++elementNumber;
+        return {&slots[position].value, true};
+    }
+
+    /// Returns the value of \p edge, inserting `Value()` if it is not in the
+    /// table.
+    Value &operator[](const Edge &edge) { return *insert(edge).first; }
+
+    /// Removes \p edge from the table. Returns if it was in the table.
+    bool erase(const Edge &edge) {
+        size_t hole = findSlot(edge);
+        if (slots[hole].key.first == EMPTY)
+            return false;
+
+        // Entries that follow the hole in the same probe sequence are shifted
+        // back, so that no tombstone is needed.
+        size_t mask = slots.size() - 1;
+        for (size_t next = (hole + 1) & mask; slots[next].key.first != EMPTY;
+             next = (next + 1) & mask) {
+            size_t home = hashEdgeKey(slots[next].key) & mask;
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                slots[hole] = std::move(slots[next]);
+                hole = next;
+            }
+        }
+        slots[hole] = {{EMPTY, EMPTY}, Value()};
+        --elementNumber;
+        return true;
+    }
+
+    /// Calls \p visit with each edge and its value, in no particular order.
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (const auto &slot : slots)
+            if (slot.key.first != EMPTY)
+                visit(slot.key, slot.value);
+    }
+
+  private:
+    /// Returns the slot of \p edge or the empty slot where it would be
+    /// inserted.
+    size_t findSlot(const Edge &edge) const {
+        size_t mask = slots.size() - 1;
+        size_t position = hashEdgeKey(edge) & mask;
+        while (slots[position].key.first != EMPTY &&
+               slots[position].key != edge)
+            position = (position + 1) & mask;
+        return position;
+    }
+
+    void rehash(size_t newCapacity) {
+        std::vector<Slot> oldSlots(newCapacity, {{EMPTY, EMPTY}, Value()});
+        oldSlots.swap(slots);
+
+        for (auto &slot : oldSlots)
+            if (slot.key.first != EMPTY)
+                slots[findSlot(slot.key)] = std::move(slot);
+    }
+};
+
+template <typename Value>
+constexpr VertexIndex FlatEdgeMap<Value>::EMPTY;
+
+/// Set of edges stored in a @ref BaseGraph::FlatEdgeMap.
+using FlatEdgeSet = FlatEdgeMap<NoLabel>;
+
+} // namespace BaseGraph
+
+#endif
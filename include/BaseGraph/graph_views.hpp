@@ -0,0 +1,634 @@
+#ifndef BASE_GRAPH_GRAPH_VIEWS_HPP
+#define BASE_GRAPH_GRAPH_VIEWS_HPP
+
+#include "BaseGraph/types.h"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace BaseGraph {
+
+/// Type returned by `getOutNeighbours` for a graph of type \p Graph: a
+/// reference for graphs that store the neighbours in containers, a range
+/// object for the others.
+template <typename Graph>
+using OutNeighboursOf =
+    decltype(std::declval<const Graph &>().getOutNeighbours(0));
+/// Type returned by `getInNeighbours` for a graph of type \p Graph.
+template <typename Graph>
+using InNeighboursOf =
+    decltype(std::declval<const Graph &>().getInNeighbours(0));
+
+/// Throws `std::out_of_range` if \p vertex is not contained in a view of
+/// \p size vertices.
+inline void assertVertexInRange(VertexIndex vertex, size_t size) {
+    if (vertex >= size)
+        throw std::out_of_range(
+            "Vertex index (" + std::to_string(vertex) +
+            ") greater than the graph's size(" + std::to_string(size) + ")."
+        );
+}
+
+/**
+ * Range over the neighbours in \p Range that are kept by a vertex mask. The
+ * neighbours are filtered while iterating, nothing is copied.
+ *
+ * @tparam Range Type returned by the `getOutNeighbours` method of the
+ * underlying graph. When it is a reference, the range refers to the
+ * container of the graph.
+ */
+template <typename Range>
+class FilteredNeighbours {
+    typedef typename std::remove_reference<Range>::type BaseRange;
+    typedef decltype(std::declval<const BaseRange &>().begin()) BaseIterator;
+
+    Range neighbours;
+    const std::vector<bool> *kept;
+    bool sourceKept;
+
+  public:
+    class const_iterator {
+        BaseIterator current, last;
+        const std::vector<bool> *kept;
+
+        void skipRemovedVertices() {
+            while (current != last && !(*kept)[*current])
+                ++current;
+        }
+
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef VertexIndex value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const VertexIndex *pointer;
+        typedef VertexIndex reference;
+
+        const_iterator(
+            BaseIterator current, BaseIterator last,
+            const std::vector<bool> *kept
+        )
+            : current(current), last(last), kept(kept) {
+            skipRemovedVertices();
+        }
+
+        VertexIndex operator*() const { return *current; }
+        const_iterator &operator++() {
+            ++current;
+            skipRemovedVertices();
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            operator++();
+            return tmp;
+        }
+        bool operator==(const const_iterator &other) const {
+            return current == other.current;
+        }
+        bool operator!=(const const_iterator &other) const {
+            return current != other.current;
+        }
+    };
+    typedef const_iterator iterator;
+    typedef VertexIndex value_type;
+
+    /// Constructs the range of the neighbours of a vertex. The range is empty
+    /// if \p sourceKept is `false`.
+    FilteredNeighbours(
+        Range neighbours, const std::vector<bool> &kept, bool sourceKept
+    )
+        : neighbours(neighbours), kept(&kept), sourceKept(sourceKept) {}
+
+    const_iterator begin() const {
+        if (!sourceKept)
+            return end();
+        return const_iterator(neighbours.begin(), neighbours.end(), kept);
+    }
+    const_iterator end() const {
+        return const_iterator(neighbours.end(), neighbours.end(), kept);
+    }
+    /// Counts the neighbours in the range, in linear time.
+    size_t size() const { return std::distance(begin(), end()); }
+    bool empty() const { return begin() == end(); }
+};
+
+/**
+ * Range over the out neighbours followed by the in neighbours of a vertex.
+ * Self-loops are only listed with the out neighbours, so they appear once
+ * like in @ref LabeledUndirectedGraph.
+ *
+ * @tparam OutRange Type returned by `getOutNeighbours`.
+ * @tparam InRange Type returned by `getInNeighbours`.
+ */
+template <typename OutRange, typename InRange>
+class SymmetrizedNeighbours {
+    typedef typename std::remove_reference<OutRange>::type BaseOutRange;
+    typedef typename std::remove_reference<InRange>::type BaseInRange;
+    typedef decltype(std::declval<const BaseOutRange &>().begin())
+        OutIterator;
+    typedef decltype(std::declval<const BaseInRange &>().begin()) InIterator;
+
+    OutRange outNeighbours;
+    InRange inNeighbours;
+    VertexIndex vertex;
+
+  public:
+    class const_iterator {
+        OutIterator currentOut, lastOut;
+        InIterator currentIn, lastIn;
+        VertexIndex vertex;
+
+        void skipSelfLoops() {
+            while (currentOut == lastOut && currentIn != lastIn &&
+                   *currentIn == vertex)
+                ++currentIn;
+        }
+
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef VertexIndex value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const VertexIndex *pointer;
+        typedef VertexIndex reference;
+
+        const_iterator(
+            OutIterator currentOut, OutIterator lastOut, InIterator currentIn,
+            InIterator lastIn, VertexIndex vertex
+        )
+            : currentOut(currentOut), lastOut(lastOut), currentIn(currentIn),
+              lastIn(lastIn), vertex(vertex) {
+            skipSelfLoops();
+        }
+
+        VertexIndex operator*() const {
+            return currentOut != lastOut ? *currentOut : *currentIn;
+        }
+        const_iterator &operator++() {
+            if (currentOut != lastOut)
+                ++currentOut;
+            else
+                ++currentIn;
+            skipSelfLoops();
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            operator++();
+            return tmp;
+        }
+        bool operator==(const const_iterator &other) const {
+            return currentOut == other.currentOut &&
+                   currentIn == other.currentIn;
+        }
+        bool operator!=(const const_iterator &other) const {
+            return !(*this == other);
+        }
+    };
+    typedef const_iterator iterator;
+    typedef VertexIndex value_type;
+
+    SymmetrizedNeighbours(
+        OutRange outNeighbours, InRange inNeighbours, VertexIndex vertex
+    )
+        : outNeighbours(outNeighbours), inNeighbours(inNeighbours),
+          vertex(vertex) {}
+
+    const_iterator begin() const {
+        return const_iterator(
+            outNeighbours.begin(), outNeighbours.end(), inNeighbours.begin(),
+            inNeighbours.end(), vertex
+        );
+    }
+    const_iterator end() const {
+        return const_iterator(
+            outNeighbours.end(), outNeighbours.end(), inNeighbours.end(),
+            inNeighbours.end(), vertex
+        );
+    }
+    /// Counts the neighbours in the range, in linear time.
+    size_t size() const { return std::distance(begin(), end()); }
+    bool empty() const { return begin() == end(); }
+};
+
+/**
+ * Read-only view of a directed graph in which every edge \f$(i,j)\f$ is
+ * presented as \f$(j,i)\f$. The out neighbours of the view are the in
+ * neighbours of the graph, so the graph must provide `getInNeighbours` (@ref
+ * LabeledDirectedGraph::trackInNeighbours must have been called for the
+ * mutable graphs). No edge is copied.
+ *
+ * The view refers to the graph, which must outlive it. It can be passed to
+ * the traversal functions of `BaseGraph::algorithms`.
+ *
+ * @tparam Graph Type of the underlying graph.
+ */
+template <typename Graph>
+class ReversedGraphView {
+    const Graph &graph;
+
+  public:
+    explicit ReversedGraphView(const Graph &graph) : graph(graph) {}
+
+    /// Returns the underlying graph.
+    const Graph &getBaseGraph() const { return graph; }
+    size_t getSize() const { return graph.getSize(); }
+    size_t getEdgeNumber() const { return graph.getEdgeNumber(); }
+
+    /// Returns the in neighbours of \p vertex in the underlying graph.
+    InNeighboursOf<Graph> getOutNeighbours(VertexIndex vertex) const {
+        return graph.getInNeighbours(vertex);
+    }
+    /// Returns the out neighbours of \p vertex in the underlying graph.
+    OutNeighboursOf<Graph> getInNeighbours(VertexIndex vertex) const {
+        return graph.getOutNeighbours(vertex);
+    }
+    size_t getOutDegree(VertexIndex vertex) const {
+        return graph.getInDegree(vertex);
+    }
+    size_t getInDegree(VertexIndex vertex) const {
+        return graph.getOutDegree(vertex);
+    }
+    bool hasEdge(VertexIndex source, VertexIndex destination) const {
+        return graph.hasEdge(destination, source);
+    }
+
+    /// Throws `std::out_of_range` if \p vertex is not contained in the graph.
+    void assertVertexInRange(VertexIndex vertex) const {
+        BaseGraph::assertVertexInRange(vertex, getSize());
+    }
+
+    VertexIterator begin() const { return VertexIterator(0); }
+    VertexIterator end() const { return VertexIterator(getSize()); }
+};
+
+/**
+ * Read-only view of a directed graph as an undirected graph: the neighbours of
+ * a vertex are its out neighbours followed by its in neighbours. The graph
+ * must provide `getInNeighbours`, like for @ref ReversedGraphView. No edge is
+ * copied.
+ *
+ * Reciprocal edges \f$(i,j)\f$ and \f$(j,i)\f$ make \f$j\f$ appear twice in
+ * the neighbours of \f$i\f$, like parallel edges. This doesn't change the
+ * result of traversals.
+ *
+ * @tparam Graph Type of the underlying directed graph.
+ */
+template <typename Graph>
+class SymmetrizedGraphView {
+    const Graph &graph;
+
+  public:
+    typedef SymmetrizedNeighbours<OutNeighboursOf<Graph>, InNeighboursOf<Graph>>
+        Neighbours;
+
+    explicit SymmetrizedGraphView(const Graph &graph) : graph(graph) {}
+
+    /// Returns the underlying graph.
+    const Graph &getBaseGraph() const { return graph; }
+    size_t getSize() const { return graph.getSize(); }
+
+    /// Returns the out and in neighbours of \p vertex in the underlying
+    /// graph.
+    Neighbours getNeighbours(VertexIndex vertex) const {
+        return Neighbours(
+            graph.getOutNeighbours(vertex), graph.getInNeighbours(vertex),
+            vertex
+        );
+    }
+    /// @copydoc getNeighbours
+    Neighbours getOutNeighbours(VertexIndex vertex) const {
+        return getNeighbours(vertex);
+    }
+    /// Counts the neighbours of \p vertex, in linear time.
+    size_t getDegree(VertexIndex vertex) const {
+        return getNeighbours(vertex).size();
+    }
+    bool hasEdge(VertexIndex vertex1, VertexIndex vertex2) const {
+        return graph.hasEdge(vertex1, vertex2) ||
+               graph.hasEdge(vertex2, vertex1);
+    }
+
+    /// @copydoc ReversedGraphView::assertVertexInRange
+    void assertVertexInRange(VertexIndex vertex) const {
+        BaseGraph::assertVertexInRange(vertex, getSize());
+    }
+
+    VertexIterator begin() const { return VertexIterator(0); }
+    VertexIterator end() const { return VertexIterator(getSize()); }
+};
+
+/**
+ * Read-only view of the subgraph induced by a set of vertices: only the edges
+ * between kept vertices are visible. Like `algorithms::getSubgraph`, the
+ * vertices keep their index and the view has the size of the graph. The edges
+ * are filtered while iterating, so the view only stores one bit per vertex.
+ *
+ * @tparam Graph Type of the underlying graph. Works with directed and
+ * undirected graphs.
+ */
+template <typename Graph>
+class InducedSubgraphView {
+    const Graph &graph;
+    std::vector<bool> kept;
+
+  public:
+    typedef FilteredNeighbours<OutNeighboursOf<Graph>> Neighbours;
+
+    /// Constructs the view of the subgraph of the vertices \c i for which
+    /// `kept[i]` is `true`. Throws `std::invalid_argument` if \p kept
+    /// doesn't have one element per vertex.
+    InducedSubgraphView(const Graph &graph, std::vector<bool> kept)
+        : graph(graph), kept(std::move(kept)) {
+        if (this->kept.size() != graph.getSize())
+            throw std::invalid_argument(
+                "The vertex mask must have one element per vertex."
+            );
+    }
+    /// Constructs the view of the subgraph of \p vertices.
+    InducedSubgraphView(
+        const Graph &graph, const std::unordered_set<VertexIndex> &vertices
+    )
+        : graph(graph), kept(graph.getSize(), false) {
+        for (VertexIndex vertex : vertices) {
+            assertVertexInRange(vertex);
+            kept[vertex] = true;
+        }
+    }
+
+    /// Returns the underlying graph.
+    const Graph &getBaseGraph() const { return graph; }
+    size_t getSize() const { return graph.getSize(); }
+    /// Returns if \p vertex belongs to the subgraph.
+    bool hasVertex(VertexIndex vertex) const { return kept[vertex]; }
+
+    /// Returns the out neighbours of \p vertex that belong to the subgraph.
+    /// The range is empty if \p vertex doesn't belong to the subgraph.
+    Neighbours getOutNeighbours(VertexIndex vertex) const {
+        return Neighbours(graph.getOutNeighbours(vertex), kept, kept[vertex]);
+    }
+    /// Returns the in neighbours of \p vertex that belong to the subgraph.
+    /// Only available if the underlying graph provides `getInNeighbours`.
+    template <typename G = Graph>
+    FilteredNeighbours<InNeighboursOf<G>> getInNeighbours(VertexIndex vertex
+    ) const {
+        return FilteredNeighbours<InNeighboursOf<G>>(
+            graph.getInNeighbours(vertex), kept, kept[vertex]
+        );
+    }
+    /// @copydoc getOutNeighbours
+    Neighbours getNeighbours(VertexIndex vertex) const {
+        return getOutNeighbours(vertex);
+    }
+    /// Counts the out neighbours of \p vertex in the subgraph, in linear
+    /// time.
+    size_t getOutDegree(VertexIndex vertex) const {
+        return getOutNeighbours(vertex).size();
+    }
+    bool hasEdge(VertexIndex source, VertexIndex destination) const {
+        return kept[source] && kept[destination] &&
+               graph.hasEdge(source, destination);
+    }
+
+    /// @copydoc ReversedGraphView::assertVertexInRange
+    void assertVertexInRange(VertexIndex vertex) const {
+        BaseGraph::assertVertexInRange(vertex, getSize());
+    }
+
+    VertexIterator begin() const { return VertexIterator(0); }
+    VertexIterator end() const { return VertexIterator(getSize()); }
+};
+
+/**
+ * Returns the permutation that undoes \p newIndices: if vertex \c i becomes
+ * `newIndices[i]`, vertex `newIndices[i]` becomes \c i. Throws
+ * `std::invalid_argument` if \p newIndices is not a permutation of the
+ * vertices of a graph of size \p size.
+ */
+inline std::vector<VertexIndex>
+getInversePermutation(const std::vector<VertexIndex> &newIndices, size_t size) {
+    if (newIndices.size() != size)
+        throw std::invalid_argument(
+            "The permutation must have one element per vertex."
+        );
+    std::vector<VertexIndex> inverse(size, VertexIndex(size));
+    for (VertexIndex i = 0; i < size; ++i) {
+        if (newIndices[i] >= size || inverse[newIndices[i]] != size)
+            throw std::invalid_argument(
+                "Each vertex must appear once in the permutation."
+            );
+        inverse[newIndices[i]] = i;
+    }
+    return inverse;
+}
+
+/// New index given to the vertices that are removed from a graph (see @ref
+/// getIndicesAfterRemoval).
+const VertexIndex REMOVED_VERTEX = std::numeric_limits<VertexIndex>::max();
+
+/**
+ * Returns the new index of each vertex of a graph of size \p size once \p
+ * removedVertices are removed: the remaining vertices keep their relative
+ * order and are renumbered from 0, and the removed vertices get @ref
+ * REMOVED_VERTEX. Vertices may appear more than once in \p removedVertices.
+ * Throws `std::out_of_range` if a vertex is not in the graph.
+ */
+inline std::vector<VertexIndex> getIndicesAfterRemoval(
+    const std::vector<VertexIndex> &removedVertices, size_t size
+) {
+    std::vector<VertexIndex> newIndices(size, 0);
+    for (VertexIndex vertex : removedVertices) {
+        if (vertex >= size)
+            throw std::out_of_range(
+                "Vertex index (" + std::to_string(vertex) +
+                ") greater than the graph's size(" + std::to_string(size) +
+                ")."
+            );
+        newIndices[vertex] = REMOVED_VERTEX;
+    }
+    VertexIndex nextIndex = 0;
+    for (VertexIndex &newIndex : newIndices)
+        if (newIndex != REMOVED_VERTEX)
+            newIndex = nextIndex++;
+    return newIndices;
+}
+
+/// Moves the value of each vertex \c i of \p values to `newIndices[i]` and
+/// erases the values of the removed vertices, where \p newIndices is
+/// returned by @ref getIndicesAfterRemoval.
+template <typename T>
+void applyIndicesAfterRemoval(
+    std::vector<T> &values, const std::vector<VertexIndex> &newIndices
+) {
+    size_t newSize = 0;
+    for (VertexIndex i = 0; i < newIndices.size(); ++i)
+        if (newIndices[i] != REMOVED_VERTEX) {
+            if (newIndices[i] != i)
+                values[newIndices[i]] = std::move(values[i]);
+            ++newSize;
+        }
+    values.erase(values.begin() + newSize, values.end());
+}
+
+/**
+ * Range over the neighbours in \p Range, each replaced by its new index in a
+ * permutation.
+ *
+ * @tparam Range Type returned by the `getOutNeighbours` method of the
+ * underlying graph.
+ */
+template <typename Range>
+class PermutedNeighbours {
+    typedef typename std::remove_reference<Range>::type BaseRange;
+    typedef decltype(std::declval<const BaseRange &>().begin()) BaseIterator;
+
+    Range neighbours;
+    const std::vector<VertexIndex> *newIndices;
+
+  public:
+    class const_iterator {
+        BaseIterator current;
+        const std::vector<VertexIndex> *newIndices;
+
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef VertexIndex value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const VertexIndex *pointer;
+        typedef VertexIndex reference;
+
+        const_iterator(
+            BaseIterator current, const std::vector<VertexIndex> *newIndices
+        )
+            : current(current), newIndices(newIndices) {}
+
+        VertexIndex operator*() const { return (*newIndices)[*current]; }
+        const_iterator &operator++() {
+            ++current;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            operator++();
+            return tmp;
+        }
+        bool operator==(const const_iterator &other) const {
+            return current == other.current;
+        }
+        bool operator!=(const const_iterator &other) const {
+            return current != other.current;
+        }
+    };
+    typedef const_iterator iterator;
+    typedef VertexIndex value_type;
+
+    PermutedNeighbours(
+        Range neighbours, const std::vector<VertexIndex> &newIndices
+    )
+        : neighbours(neighbours), newIndices(&newIndices) {}
+
+    const_iterator begin() const {
+        return const_iterator(neighbours.begin(), newIndices);
+    }
+    const_iterator end() const {
+        return const_iterator(neighbours.end(), newIndices);
+    }
+    size_t size() const { return std::distance(begin(), end()); }
+    bool empty() const { return begin() == end(); }
+};
+
+/**
+ * Read-only view of a graph in which vertex \c i is renamed
+ * `newIndices[i]`. The neighbours keep the order of the underlying graph, so
+ * the labels returned by `getOutEdgeLabels` stay aligned with them. The view
+ * stores the permutation and its inverse.
+ *
+ * @tparam Graph Type of the underlying graph.
+ */
+template <typename Graph>
+class PermutedGraphView {
+    const Graph &graph;
+    std::vector<VertexIndex> newIndices;
+    std::vector<VertexIndex> oldIndices;
+
+  public:
+    typedef PermutedNeighbours<OutNeighboursOf<Graph>> Neighbours;
+
+    /// Throws `std::invalid_argument` if \p newIndices is not a permutation
+    /// of the vertices of \p graph.
+    PermutedGraphView(const Graph &graph, std::vector<VertexIndex> newIndices)
+        : graph(graph), newIndices(std::move(newIndices)),
+          oldIndices(getInversePermutation(this->newIndices, graph.getSize())) {
+    }
+
+    /// Returns the underlying graph.
+    const Graph &getBaseGraph() const { return graph; }
+    size_t getSize() const { return graph.getSize(); }
+    /// Returns the index in the view of \p vertex of the underlying graph.
+    VertexIndex getNewIndex(VertexIndex vertex) const {
+        return newIndices[vertex];
+    }
+    /// Returns the index in the underlying graph of \p vertex of the view.
+    VertexIndex getOldIndex(VertexIndex vertex) const {
+        return oldIndices[vertex];
+    }
+
+    /// Returns the new indices of the out neighbours of \p vertex.
+    Neighbours getOutNeighbours(VertexIndex vertex) const {
+        return Neighbours(
+            graph.getOutNeighbours(oldIndices[vertex]), newIndices
+        );
+    }
+    /// @copydoc getOutNeighbours
+    Neighbours getNeighbours(VertexIndex vertex) const {
+        return getOutNeighbours(vertex);
+    }
+    /// Returns the labels of the out edges of \p vertex, in the same order as
+    /// @ref getOutNeighbours. Only available for labeled graphs.
+    template <typename G = Graph>
+    auto getOutEdgeLabels(VertexIndex vertex) const
+        -> decltype(std::declval<const G &>().getOutEdgeLabels(0)) {
+        return graph.getOutEdgeLabels(oldIndices[vertex]);
+    }
+    bool hasEdge(VertexIndex source, VertexIndex destination) const {
+        return graph.hasEdge(oldIndices[source], oldIndices[destination]);
+    }
+
+    /// @copydoc ReversedGraphView::assertVertexInRange
+    void assertVertexInRange(VertexIndex vertex) const {
+        BaseGraph::assertVertexInRange(vertex, getSize());
+    }
+
+    VertexIterator begin() const { return VertexIterator(0); }
+    VertexIterator end() const { return VertexIterator(getSize()); }
+};
+
+/// Constructs a @ref ReversedGraphView of \p graph.
+template <typename Graph>
+ReversedGraphView<Graph> getReversedView(const Graph &graph) {
+    return ReversedGraphView<Graph>(graph);
+}
+
+/// Constructs a @ref SymmetrizedGraphView of \p graph.
+template <typename Graph>
+SymmetrizedGraphView<Graph> getSymmetrizedView(const Graph &graph) {
+    return SymmetrizedGraphView<Graph>(graph);
+}
+
+/// Constructs an @ref InducedSubgraphView of the subgraph of \p vertices.
+template <typename Graph>
+InducedSubgraphView<Graph> getInducedSubgraphView(
+    const Graph &graph, const std::unordered_set<VertexIndex> &vertices
+) {
+    return InducedSubgraphView<Graph>(graph, vertices);
+}
+
+} // namespace BaseGraph
+
+#endif
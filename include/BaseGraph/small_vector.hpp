@@ -0,0 +1,296 @@
+#ifndef BASE_GRAPH_SMALL_VECTOR_HPP
+#define BASE_GRAPH_SMALL_VECTOR_HPP
+
+#include "BaseGraph/types.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace BaseGraph {
+
+/**
+ * Sequence container that stores up to \p N elements inside the object and
+ * moves them to the heap only when it grows beyond that. The interface is a
+ * subset of `std::vector` and iterators are pointers.
+ *
+ * Most vertices of sparse graphs have few neighbours: with @ref
+ * SmallVectorStorage, their neighbours live in the vector of containers of
+ * the graph, without any allocation, and only the vertices of large degree
+ * allocate a buffer.
+ *
+ * @tparam T Type of the elements.
+ * @tparam N Number of elements stored inline. Must be positive.
+ * @tparam Allocator Allocator of the heap buffer.
+ */
+template <typename T, size_t N, typename Allocator = std::allocator<T>>
+class SmallVector {
+    static_assert(N > 0, "SmallVector needs at least one inline element.");
+    typedef std::allocator_traits<Allocator> AllocatorTraits;
+
+  public:
+    typedef T value_type;
+    typedef Allocator allocator_type;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef T *pointer;
+    typedef const T *const_pointer;
+    typedef T *iterator;
+    typedef const T *const_iterator;
+
+  private:
+    T *first;
+    size_t count = 0;
+    size_t bufferSize = N;
+    Allocator allocator;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type inlineBuffer[N];
+
+  public:
+    SmallVector() : first(inlineData()) {}
+    explicit SmallVector(const Allocator &allocator)
+        : first(inlineData()), allocator(allocator) {}
+    SmallVector(std::initializer_list<T> elements) : first(inlineData()) {
+        reserve(elements.size());
+        for (const T &element : elements)
+            push_back(element);
+    }
+    SmallVector(const SmallVector &other)
+        : first(inlineData()),
+          allocator(AllocatorTraits::select_on_container_copy_construction(
+              other.allocator
+          )) {
+        reserve(other.count);
+        for (const T &element : other)
+            push_back(element);
+    }
+    // Declared noexcept so that std::vector moves the containers when it
+    // grows instead of copying them.
+    SmallVector(SmallVector &&other) noexcept(
+        std::is_nothrow_move_constructible<T>::value
+    )
+        : first(inlineData()) {
+        takeElements(other);
+    }
+    ~SmallVector() {
+        clear();
+        releaseBuffer();
+    }
+
+    SmallVector &operator=(const SmallVector &other) {
+        if (this != &other) {
+            clear();
+            reserve(other.count);
+            for (const T &element : other)
+                push_back(element);
+        }
+        return *this;
+    }
+    SmallVector &operator=(SmallVector &&other) noexcept(
+        std::is_nothrow_move_constructible<T>::value
+    ) {
+        if (this != &other) {
+            clear();
+            releaseBuffer();
+            takeElements(other);
+        }
+        return *this;
+    }
+
+    iterator begin() { return first; }
+    iterator end() { return first + count; }
+    const_iterator begin() const { return first; }
+    const_iterator end() const { return first + count; }
+    T *data() { return first; }
+    const T *data() const { return first; }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    /// Returns the number of elements that fit in the current buffer.
+    size_t capacity() const { return bufferSize; }
+    /// Returns if the elements are stored inside the object.
+    bool isInline() const { return first == inlineData(); }
+    Allocator get_allocator() const { return allocator; }
+
+    T &operator[](size_t i) { return first[i]; }
+    const T &operator[](size_t i) const { return first[i]; }
+    T &front() { return first[0]; }
+    const T &front() const { return first[0]; }
+    T &back() { return first[count - 1]; }
+    const T &back() const { return first[count - 1]; }
+
+    void push_back(const T &element) { emplace_back(element); }
+    void push_back(T &&element) { emplace_back(std::move(element)); }
+    template <typename... Args>
+    void emplace_back(Args &&...args) {
+        if (count == bufferSize) {
+            // The arguments can refer to an element of the container.
+            T element(std::forward<Args>(args)...);
+            grow(nextCapacity());
+            new (first + count) T(std::move(element));
+        } else
+            new (first + count) T(std::forward<Args>(args)...);
+        ++count;
+    }
+    void pop_back() { first[--count].~T(); }
+
+    iterator insert(const_iterator position, const T &element) {
+        return emplace(position, element);
+    }
+    iterator insert(const_iterator position, T &&element) {
+        return emplace(position, std::move(element));
+    }
+    template <typename... Args>
+    iterator emplace(const_iterator position, Args &&...args) {
+        size_t index = position - first;
+        T element(std::forward<Args>(args)...);
+        if (index == count) {
+            emplace_back(std::move(element));
+            return first + index;
+        }
+        emplace_back(std::move(back()));
+        std::move_backward(first + index, first + count - 2, first + count - 1);
+        first[index] = std::move(element);
+        return first + index;
+    }
+
+    iterator erase(const_iterator position) {
+        return erase(position, position + 1);
+    }
+    iterator erase(const_iterator rangeBegin, const_iterator rangeEnd) {
+        T *erasedBegin = first + (rangeBegin - first);
+        T *erasedEnd = first + (rangeEnd - first);
+        T *newEnd = std::move(erasedEnd, end(), erasedBegin);
+        while (end() != newEnd)
+            pop_back();
+        return erasedBegin;
+    }
+    void clear() {
+        while (count > 0)
+            pop_back();
+    }
+    void resize(size_t newSize) {
+        reserve(newSize);
+        while (count < newSize)
+            emplace_back();
+        while (count > newSize)
+            pop_back();
+    }
+
+    /// Makes room for \p newCapacity elements.
+    void reserve(size_t newCapacity) {
+        if (newCapacity > bufferSize)
+            grow(newCapacity);
+    }
+    /// Moves the elements back inside the object when they fit, or to a
+    /// buffer of the exact size otherwise.
+    void shrink_to_fit() {
+        if (!isInline() && count < bufferSize)
+            grow(count);
+    }
+
+    void swap(SmallVector &other) {
+        if (!isInline() && !other.isInline()) {
+            std::swap(first, other.first);
+            std::swap(count, other.count);
+            std::swap(bufferSize, other.bufferSize);
+            std::swap(allocator, other.allocator);
+            return;
+        }
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    bool operator==(const SmallVector &other) const {
+        return count == other.count &&
+               std::equal(begin(), end(), other.begin());
+    }
+    bool operator!=(const SmallVector &other) const {
+        return !(*this == other);
+    }
+
+  private:
+    T *inlineData() { return reinterpret_cast<T *>(inlineBuffer); }
+    const T *inlineData() const {
+        return reinterpret_cast<const T *>(inlineBuffer);
+    }
+
+    size_t nextCapacity() const { return 2 * bufferSize; }
+
+    /// Moves the elements to a buffer of \p newCapacity elements, which is
+    /// the inline buffer when they fit.
+    void grow(size_t newCapacity) {
+        T *newFirst = newCapacity <= N
+                          ? inlineData()
+                          : AllocatorTraits::allocate(allocator, newCapacity);
+        if (newFirst == first)
+            return;
+        for (size_t i = 0; i < count; ++i) {
+            new (newFirst + i) T(std::move(first[i]));
+            first[i].~T();
+        }
+        releaseBuffer();
+        first = newFirst;
+        bufferSize = std::max(newCapacity, N);
+    }
+
+    void releaseBuffer() {
+        if (!isInline())
+            AllocatorTraits::deallocate(allocator, first, bufferSize);
+        first = inlineData();
+        bufferSize = N;
+    }
+
+    /// Takes the elements of \p other, which is left empty. The heap buffer
+    /// of \p other is stolen when there is one.
+    void takeElements(SmallVector &other) {
+        allocator = std::move(other.allocator);
+        if (!other.isInline()) {
+            first = other.first;
+            count = other.count;
+            bufferSize = other.bufferSize;
+            other.first = other.inlineData();
+            other.count = 0;
+            other.bufferSize = N;
+            return;
+        }
+        for (T &element : other)
+            push_back(std::move(element));
+        other.clear();
+    }
+};
+
+template <typename T, size_t N, typename Allocator>
+void swap(
+    SmallVector<T, N, Allocator> &first, SmallVector<T, N, Allocator> &second
+) {
+    first.swap(second);
+}
+
+/**
+ * Storage policy that keeps the neighbours of each vertex in a @ref
+ * SmallVector. The first \p N neighbours (and edge labels) of a vertex are
+ * stored without allocation, which saves memory and allocations when most
+ * vertices have fewer than \p N neighbours.
+ *
+ * @tparam N Number of neighbours stored inline.
+ */
+template <size_t N = 8>
+struct SmallVectorStorage {
+    template <typename T>
+    using Container = SmallVector<T, N>;
+    template <typename T, typename Allocator>
+    using AllocatedContainer = SmallVector<T, N, Allocator>;
+    static constexpr bool isSorted = false;
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef BASE_GRAPH_SPARSE_MATRIX_HPP
+#define BASE_GRAPH_SPARSE_MATRIX_HPP
+
+#include "BaseGraph/types.h"
+
+#include <utility>
+#include <vector>
+
+namespace BaseGraph {
+
+/// Dimension along which the entries of a @ref SparseMatrix are grouped.
+enum class SparseOrientation {
+    /// Compressed sparse row (CSR): entries grouped by row.
+    Rows,
+    /// Compressed sparse column (CSC): entries grouped by column.
+    Columns
+};
+
+/// Sparse matrix in coordinate (COO) form: entry \c k is \c values[k] at row
+/// \c rows[k] and column \c columns[k].
+template <typename T>
+struct SparseTriplets {
+    std::vector<VertexIndex> rows;
+    std::vector<VertexIndex> columns;
+    std::vector<T> values;
+
+    void reserve(size_t entryNumber) {
+        rows.reserve(entryNumber);
+        columns.reserve(entryNumber);
+        values.reserve(entryNumber);
+    }
+    void addEntry(VertexIndex row, VertexIndex column, const T &value) {
+        rows.push_back(row);
+        columns.push_back(column);
+        values.push_back(value);
+    }
+};
+
+/**
+ * Square sparse matrix in compressed sparse row or column form. The entries
+ * of row (or column) \c i are `values[offsets[i]:offsets[i+1]]`, in the
+ * columns (or rows) `indices[offsets[i]:offsets[i+1]]`, sorted in increasing
+ * order. Only nonzero entries are stored.
+ *
+ * The arrays follow the layout of `scipy.sparse.csr_matrix((values, indices,
+ * offsets))` and of most numerical libraries.
+ *
+ * @tparam T Type of the entries.
+ */
+template <typename T>
+struct SparseMatrix {
+    /// Number of rows and of columns.
+    size_t size = 0;
+    SparseOrientation orientation = SparseOrientation::Rows;
+    std::vector<size_t> offsets;
+    std::vector<VertexIndex> indices;
+    std::vector<T> values;
+
+    /// Returns the number of stored entries.
+    size_t getNonzeroNumber() const { return values.size(); }
+
+    /// Returns the entries in coordinate form, in the order in which they are
+    /// stored.
+    SparseTriplets<T> toTriplets() const {
+        SparseTriplets<T> triplets;
+        std::vector<VertexIndex> majorIndices(indices.size());
+        for (size_t i = 0; i < size; ++i)
+            for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                majorIndices[k] = VertexIndex(i);
+
+        if (orientation == SparseOrientation::Rows) {
+            triplets.rows = std::move(majorIndices);
+            triplets.columns = indices;
+        } else {
+            triplets.rows = indices;
+            triplets.columns = std::move(majorIndices);
+        }
+        triplets.values = values;
+        return triplets;
+    }
+};
+
+/**
+ * Assembles a @ref SparseMatrix of size \p size from \p triplets in
+ * \f$O(V+E)\f$. The entries are bucketed twice with a counting sort (first by
+ * minor index, then by major index) so that the entries of each row or column
+ * end up sorted, then the entries at the same position are combined.
+ *
+ * @param merge Called with the stored value and the value of each following
+ * entry at the same position.
+ */
+template <typename T, typename Merge>
+SparseMatrix<T> buildSparseMatrix(
+    size_t size, const SparseTriplets<T> &triplets,
+    SparseOrientation orientation, Merge merge
+) {
+    const bool rowMajor = orientation == SparseOrientation::Rows;
+    const std::vector<VertexIndex> &majors =
+        rowMajor ? triplets.rows : triplets.columns;
+    const std::vector<VertexIndex> &minors =
+        rowMajor ? triplets.columns : triplets.rows;
+    const size_t entryNumber = triplets.values.size();
+
+    SparseMatrix<T> matrix;
+    matrix.size = size;
+    matrix.orientation = orientation;
+
+    std::vector<size_t> minorOffsets(size + 1, 0);
+    matrix.offsets.assign(size + 1, 0);
+    for (size_t k = 0; k < entryNumber; ++k) {
+        ++minorOffsets[minors[k] + 1];
+        ++matrix.offsets[majors[k] + 1];
+    }
+    for (size_t i = 0; i < size; ++i) {
+        minorOffsets[i + 1] += minorOffsets[i];
+        matrix.offsets[i + 1] += matrix.offsets[i];
+    }
+
+    std::vector<size_t> minorBuckets(entryNumber);
+    std::vector<size_t> nextPosition(
+        minorOffsets.begin(), minorOffsets.end() - 1
+    );
+    for (size_t k = 0; k < entryNumber; ++k)
+        minorBuckets[nextPosition[minors[k]]++] = k;
+
+    // Minor indices are visited in increasing order, so each line is sorted.
+    matrix.indices.resize(entryNumber);
+    matrix.values.resize(entryNumber);
+    nextPosition.assign(matrix.offsets.begin(), matrix.offsets.end() - 1);
+    for (size_t k : minorBuckets) {
+        size_t position = nextPosition[majors[k]]++;
+        matrix.indices[position] = minors[k];
+        matrix.values[position] = triplets.values[k];
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < size; ++i) {
+        size_t lineBegin = kept;
+        for (size_t k = matrix.offsets[i]; k < matrix.offsets[i + 1]; ++k) {
+            if (kept > lineBegin &&
+                matrix.indices[kept - 1] == matrix.indices[k])
+                merge(matrix.values[kept - 1], matrix.values[k]);
+            else {
+                matrix.indices[kept] = matrix.indices[k];
+                matrix.values[kept] = std::move(matrix.values[k]);
+                ++kept;
+            }
+        }
+        matrix.offsets[i] = lineBegin;
+    }
+    matrix.offsets[size] = kept;
+    matrix.indices.resize(kept);
+    matrix.values.resize(kept);
+    return matrix;
+}
+
+/// Merges the entries of a @ref SparseMatrix at the same position by summing
+/// their values.
+struct SumEntries {
+    template <typename T>
+    void operator()(T &stored, const T &value) const {
+        stored += value;
+    }
+};
+
+/// Merges the entries of a @ref SparseMatrix at the same position by keeping
+/// the last value, like the assignments of a dense matrix.
+struct KeepLastEntry {
+    template <typename T>
+    void operator()(T &stored, const T &value) const {
+        stored = value;
+    }
+};
+
+} // namespace BaseGraph
+
+#endif
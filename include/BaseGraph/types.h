@@ -2,14 +2,23 @@
 #define BASE_GRAPH_TYPES_H
 
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <tuple>
 #include <vector>
 
 namespace BaseGraph {
 
-/// Integer that identifies a vertex.
+#ifdef BASEGRAPH_64BIT_VERTEX_INDEX
+/// Integer that identifies a vertex. 64 bits wide because
+/// `BASEGRAPH_64BIT_VERTEX_INDEX` is defined.
+typedef std::uint64_t VertexIndex;
+#else
+/// Integer that identifies a vertex. Define `BASEGRAPH_64BIT_VERTEX_INDEX`
+/// (CMake option of the same name) to use 64-bit indices in graphs of more
+/// than \f$2^{32}-1\f$ vertices, at the cost of twice the memory per edge.
 typedef unsigned int VertexIndex;
+#endif
 
 /// Empty type used for unlabeled graphs.
 struct NoLabel {
@@ -19,11 +28,126 @@ struct NoLabel {
 /// Pair of vertex indices that represents an edge connecting `Edge::first` to
 /// `Edge::second`.
 typedef std::pair<VertexIndex, VertexIndex> Edge;
-/// Contains the out neighbours of a vertex.
-typedef std::list<VertexIndex> Successors;
-/// Contains the out neighbours of each vertex.
+
+/// Integer that identifies an edge of a compact graph. The edges of a graph of
+/// \f$E\f$ edges are identified by \f$0,\dots,E-1\f$ (see @ref EdgeProperty).
+typedef size_t EdgeId;
+
+/**
+ * Storage policy that keeps the neighbours of each vertex in a `std::list`.
+ * Iterators on the neighbours of a vertex remain valid when edges are added or
+ * removed. This is the default storage of every graph class.
+ */
+struct ListStorage {
+    template <typename T>
+    using Container = std::list<T>;
+    template <typename T, typename Allocator>
+    using AllocatedContainer = std::list<T, Allocator>;
+    static constexpr bool isSorted = false;
+};
+
+/**
+ * Storage policy that keeps the neighbours of each vertex contiguously in a
+ * `std::vector`. Each edge costs `sizeof(VertexIndex)` bytes and traversals
+ * are cache friendly. Iterators on the neighbours of a vertex are invalidated
+ * when its edges are added or removed.
+ */
+struct VectorStorage {
+    template <typename T>
+    using Container = std::vector<T>;
+    template <typename T, typename Allocator>
+    using AllocatedContainer = std::vector<T, Allocator>;
+    static constexpr bool isSorted = false;
+};
+
+/**
+ * Storage policy that keeps the neighbours of each vertex sorted in increasing
+ * order, in the container of \p Storage. Edge existence checks and edge
+ * removals use binary searches (logarithmic in the degree) and graph
+ * comparisons are linear in the number of edges. Inserting an edge moves the
+ * neighbours that follow it, so a contiguous \p Storage is recommended.
+ *
+ * For example:
+ * \code{.cpp}
+ * using namespace BaseGraph;
+ * LabeledDirectedGraph<NoLabel, SortedStorage<>> graph(5);
+ * \endcode
+ *
+ * @tparam Storage Policy that chooses the container of the neighbours.
+ */
+template <typename Storage = VectorStorage>
+struct SortedStorage {
+    template <typename T>
+    using Container = typename Storage::template Container<T>;
+    template <typename T, typename Allocator>
+    using AllocatedContainer =
+        typename Storage::template AllocatedContainer<T, Allocator>;
+    static constexpr bool isSorted = true;
+};
+
+/**
+ * Storage policy that allocates the neighbours and the edge labels of each
+ * vertex with \p Allocator, in the container of \p Storage. The containers
+ * are default constructed, so \p Allocator must be default constructible.
+ *
+ * For example, with a C++17 `std::pmr` memory resource:
+ * \code{.cpp}
+ * using namespace BaseGraph;
+ * LabeledDirectedGraph<
+ *     NoLabel, AllocatorStorage<std::pmr::polymorphic_allocator>>
+ *     graph(5);
+ * \endcode
+ * The containers of this graph allocate from the default memory resource at
+ * the time they are created. See @ref ArenaAllocator for an arena usable
+ * before C++17.
+ *
+ * @tparam Allocator Allocator template, instantiated with the type of the
+ * elements of each container.
+ * @tparam Storage Policy that chooses the container of the neighbours. It
+ * can be wrapped in (or wrap) @ref SortedStorage.
+ */
+template <template <typename> class Allocator, typename Storage = ListStorage>
+struct AllocatorStorage {
+    template <typename T>
+    using Container =
+        typename Storage::template AllocatedContainer<T, Allocator<T>>;
+    template <typename T, typename OtherAllocator>
+    using AllocatedContainer =
+        typename Storage::template AllocatedContainer<T, OtherAllocator>;
+    static constexpr bool isSorted = Storage::isSorted;
+};
+
+/// Contains the out neighbours of a vertex in the default storage.
+typedef ListStorage::Container<VertexIndex> Successors;
+/// Contains the out neighbours of each vertex in the default storage.
 typedef std::vector<Successors> AdjacencyLists;
 
+/**
+ * Read-only view of a contiguous sequence of elements. Used to expose the
+ * neighbours (and edge labels) of a vertex stored in a flat array, without
+ * copying them. The view is invalidated when the underlying array is
+ * destroyed.
+ */
+template <typename T>
+class ArrayView {
+    const T *first = nullptr;
+    const T *last = nullptr;
+
+  public:
+    typedef T value_type;
+    typedef const T *iterator;
+    typedef const T *const_iterator;
+
+    ArrayView() {}
+    ArrayView(const T *first, const T *last) : first(first), last(last) {}
+
+    const T *begin() const { return first; }
+    const T *end() const { return last; }
+    size_t size() const { return last - first; }
+    bool empty() const { return first == last; }
+    const T &operator[](size_t i) const { return first[i]; }
+};
+
 /// Contains an edge and its associated label in edge-labeled graphs.
 template <typename EdgeLabel>
 using LabeledEdge = std::tuple<VertexIndex, VertexIndex, EdgeLabel>;
@@ -34,6 +158,20 @@ typedef unsigned int EdgeMultiplicity;
 /// Weight of an edge in a weighted graph.
 typedef double EdgeWeight;
 
+/// Bytes allocated by a graph, excluding the memory owned by the edge labels
+/// themselves (e.g. the characters of a `std::string`).
+struct MemoryUsage {
+    /// Containers of the neighbours of each vertex (out and in neighbours).
+    size_t adjacency = 0;
+    /// Containers of the edge labels (weights, multiplicities, ...).
+    size_t labels = 0;
+    /// Graph object and per-vertex counters.
+    size_t bookkeeping = 0;
+
+    /// Returns the sum of every category.
+    size_t total() const { return adjacency + labels + bookkeeping; }
+};
+
 /// Matrix where element \f$ a_{ij} \f$ is the number of edges connecting vertex
 /// of index \f$ i \f$ to vertex of index \f$ j \f$ .
 typedef std::vector<std::vector<size_t>> AdjacencyMatrix;
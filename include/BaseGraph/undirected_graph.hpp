@@ -1,14 +1,11 @@
 #ifndef BASE_GRAPH_UNDIRECTED_GRAPH_HPP
 #define BASE_GRAPH_UNDIRECTED_GRAPH_HPP
 
-#include "BaseGraph/boost_hash.hpp"
 #include "BaseGraph/directed_graph.hpp"
 #include "BaseGraph/types.h"
 
 #include <iostream>
-#include <set>
 #include <stdexcept>
-#include <unordered_map>
 
 namespace BaseGraph {
 
@@ -16,23 +13,34 @@ namespace BaseGraph {
  * Undirected graph with edge labels, self-loops and without multiedges. When no
  *
  * Vertices are identified an integer index between 0 and \c size -1. Vertices
- * can be added using @ref resize. Vertices cannot be
- * removed because it requires reindexing. However, a vertex can be effectively
- * removed by erasing all of its edges with @ref
- * removeVertexFromEdgeList.
+ * can be added using @ref resize and removed with @ref removeVertices, which
+ * renumbers the remaining vertices. A vertex can also be isolated without
+ * reindexing by erasing all of its edges with @ref removeVertexFromEdgeList.
+ *
+ * The label of an edge is stored next to each of its two endpoints (once for a
+ * self-loop), in a container parallel to the neighbours of the vertex.
  *
  * @tparam EdgeLabel Container of edge information. Requires a default
  * constructor.
+ * @tparam Storage Policy that chooses the container of the neighbours of each
+ * vertex (e.g. @ref BaseGraph::ListStorage or @ref BaseGraph::VectorStorage).
  */
-template <typename EdgeLabel>
-class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
-    using Directed = LabeledDirectedGraph<EdgeLabel>;
+template <typename EdgeLabel, typename Storage = ListStorage>
+class LabeledUndirectedGraph
+    : protected LabeledDirectedGraph<EdgeLabel, Storage> {
+    using Directed = LabeledDirectedGraph<EdgeLabel, Storage>;
+
+    // Inserts neighbours at both endpoints from many threads.
+    template <typename Graph>
+    friend class ConcurrentEdgeInserter;
 
   public:
+    using typename Directed::EdgeLabels;
+    using typename Directed::Successors;
+
     /// Constructs an empty graph with \p size vertices.
     /// @param size Number of vertices.
-    explicit LabeledUndirectedGraph<EdgeLabel>(size_t size = 0)
-        : Directed(size) {}
+    explicit LabeledUndirectedGraph(size_t size = 0) : Directed(size) {}
 
     /**
      * Constructs a graph containing each in \p edgeSequence. The graph size is
@@ -53,19 +61,13 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
     template <
         template <class...> class Container, class... Args,
         typename U = EdgeLabel>
-    explicit LabeledUndirectedGraph<EdgeLabel>(
+    explicit LabeledUndirectedGraph(
         const Container<Edge, Args...> &edgeSequence,
         typename std::enable_if<
             std::is_same<U, NoLabel>::value, long long int>::type * = 0
     )
         : Directed(0) {
-        VertexIndex maxIndex = 0;
-        for (const Edge &edge : edgeSequence) {
-            maxIndex = std::max(edge.first, edge.second);
-            if (maxIndex >= getSize())
-                resize(maxIndex + 1);
-            addEdge(edge.first, edge.second);
-        }
+        addEdges(edgeSequence);
     }
 
     /**
@@ -86,26 +88,15 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
      * \endcode
      */
     template <template <class...> class Container, class... Args>
-    explicit LabeledUndirectedGraph<EdgeLabel>(
+    explicit LabeledUndirectedGraph(
         const Container<LabeledEdge<EdgeLabel>, Args...> &edgeSequence
     )
         : LabeledUndirectedGraph(0) {
-
-        VertexIndex maxIndex = 0;
-        for (const LabeledEdge<EdgeLabel> &labeledEdge : edgeSequence) {
-            maxIndex =
-                std::max(std::get<0>(labeledEdge), std::get<1>(labeledEdge));
-            if (maxIndex >= getSize())
-                resize(maxIndex + 1);
-            addEdge(
-                std::get<0>(labeledEdge), std::get<1>(labeledEdge),
-                std::get<2>(labeledEdge)
-            );
-        }
+        addEdges(edgeSequence);
     }
 
     /// Constructs a undirected graph containing each edge of \p directedGraph.
-    explicit LabeledUndirectedGraph<EdgeLabel>(const Directed &directedGraph)
+    explicit LabeledUndirectedGraph(const Directed &directedGraph)
         : LabeledUndirectedGraph(directedGraph.getSize()) {
         for (VertexIndex i : directedGraph)
             for (VertexIndex j : directedGraph.getOutNeighbours(i))
@@ -113,15 +104,25 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
     }
 
     using Directed::getEdgeNumber;
+    using Directed::getFingerprint;
+    using Directed::getMemoryUsage;
     using Directed::getSize;
+    using Directed::getVertexProperties;
     using Directed::resize;
+    using Directed::shrinkToFit;
+
+    /// @copydoc LabeledDirectedGraph::reserve
+    void reserve(size_t vertexCapacity, size_t edgeCapacity = 0) {
+        // Each edge is stored by both of its vertices.
+        Directed::reserve(vertexCapacity, 2 * edgeCapacity);
+    }
 
     /// @copydoc LabeledDirectedGraph::operator==
-    bool operator==(const LabeledUndirectedGraph<EdgeLabel> &other) const {
+    bool operator==(const LabeledUndirectedGraph &other) const {
         return Directed::operator==(other);
     }
     /// @copydoc LabeledDirectedGraph::operator!=
-    bool operator!=(const LabeledUndirectedGraph<EdgeLabel> &other) const {
+    bool operator!=(const LabeledUndirectedGraph &other) const {
         return !(this->operator==(other));
     }
 
@@ -154,6 +155,23 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
         addEdge(vertex1, vertex2, EdgeLabel(), force);
     }
 
+    /// @copydoc LabeledDirectedGraph::addEdges
+    template <typename Container>
+    void addEdges(const Container &edgeSequence, bool force = false) {
+        size_t requiredSize = getSize();
+        auto newEdges = Directed::gatherEdges(edgeSequence, true, requiredSize);
+        if (requiredSize > getSize())
+            resize(requiredSize);
+        Directed::insertEdges(
+            newEdges, force,
+            [&](VertexIndex vertex1, VertexIndex vertex2, const EdgeLabel &) {
+                if (vertex1 <= vertex2)
+                    ++Directed::edgeNumber;
+            },
+            typename Directed::IgnoreDuplicate()
+        );
+    }
+
     /// Returns if an edge of any label connects \p vertex1 to \p vertex2.
     bool hasEdge(VertexIndex vertex1, VertexIndex vertex2) const {
         auto edge = orderedEdge(vertex1, vertex2);
@@ -199,18 +217,31 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
     }
     /**
      * Changes the label of edge connecting \p vertex1 and \p vertex2.
+     * Duplicate edges all receive the new label.
      * @param vertex1, vertex2 Index of the vertices of the edge.
      * @param label New label value for the edge.
-     * @param force If `true`, the method will not check if the edge exists.
-     * This may create a label for an inexistent edge. If `false`, the method
-     * throws `std::invalid_argument` if the directed edge doesn't exist.
+     * @param force If `true`, the method does nothing when the edge doesn't
+     * exist. If `false`, the method throws `std::invalid_argument` if the
+     * edge doesn't exist.
      */
     void setEdgeLabel(
         VertexIndex vertex1, VertexIndex vertex2, const EdgeLabel &label,
         bool force = false
     ) {
-        auto edge = orderedEdge(vertex1, vertex2);
-        return Directed::setEdgeLabel(edge.first, edge.second, label, force);
+        assertVertexInRange(vertex1);
+        assertVertexInRange(vertex2);
+
+        if (setLabel(vertex1, vertex2, label) == 0 && !force)
+            throw std::invalid_argument("Cannot set label of inexistent edge.");
+    }
+
+    /// Returns the labels of the edges of \p vertex, in the same order as
+    /// @ref getNeighbours. Unavailable for unlabeled graphs.
+    template <typename... Dummy, typename U = EdgeLabel>
+    const typename std::enable_if<
+        !std::is_same<U, NoLabel>::value, EdgeLabels>::type &
+    getOutEdgeLabels(VertexIndex vertex) const {
+        return Directed::getOutEdgeLabels(vertex);
     }
 
     /// @copydoc LabeledDirectedGraph::removeDuplicateEdges
@@ -244,13 +275,38 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
 
     /// @copydoc LabeledDirectedGraph::getAdjacencyMatrix
     AdjacencyMatrix getAdjacencyMatrix(bool countSelfLoopsTwice = true) const;
+    /**
+     * Constructs the adjacency matrix in compressed sparse form in
+     * \f$O(V+E)\f$. The matrix is symmetric, so both orientations give the
+     * same arrays.
+     *
+     * @param countSelfLoopsTwice If `true`, the diagonal elements are twice
+     * the number of self-loops, as in @ref getAdjacencyMatrix.
+     * @param orientation Dimension along which the entries are grouped.
+     */
+    SparseMatrix<size_t> getSparseAdjacency(
+        bool countSelfLoopsTwice = true,
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const;
 
     /// Constructs a @ref LabeledDirectedGraph containing each reciprocal edge
     /// of the LabeledUndirectedGraph instance.
     Directed getDirectedGraph() const;
 
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    LabeledUndirectedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        LabeledUndirectedGraph permutedGraph;
+        static_cast<Directed &>(permutedGraph) =
+            Directed::getPermutedGraph(newIndices);
+        return permutedGraph;
+    }
+
     /// @copydoc LabeledDirectedGraph::removeVertexFromEdgeList
     void removeVertexFromEdgeList(VertexIndex vertex);
+    /// @copydoc LabeledDirectedGraph::removeVertices
+    std::vector<VertexIndex>
+    removeVertices(const std::vector<VertexIndex> &vertices);
 
     using Directed::assertVertexInRange;
     using Directed::begin;
@@ -259,7 +315,7 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
 
     /// @copydoc LabeledDirectedGraph::operator<<
     friend std::ostream &operator<<(
-        std::ostream &stream, const LabeledUndirectedGraph<EdgeLabel> &graph
+        std::ostream &stream, const LabeledUndirectedGraph &graph
     ) {
         stream << "Undirected graph of size: " << graph.getSize() << "\n"
                << "Neighbours of:\n";
@@ -278,12 +334,12 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
         struct constEdgeIterator {
             VertexIndex vertex;
             const VertexIndex endVertex;
-            Successors::const_iterator neighbour;
-            const LabeledUndirectedGraph<EdgeLabel> &graph;
+            typename Successors::const_iterator neighbour;
+            const LabeledUndirectedGraph &graph;
 
             constEdgeIterator(
-                const LabeledUndirectedGraph<EdgeLabel> &graph,
-                VertexIndex vertex, Successors::const_iterator neighbour
+                const LabeledUndirectedGraph &graph, VertexIndex vertex,
+                typename Successors::const_iterator neighbour
             )
                 : vertex(vertex), neighbour(neighbour), graph(graph),
                   endVertex(getEndVertex(graph)) {}
@@ -316,8 +372,8 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
                        vertex == endVertex;
             }
         };
-        const LabeledUndirectedGraph<EdgeLabel> &graph;
-        Edges(const LabeledUndirectedGraph<EdgeLabel> &graph) : graph(graph) {}
+        const LabeledUndirectedGraph &graph;
+        Edges(const LabeledUndirectedGraph &graph) : graph(graph) {}
 
         constEdgeIterator begin() const {
             VertexIndex endVertex = getEndVertex(graph);
@@ -339,8 +395,7 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
             );
         }
 
-        static VertexIndex
-        getEndVertex(const LabeledUndirectedGraph<EdgeLabel> &graph) {
+        static VertexIndex getEndVertex(const LabeledUndirectedGraph &graph) {
             auto vertexNumber = graph.getSize();
             if (vertexNumber == 0)
                 return 0;
@@ -355,109 +410,112 @@ class LabeledUndirectedGraph : protected LabeledDirectedGraph<EdgeLabel> {
     static Edge orderedEdge(VertexIndex i, VertexIndex j) {
         return i < j ? Edge{i, j} : Edge{j, i};
     }
-    void setLabel(VertexIndex i, VertexIndex j, const EdgeLabel &label) {
-        Directed::_setLabel(orderedEdge(i, j), label);
+    /// Sets the label stored at both endpoints of every edge connecting \p i
+    /// and \p j. Returns the number of such edges.
+    size_t setLabel(VertexIndex i, VertexIndex j, const EdgeLabel &label) {
+        auto assign = [&](EdgeLabel &current) { current = label; };
+        size_t edges = Directed::visitLabels(i, j, assign);
+        if (i != j)
+            Directed::visitLabels(j, i, assign);
+        return edges;
     }
 };
 
 /// Unlabeled undirected graph.
 using UndirectedGraph = LabeledUndirectedGraph<NoLabel>;
 
-template <typename EdgeLabel>
-void LabeledUndirectedGraph<EdgeLabel>::addEdge(
+template <typename EdgeLabel, typename Storage>
+void LabeledUndirectedGraph<EdgeLabel, Storage>::addEdge(
     VertexIndex vertex1, VertexIndex vertex2, const EdgeLabel &label, bool force
 ) {
     if (force || !hasEdge(vertex1, vertex2)) {
         if (vertex1 != vertex2)
-            Directed::adjacencyList[vertex1].push_back(vertex2);
-        Directed::adjacencyList[vertex2].push_back(vertex1);
-
-        setLabel(vertex1, vertex2, label);
+            Directed::edgeHashSum +=
+                Directed::insertNeighbour(vertex1, vertex2, label);
+        Directed::edgeHashSum +=
+            Directed::insertNeighbour(vertex2, vertex1, label);
         ++Directed::edgeNumber;
     }
 }
 
-template <typename EdgeLabel>
-void LabeledUndirectedGraph<EdgeLabel>::removeEdge(
+template <typename EdgeLabel, typename Storage>
+void LabeledUndirectedGraph<EdgeLabel, Storage>::removeEdge(
     VertexIndex vertex1, VertexIndex vertex2
 ) {
     assertVertexInRange(vertex1);
     assertVertexInRange(vertex2);
 
-    size_t sizeBefore = Directed::adjacencyList[vertex1].size();
-    Directed::adjacencyList[vertex1].remove(vertex2);
-    size_t sizeDifference =
-        sizeBefore - Directed::adjacencyList[vertex1].size();
+    size_t sizeDifference = Directed::eraseNeighbour(vertex1, vertex2);
 
-    if (sizeDifference > 0) {
-        Directed::adjacencyList[vertex2].remove(vertex1);
-        Directed::edgeNumber -= sizeDifference;
-        Directed::edgeLabels.erase(orderedEdge(vertex1, vertex2));
-    }
+    if (sizeDifference > 0 && vertex1 != vertex2)
+        Directed::eraseNeighbour(vertex2, vertex1);
+    Directed::edgeNumber -= sizeDifference;
 }
 
-template <typename EdgeLabel>
-void LabeledUndirectedGraph<EdgeLabel>::removeDuplicateEdges() {
-    std::set<VertexIndex> seenVertices;
-    Successors::iterator j;
-
-    for (VertexIndex i : *this) {
-        j = Directed::adjacencyList[i].begin();
-
-        while (j != Directed::adjacencyList[i].end()) {
-            if (!seenVertices.count(*j)) {
-                seenVertices.insert(*j);
-                ++j;
-            } else {
-                if (i <= *j) {
-                    --Directed::edgeNumber;
-                }
-                Directed::adjacencyList[i].erase(j++);
-            }
+template <typename EdgeLabel, typename Storage>
+void LabeledUndirectedGraph<EdgeLabel, Storage>::removeDuplicateEdges() {
+    Directed::eraseDuplicateEdges(
+        [&](VertexIndex i, VertexIndex j, EdgeLabel &, const EdgeLabel &) {
+            // Each edge is counted once, from its smallest vertex.
+            if (i <= j)
+                --Directed::edgeNumber;
         }
-        seenVertices.clear();
-    }
+    );
 }
 
-template <typename EdgeLabel>
-void LabeledUndirectedGraph<EdgeLabel>::removeVertexFromEdgeList(
+template <typename EdgeLabel, typename Storage>
+void LabeledUndirectedGraph<EdgeLabel, Storage>::removeVertexFromEdgeList(
     VertexIndex vertex
 ) {
     assertVertexInRange(vertex);
 
-    Successors::iterator j;
-    for (VertexIndex i : *this) {
-        j = Directed::adjacencyList[i].begin();
-        while (j != Directed::adjacencyList[i].end())
-            if (i == vertex || *j == vertex) {
-                if (i <= *j) {
+    for (VertexIndex i : *this)
+        Directed::eraseNeighboursIf(
+            i,
+            [&](VertexIndex j, const EdgeLabel &) {
+                if (i != vertex && j != vertex)
+                    return false;
+                if (i <= j)
                     --Directed::edgeNumber;
-                }
-                Directed::adjacencyList[i].erase(j++);
-            } else {
-                ++j;
+                return true;
             }
-    }
+        );
 }
 
-template <typename EdgeLabel>
-LabeledDirectedGraph<EdgeLabel>
-LabeledUndirectedGraph<EdgeLabel>::getDirectedGraph() const {
-    LabeledDirectedGraph<EdgeLabel> directedGraph(getSize());
-
-    for (auto edge : edges())
-        if (edge.first < edge.second)
-            directedGraph.addReciprocalEdge(edge.first, edge.second, true);
-        else if (edge.first == edge.second)
-            directedGraph.addEdge(
-                edge.first, edge.second, getEdgeLabel(edge.first, edge.second),
-                true
-            );
+template <typename EdgeLabel, typename Storage>
+std::vector<VertexIndex>
+LabeledUndirectedGraph<EdgeLabel, Storage>::removeVertices(
+    const std::vector<VertexIndex> &vertices
+) {
+    std::vector<VertexIndex> newIndices =
+        getIndicesAfterRemoval(vertices, getSize());
+    // Edges between two vertices are stored in both orientations.
+    Directed::compactVertices(
+        newIndices,
+        [&](VertexIndex i, VertexIndex j, const EdgeLabel &) {
+            if (i <= j)
+                --Directed::edgeNumber;
+        }
+    );
+    return newIndices;
+}
+
+template <typename EdgeLabel, typename Storage>
+LabeledDirectedGraph<EdgeLabel, Storage>
+LabeledUndirectedGraph<EdgeLabel, Storage>::getDirectedGraph() const {
+    Directed directedGraph(getSize());
+
+    // Each edge is stored at both of its endpoints and self-loops are stored
+    // once, which yields the reciprocal edges.
+    for (VertexIndex i : *this)
+        Directed::forEachOutEdge(i, [&](VertexIndex j, const EdgeLabel &label) {
+            directedGraph.addEdge(i, j, label, true);
+        });
     return directedGraph;
 }
 
-template <typename EdgeLabel>
-size_t LabeledUndirectedGraph<EdgeLabel>::getDegree(
+template <typename EdgeLabel, typename Storage>
+size_t LabeledUndirectedGraph<EdgeLabel, Storage>::getDegree(
     VertexIndex vertex, bool countSelfLoopsTwice
 ) const {
     assertVertexInRange(vertex);
@@ -471,9 +529,9 @@ size_t LabeledUndirectedGraph<EdgeLabel>::getDegree(
     return degree;
 }
 
-template <typename EdgeLabel>
-AdjacencyMatrix
-LabeledUndirectedGraph<EdgeLabel>::getAdjacencyMatrix(bool countSelfLoopsTwice
+template <typename EdgeLabel, typename Storage>
+AdjacencyMatrix LabeledUndirectedGraph<EdgeLabel, Storage>::getAdjacencyMatrix(
+    bool countSelfLoopsTwice
 ) const {
     const size_t &_size = getSize();
     AdjacencyMatrix adjacencyMatrix(_size, std::vector<size_t>(_size, 0));
@@ -485,6 +543,20 @@ LabeledUndirectedGraph<EdgeLabel>::getAdjacencyMatrix(bool countSelfLoopsTwice
     return adjacencyMatrix;
 }
 
+template <typename EdgeLabel, typename Storage>
+SparseMatrix<size_t>
+LabeledUndirectedGraph<EdgeLabel, Storage>::getSparseAdjacency(
+    bool countSelfLoopsTwice, SparseOrientation orientation
+) const {
+    SparseTriplets<size_t> triplets;
+    triplets.reserve(2 * getEdgeNumber());
+    for (auto i : *this)
+        for (auto j : getOutNeighbours(i))
+            triplets.addEntry(i, j, i == j && countSelfLoopsTwice ? 2 : 1);
+
+    return buildSparseMatrix(getSize(), triplets, orientation, SumEntries());
+}
+
 } // namespace BaseGraph
 
 #endif
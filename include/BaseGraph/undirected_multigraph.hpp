@@ -14,25 +14,49 @@ namespace BaseGraph {
  * Behaves nearly identically to @ref BaseGraph::UndirectedGraph. The main
  * difference is that @ref addEdge and @ref removeEdge count parallel edges
  * (multiedges). The number of parallel edges is stored in a @ref
- * BaseGraph::EdgeMultiplicity.
+ * BaseGraph::EdgeMultiplicity, next to the neighbour it applies to. The
+ * total multiplicity of the edges of each vertex is maintained, so that
+ * degrees are obtained in constant time.
+ *
+ * @tparam Storage Policy that chooses the container of the neighbours of each
+ * vertex. See @ref BaseGraph::LabeledUndirectedGraph.
  */
-class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
+template <typename Storage = ListStorage>
+class BasicUndirectedMultigraph
+    : private LabeledUndirectedGraph<EdgeMultiplicity, Storage> {
+  public:
+    using BaseClass = LabeledUndirectedGraph<EdgeMultiplicity, Storage>;
+
+  private:
+    using Directed = LabeledDirectedGraph<EdgeMultiplicity, Storage>;
+    using Directed::adjacencyLabels;
+    using Directed::edgeNumber;
+    using Directed::size;
+    using BaseClass::assertVertexInRange;
+    using BaseClass::getEdgeLabel;
     size_t totalEdgeNumber = 0;
+    /// Degree of each vertex, self-loops counted once.
+    std::vector<size_t> degrees;
+    std::vector<size_t> selfLoopMultiplicities;
 
   public:
-    using BaseClass = LabeledUndirectedGraph<EdgeMultiplicity>;
+    using typename BaseClass::Successors;
+    /// Contains the multiplicities of the edges of a vertex.
+    typedef typename BaseClass::EdgeLabels EdgeMultiplicities;
 
     /// @copydoc DirectedMultigraph::getEdgeNumber
     using BaseClass::begin;
     using BaseClass::edges;
     using BaseClass::end;
     using BaseClass::getEdgeNumber;
+    using BaseClass::getFingerprint;
     using BaseClass::getOutNeighbours;
     using BaseClass::getSize;
-    using BaseClass::resize;
+    using BaseClass::getVertexProperties;
 
     /// Constructs an empty graph with \p size vertices.
-    explicit UndirectedMultigraph(size_t size = 0) : BaseClass(size) {}
+    explicit BasicUndirectedMultigraph(size_t size = 0)
+        : BaseClass(size), degrees(size, 0), selfLoopMultiplicities(size, 0) {}
 
     /**
      * Constructs graph containing every vertex in \p multiedgeList. Graph size
@@ -53,32 +77,50 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
      * \endcode
      */
     template <template <class...> class Container, class... Args>
-    explicit UndirectedMultigraph(
+    explicit BasicUndirectedMultigraph(
         const Container<LabeledEdge<EdgeMultiplicity>, Args...> &multiedgeList
     )
         : BaseClass(0) {
+        addEdges(multiedgeList);
+    }
 
-        VertexIndex maxIndex = 0;
-        for (const auto &multiedge : multiedgeList) {
-            maxIndex = std::max(std::get<0>(multiedge), std::get<1>(multiedge));
-            if (maxIndex >= getSize())
-                resize(maxIndex + 1);
-            addMultiedge(
-                std::get<0>(multiedge), std::get<1>(multiedge),
-                std::get<2>(multiedge)
-            );
-        }
+    /// @copydoc LabeledDirectedGraph::resize
+    void resize(size_t newSize) {
+        BaseClass::resize(newSize);
+        degrees.resize(newSize, 0);
+        selfLoopMultiplicities.resize(newSize, 0);
+    }
+
+    /// @copydoc LabeledUndirectedGraph::reserve
+    void reserve(size_t vertexCapacity, size_t edgeCapacity = 0) {
+        BaseClass::reserve(vertexCapacity, edgeCapacity);
+        degrees.reserve(vertexCapacity);
+        selfLoopMultiplicities.reserve(vertexCapacity);
+    }
+    /// @copydoc LabeledDirectedGraph::shrinkToFit
+    void shrinkToFit() {
+        BaseClass::shrinkToFit();
+        degrees.shrink_to_fit();
+        selfLoopMultiplicities.shrink_to_fit();
+    }
+    /// @copydoc LabeledDirectedGraph::getMemoryUsage
+    MemoryUsage getMemoryUsage() const {
+        MemoryUsage usage = BaseClass::getMemoryUsage();
+        usage.bookkeeping += sizeof(*this) - sizeof(BaseClass) +
+                             degrees.capacity() * sizeof(size_t) +
+                             selfLoopMultiplicities.capacity() * sizeof(size_t);
+        return usage;
     }
 
     /// @copydoc DirectedMultigraph::getTotalEdgeNumber
     size_t getTotalEdgeNumber() const { return totalEdgeNumber; }
 
     /// @copydoc DirectedMultigraph::operator==
-    bool operator==(const UndirectedMultigraph &other) const {
+    bool operator==(const BasicUndirectedMultigraph &other) const {
         return BaseClass::operator==(other);
     }
     /// @copydoc DirectedMultigraph::operator!=
-    bool operator!=(const UndirectedMultigraph &other) const {
+    bool operator!=(const BasicUndirectedMultigraph &other) const {
         return BaseClass::operator!=(other);
     }
 
@@ -97,7 +139,8 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
      * unexpectedly in some algorithms. Remove duplicate edges with
      * @ref removeDuplicateEdges. Note that
      * @ref removeDuplicateEdges does not merge duplicate edges,
-     * it only removes them. <b>Duplicate edges are not multiedges</b>.
+     * it only removes them. Use @ref mergeDuplicateEdges to sum their
+     * multiplicities. <b>Duplicate edges are not multiedges</b>.
      *
      * @param vertex1, vertex2 Index of the vertices to connect.
      * @param multiplicity Edge multiplicity.
@@ -115,15 +158,64 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
         if (multiplicity == 0)
             return;
 
-        auto edgeExists = hasEdge(vertex1, vertex2);
-        if (force || !edgeExists) {
+        const EdgeMultiplicity *currentMultiplicity =
+            force ? nullptr : Directed::findLabel(vertex1, vertex2);
+        if (currentMultiplicity == nullptr)
             BaseClass::addEdge(vertex1, vertex2, multiplicity, true);
-            totalEdgeNumber += multiplicity;
-        } else if (edgeExists) {
-            totalEdgeNumber += multiplicity;
-            BaseClass::edgeLabels[orderedEdge(vertex1, vertex2)] +=
-                multiplicity;
-        }
+        else
+            storeMultiplicity(
+                vertex1, vertex2, *currentMultiplicity + multiplicity
+            );
+        addToDegrees(vertex1, vertex2, multiplicity);
+    }
+
+    /**
+     * Adds each multiedge of \p edgeSequence as @ref addMultiedge would, and
+     * adjusts the graph size to the largest index in \p edgeSequence. The
+     * multiplicities of repeated edges are summed. See @ref
+     * LabeledDirectedGraph::addEdges for the complexity.
+     *
+     * @tparam Container Any container of @ref BaseGraph::Edge (of
+     * multiplicity 1) or of
+     * BaseGraph::LabeledEdge<BaseGraph::EdgeMultiplicity> that supports
+     * range-based loops.
+     * @param edgeSequence Multiedges to add.
+     * @param force If \c false, the multiplicity of an edge that already
+     * exists (in the graph or earlier in \p edgeSequence) is increased. If
+     * \c true, every multiedge is added as a new edge.
+     */
+    template <typename Container>
+    void addEdges(const Container &edgeSequence, bool force = false) {
+        size_t requiredSize = size;
+        auto newEdges =
+            Directed::gatherEdges(edgeSequence, true, requiredSize, 1);
+        if (requiredSize > size)
+            resize(requiredSize);
+        newEdges.erase(
+            std::remove_if(
+                newEdges.begin(), newEdges.end(),
+                [](const LabeledEdge<EdgeMultiplicity> &edge) {
+                    return std::get<2>(edge) == 0;
+                }
+            ),
+            newEdges.end()
+        );
+        Directed::insertEdges(
+            newEdges, force,
+            [&](VertexIndex vertex1, VertexIndex vertex2,
+                EdgeMultiplicity multiplicity) {
+                if (vertex1 <= vertex2) {
+                    ++edgeNumber;
+                    addToDegrees(vertex1, vertex2, multiplicity);
+                }
+            },
+            [&](VertexIndex vertex1, VertexIndex vertex2,
+                EdgeMultiplicity &stored, EdgeMultiplicity multiplicity) {
+                stored += multiplicity;
+                if (vertex1 <= vertex2)
+                    addToDegrees(vertex1, vertex2, multiplicity);
+            }
+        );
     }
 
     /// @copydoc DirectedMultigraph::removeEdge
@@ -144,26 +236,22 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
         assertVertexInRange(vertex1);
         assertVertexInRange(vertex2);
 
-        const auto &neighbours = getOutNeighbours(vertex1);
-        for (auto j = neighbours.begin(); j != neighbours.end(); ++j) {
-            if (*j != vertex2)
-                continue;
-
-            auto &currentMultiplicity =
-                edgeLabels[orderedEdge(vertex1, vertex2)];
-            if (currentMultiplicity > multiplicity) {
-                currentMultiplicity -= multiplicity;
-                totalEdgeNumber -= multiplicity;
-            } else {
-                edgeNumber--;
-                totalEdgeNumber -= currentMultiplicity;
-                adjacencyList[vertex1].erase(j);
-
-                if (vertex1 != vertex2)
-                    adjacencyList[vertex2].remove(vertex1);
-                edgeLabels.erase(orderedEdge(vertex1, vertex2));
-            }
-            break;
+        const EdgeMultiplicity *currentMultiplicity =
+            Directed::findLabel(vertex1, vertex2);
+        if (currentMultiplicity == nullptr)
+            return;
+
+        if (*currentMultiplicity > multiplicity) {
+            storeMultiplicity(
+                vertex1, vertex2, *currentMultiplicity - multiplicity
+            );
+            subtractFromDegrees(vertex1, vertex2, multiplicity);
+        } else {
+            edgeNumber--;
+            subtractFromDegrees(vertex1, vertex2, *currentMultiplicity);
+            Directed::eraseFirstNeighbour(vertex1, vertex2);
+            if (vertex1 != vertex2)
+                Directed::eraseFirstNeighbour(vertex2, vertex1);
         }
     }
 
@@ -180,9 +268,15 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
         assertVertexInRange(vertex1);
         assertVertexInRange(vertex2);
 
-        return edgeLabels.count(orderedEdge(vertex1, vertex2)) == 0
-                   ? 0
-                   : getEdgeLabel(vertex1, vertex2);
+        const EdgeMultiplicity *multiplicity =
+            Directed::findLabel(vertex1, vertex2);
+        return multiplicity == nullptr ? 0 : *multiplicity;
+    }
+    /// Returns the multiplicities of the edges of \p vertex, in the same order
+    /// as @ref getOutNeighbours.
+    const EdgeMultiplicities &getOutEdgeMultiplicities(VertexIndex vertex
+    ) const {
+        return BaseClass::getOutEdgeLabels(vertex);
     }
     /**
      * Change the multiplicity of the edge connecting \p vertex1 and \p
@@ -199,14 +293,22 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
         assertVertexInRange(vertex2);
 
         if (multiplicity == 0) {
-            removeEdge(vertex1, vertex2);
-        } else if (hasEdge(vertex1, vertex2)) {
-            auto &currentMultiplicity =
-                edgeLabels[orderedEdge(vertex1, vertex2)];
-            totalEdgeNumber +=
-                ((long long int)multiplicity -
-                 (long long int)currentMultiplicity);
-            currentMultiplicity = multiplicity;
+            removeAllEdges(vertex1, vertex2);
+            return;
+        }
+
+        const EdgeMultiplicity *currentMultiplicity =
+            Directed::findLabel(vertex1, vertex2);
+        if (currentMultiplicity != nullptr) {
+            if (multiplicity > *currentMultiplicity)
+                addToDegrees(
+                    vertex1, vertex2, multiplicity - *currentMultiplicity
+                );
+            else
+                subtractFromDegrees(
+                    vertex1, vertex2, *currentMultiplicity - multiplicity
+                );
+            storeMultiplicity(vertex1, vertex2, multiplicity);
         } else {
             addMultiedge(vertex1, vertex2, multiplicity, true);
         }
@@ -214,24 +316,27 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
 
     /// @copydoc DirectedMultigraph::removeDuplicateEdges
     void removeDuplicateEdges() {
-        for (VertexIndex i : *this) {
-            std::set<VertexIndex> seenVertices;
-            auto j = BaseClass::adjacencyList[i].begin();
-
-            while (j != BaseClass::adjacencyList[i].end()) {
-                if (!seenVertices.count(*j)) {
-                    seenVertices.insert(*j);
-                    ++j;
-                } else {
-                    if (i <= *j) {
-                        totalEdgeNumber -= getEdgeLabel(i, *j, false);
-                        --BaseClass::edgeNumber;
-                    }
-                    BaseClass::adjacencyList[i].erase(j++);
+        Directed::eraseDuplicateEdges(
+            [&](VertexIndex i, VertexIndex j, EdgeMultiplicity &,
+                EdgeMultiplicity multiplicity) {
+                if (i <= j) {
+                    subtractFromDegrees(i, j, multiplicity);
+                    --edgeNumber;
                 }
             }
-            seenVertices.clear();
-        }
+        );
+    }
+    /// @copydoc DirectedMultigraph::mergeDuplicateEdges
+    void mergeDuplicateEdges() {
+        Directed::eraseDuplicateEdges(
+            [&](VertexIndex i, VertexIndex j, EdgeMultiplicity &stored,
+                EdgeMultiplicity multiplicity) {
+                // Both orientations are merged, but the edge is counted once.
+                stored += multiplicity;
+                if (i <= j)
+                    --edgeNumber;
+            }
+        );
     }
 
     /// @copydoc DirectedMultigraph::removeSelfLoops
@@ -244,28 +349,48 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
     void removeVertexFromEdgeList(VertexIndex vertex) {
         assertVertexInRange(vertex);
 
-        Successors::iterator j;
-        for (VertexIndex i : *this) {
-            j = BaseClass::adjacencyList[i].begin();
-            while (j != BaseClass::adjacencyList[i].end())
-                if (i == vertex || *j == vertex) {
-                    if (i <= *j) {
-                        totalEdgeNumber -= getEdgeLabel(i, *j, false);
-                        --BaseClass::edgeNumber;
+        for (VertexIndex i : *this)
+            Directed::eraseNeighboursIf(
+                i,
+                [&](VertexIndex j, EdgeMultiplicity multiplicity) {
+                    if (i != vertex && j != vertex)
+                        return false;
+                    if (i <= j) {
+                        subtractFromDegrees(i, j, multiplicity);
+                        --edgeNumber;
                     }
-                    BaseClass::adjacencyList[i].erase(j++);
-                } else {
-                    ++j;
+                    return true;
                 }
-        }
+            );
+    }
+
+    /// @copydoc LabeledDirectedGraph::removeVertices
+    std::vector<VertexIndex>
+    removeVertices(const std::vector<VertexIndex> &vertices) {
+        std::vector<VertexIndex> newIndices =
+            getIndicesAfterRemoval(vertices, getSize());
+        Directed::compactVertices(
+            newIndices,
+            [&](VertexIndex i, VertexIndex j, EdgeMultiplicity multiplicity) {
+                if (i <= j) {
+                    subtractFromDegrees(i, j, multiplicity);
+                    --edgeNumber;
+                }
+            }
+        );
+        applyIndicesAfterRemoval(degrees, newIndices);
+        applyIndicesAfterRemoval(selfLoopMultiplicities, newIndices);
+        return newIndices;
     }
 
     /// @copydoc DirectedMultigraph::clearEdges
     void clearEdges() {
-        for (VertexIndex i : *this)
-            adjacencyList[i].clear();
-        edgeNumber = 0;
+        BaseClass::clearEdges();
         totalEdgeNumber = 0;
+        std::fill(degrees.begin(), degrees.end(), 0);
+        std::fill(
+            selfLoopMultiplicities.begin(), selfLoopMultiplicities.end(), 0
+        );
     }
 
     /// @copydoc DirectedMultigraph::asLabeledGraph
@@ -273,36 +398,69 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
         return static_cast<const BaseClass &>(*this);
     }
 
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    BasicUndirectedMultigraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        BasicUndirectedMultigraph permutedGraph;
+        static_cast<BaseClass &>(permutedGraph) =
+            BaseClass::getPermutedGraph(newIndices);
+        permutedGraph.totalEdgeNumber = totalEdgeNumber;
+        permutedGraph.degrees.resize(size);
+        permutedGraph.selfLoopMultiplicities.resize(size);
+        for (VertexIndex i = 0; i < size; ++i) {
+            permutedGraph.degrees[newIndices[i]] = degrees[i];
+            permutedGraph.selfLoopMultiplicities[newIndices[i]] =
+                selfLoopMultiplicities[i];
+        }
+        return permutedGraph;
+    }
+
     /// @copydoc DirectedMultigraph::getAdjacencyMatrix
     AdjacencyMatrix getAdjacencyMatrix(bool countSelfLoopsTwice = true) const {
         AdjacencyMatrix adjacencyMatrix;
         adjacencyMatrix.resize(size, std::vector<size_t>(size, 0));
 
         for (VertexIndex i = 0; i < size; ++i)
-            for (auto &j : getOutNeighbours(i)) {
-                const auto &multiplicity = getEdgeLabel(i, j);
-                adjacencyMatrix[i][j] += i == j && countSelfLoopsTwice
-                                             ? 2 * multiplicity
-                                             : multiplicity;
-            }
+            Directed::forEachOutEdge(
+                i,
+                [&](VertexIndex j, EdgeMultiplicity multiplicity) {
+                    adjacencyMatrix[i][j] += i == j && countSelfLoopsTwice
+                                                 ? 2 * multiplicity
+                                                 : multiplicity;
+                }
+            );
         return adjacencyMatrix;
     }
 
-    /// Counts the number of edges connected to @p vertex, including parallel
+    /// @copydoc LabeledUndirectedGraph::getSparseAdjacency
+    /// The elements are edge multiplicities.
+    SparseMatrix<size_t> getSparseAdjacency(
+        bool countSelfLoopsTwice = true,
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<size_t> triplets;
+        for (VertexIndex i = 0; i < size; ++i)
+            Directed::forEachOutEdge(
+                i,
+                [&](VertexIndex j, EdgeMultiplicity multiplicity) {
+                    triplets.addEntry(
+                        i, j,
+                        i == j && countSelfLoopsTwice ? 2 * multiplicity
+                                                      : multiplicity
+                    );
+                }
+            );
+        return buildSparseMatrix(size, triplets, orientation, SumEntries());
+    }
+
+    /// Returns the number of edges connected to @p vertex, including parallel
     /// edges.
     size_t
     getDegree(VertexIndex vertex, bool countSelfLoopsTwice = true) const {
         assertVertexInRange(vertex);
-        size_t degree = 0;
-        EdgeMultiplicity multiplicity;
-
-        for (auto &neighbour : getNeighbours(vertex)) {
-            multiplicity = getEdgeMultiplicity(vertex, neighbour);
-            degree += countSelfLoopsTwice && vertex == neighbour
-                          ? 2 * multiplicity
-                          : multiplicity;
-        }
-        return degree;
+        return countSelfLoopsTwice
+                   ? degrees[vertex] + selfLoopMultiplicities[vertex]
+                   : degrees[vertex];
     }
 
     /// Counts the number of edges connected to each vertex, including parallel
@@ -316,15 +474,15 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
 
     /// @copydoc DirectedMultigraph::operator<<
     friend std::ostream &
-    operator<<(std::ostream &stream, const UndirectedMultigraph &graph) {
+    operator<<(std::ostream &stream, const BasicUndirectedMultigraph &graph) {
         stream << "UndirectedMultigraph of size: " << graph.getSize() << "\n"
                << "Neighbours of:\n";
 
         for (VertexIndex i : graph) {
             stream << i << ": ";
+            auto multiplicity = graph.getOutEdgeMultiplicities(i).begin();
             for (auto &neighbour : graph.getOutNeighbours(i))
-                stream << neighbour << "("
-                       << graph.getEdgeMultiplicity(i, neighbour) << "), ";
+                stream << neighbour << "(" << *multiplicity++ << "), ";
             stream << "\n";
         }
         return stream;
@@ -335,21 +493,64 @@ class UndirectedMultigraph : private LabeledUndirectedGraph<EdgeMultiplicity> {
         assertVertexInRange(vertex1);
         assertVertexInRange(vertex2);
 
-        size_t sizeBefore = BaseClass::adjacencyList[vertex1].size();
-        BaseClass::adjacencyList[vertex1].remove(vertex2);
-        size_t sizeDifference =
-            sizeBefore - BaseClass::adjacencyList[vertex1].size();
-
-        if (sizeDifference > 0) {
-            BaseClass::adjacencyList[vertex2].remove(vertex1);
-            BaseClass::edgeNumber -= sizeDifference;
-            totalEdgeNumber -=
-                getEdgeLabel(vertex1, vertex2, false) * sizeDifference;
-            BaseClass::edgeLabels.erase(orderedEdge(vertex1, vertex2));
-        }
+        size_t sizeDifference = Directed::eraseNeighbour(
+            vertex1, vertex2,
+            [&](VertexIndex, EdgeMultiplicity multiplicity) {
+                subtractFromDegrees(vertex1, vertex2, multiplicity);
+            }
+        );
+
+        if (sizeDifference > 0 && vertex1 != vertex2)
+            Directed::eraseNeighbour(vertex2, vertex1);
+        edgeNumber -= sizeDifference;
+    }
+
+    /// Counts \p multiplicity more edges connecting \p vertex1 and \p
+    /// vertex2.
+    void addToDegrees(
+        VertexIndex vertex1, VertexIndex vertex2, EdgeMultiplicity multiplicity
+    ) {
+        degrees[vertex1] += multiplicity;
+        if (vertex1 != vertex2)
+            degrees[vertex2] += multiplicity;
+        else
+            selfLoopMultiplicities[vertex1] += multiplicity;
+        totalEdgeNumber += multiplicity;
+    }
+
+    /// Counts \p multiplicity less edges connecting \p vertex1 and \p
+    /// vertex2.
+    void subtractFromDegrees(
+        VertexIndex vertex1, VertexIndex vertex2, EdgeMultiplicity multiplicity
+    ) {
+        degrees[vertex1] -= multiplicity;
+        if (vertex1 != vertex2)
+            degrees[vertex2] -= multiplicity;
+        else
+            selfLoopMultiplicities[vertex1] -= multiplicity;
+        totalEdgeNumber -= multiplicity;
+    }
+
+    /// Sets the multiplicity stored at both endpoints of the first edge
+    /// connecting \p vertex1 and \p vertex2, which must exist.
+    void storeMultiplicity(
+        VertexIndex vertex1, VertexIndex vertex2, EdgeMultiplicity multiplicity
+    ) {
+        Directed::replaceLabel(
+            vertex1, vertex2, *Directed::findLabel(vertex1, vertex2),
+            multiplicity
+        );
+        if (vertex1 != vertex2)
+            Directed::replaceLabel(
+                vertex2, vertex1, *Directed::findLabel(vertex2, vertex1),
+                multiplicity
+            );
     }
 };
 
+/// Undirected multigraph with the default storage.
+using UndirectedMultigraph = BasicUndirectedMultigraph<>;
+
 } // namespace BaseGraph
 
 #endif
@@ -12,19 +12,40 @@ namespace BaseGraph {
  * Behaves nearly identically to @ref BaseGraph::LabeledUndirectedGraph. The
  * difference is that each edge must have a weight stored in a @ref
  * EdgeMultiplicity.
+ *
+ * @tparam Storage Policy that chooses the container of the neighbours of each
+ * vertex. See @ref BaseGraph::LabeledUndirectedGraph.
  */
-class UndirectedWeightedGraph : private LabeledUndirectedGraph<EdgeWeight> {
-    using BaseClass = LabeledUndirectedGraph<double>;
+template <typename Storage = ListStorage>
+class BasicUndirectedWeightedGraph
+    : private LabeledUndirectedGraph<EdgeWeight, Storage> {
+    using BaseClass = LabeledUndirectedGraph<EdgeWeight, Storage>;
+    using Directed = LabeledDirectedGraph<EdgeWeight, Storage>;
+    using BaseClass::adjacencyList;
+    using BaseClass::edgeHashSum;
+    using BaseClass::edgeNumber;
+    using BaseClass::size;
+    using BaseClass::assertVertexInRange;
+    using BaseClass::getEdgeLabel;
     long double totalWeight = 0;
 
   public:
+    using typename BaseClass::Successors;
+    /// Contains the weights of the edges of a vertex.
+    typedef typename BaseClass::EdgeLabels EdgeWeights;
     using BaseClass::begin;
     using BaseClass::edges;
     using BaseClass::end;
     using BaseClass::getAdjacencyMatrix;
+    using BaseClass::getSparseAdjacency;
     using BaseClass::getEdgeNumber;
+    using BaseClass::getFingerprint;
+    using BaseClass::getMemoryUsage;
+    using BaseClass::reserve;
+    using BaseClass::shrinkToFit;
     using BaseClass::getOutNeighbours;
     using BaseClass::getSize;
+    using BaseClass::getVertexProperties;
     using BaseClass::resize;
     /// @copydoc LabeledUndirectedGraph::getDegree
     /// Doesn't consider the edge weights.
@@ -34,7 +55,8 @@ class UndirectedWeightedGraph : private LabeledUndirectedGraph<EdgeWeight> {
     using BaseClass::getDegrees;
     using BaseClass::hasEdge;
 
-    explicit UndirectedWeightedGraph(size_t size = 0) : BaseClass(size) {}
+    explicit BasicUndirectedWeightedGraph(size_t size = 0)
+        : BaseClass(size) {}
 
     /**
      * Constructs a graph containing each edge in \p edgeSequence. The graph
@@ -53,32 +75,22 @@ class UndirectedWeightedGraph : private LabeledUndirectedGraph<EdgeWeight> {
      * \endcode
      */
     template <template <class...> class Container, class... Args>
-    explicit UndirectedWeightedGraph(
-        const Container<LabeledEdge<EdgeMultiplicity>, Args...> &multiedgeList
+    explicit BasicUndirectedWeightedGraph(
+        const Container<LabeledEdge<EdgeWeight>, Args...> &weightedEdgeList
     )
         : BaseClass(0) {
-
-        VertexIndex maxIndex = 0;
-        for (const auto &multiedge : multiedgeList) {
-            maxIndex = std::max(std::get<0>(multiedge), std::get<1>(multiedge));
-            if (maxIndex >= getSize())
-                resize(maxIndex + 1);
-            addMultiedge(
-                std::get<0>(multiedge), std::get<1>(multiedge),
-                std::get<2>(multiedge)
-            );
-        }
+        addEdges(weightedEdgeList);
     }
 
     /// @copydoc DirectedWeightedGraph::getTotalWeight
     EdgeWeight getTotalWeight() const { return totalWeight; }
 
     /// @copydoc DirectedWeightedGraph::operator==
-    bool operator==(const UndirectedWeightedGraph &other) const {
+    bool operator==(const BasicUndirectedWeightedGraph &other) const {
         return BaseClass::operator==(other);
     }
     /// @copydoc DirectedWeightedGraph::operator!=
-    bool operator!=(const UndirectedWeightedGraph &other) const {
+    bool operator!=(const BasicUndirectedWeightedGraph &other) const {
         return BaseClass::operator!=(other);
     }
 
@@ -103,30 +115,46 @@ class UndirectedWeightedGraph : private LabeledUndirectedGraph<EdgeWeight> {
     ) {
         if (force || !hasEdge(vertex1, vertex2)) {
             if (vertex1 != vertex2)
-                adjacencyList[vertex1].push_back(vertex2);
-            adjacencyList[vertex2].push_back(vertex1);
-            setLabel(vertex1, vertex2, weight);
+                edgeHashSum +=
+                    Directed::insertNeighbour(vertex1, vertex2, weight);
+            edgeHashSum += Directed::insertNeighbour(vertex2, vertex1, weight);
             ++edgeNumber;
             totalWeight += weight;
         }
     }
 
+    /// @copydoc LabeledDirectedGraph::addEdges
+    template <typename Container>
+    void addEdges(const Container &edgeSequence, bool force = false) {
+        size_t requiredSize = size;
+        auto newEdges = Directed::gatherEdges(edgeSequence, true, requiredSize);
+        if (requiredSize > size)
+            resize(requiredSize);
+        Directed::insertEdges(
+            newEdges, force,
+            [&](VertexIndex vertex1, VertexIndex vertex2, EdgeWeight weight) {
+                if (vertex1 <= vertex2) {
+                    ++edgeNumber;
+                    totalWeight += weight;
+                }
+            },
+            typename Directed::IgnoreDuplicate()
+        );
+    }
+
     /// @copydoc LabeledDirectedGraph::removeEdge
     void removeEdge(VertexIndex vertex1, VertexIndex vertex2) {
         assertVertexInRange(vertex1);
         assertVertexInRange(vertex2);
 
-        size_t sizeBefore = adjacencyList[vertex1].size();
-        adjacencyList[vertex1].remove(vertex2);
-        size_t sizeDifference = sizeBefore - adjacencyList[vertex1].size();
+        size_t sizeDifference = Directed::eraseNeighbour(
+            vertex1, vertex2,
+            [&](VertexIndex, EdgeWeight weight) { totalWeight -= weight; }
+        );
 
-        if (sizeDifference > 0) {
-            adjacencyList[vertex2].remove(vertex1);
-            edgeNumber -= sizeDifference;
-            totalWeight -=
-                getEdgeLabel(vertex1, vertex2, false) * sizeDifference;
-            edgeLabels.erase(orderedEdge(vertex1, vertex2));
-        }
+        if (sizeDifference > 0 && vertex1 != vertex2)
+            Directed::eraseNeighbour(vertex2, vertex1);
+        edgeNumber -= sizeDifference;
     }
 
     /// Returns the weight of an edge connnecting \p vertex1 to \p vertex2.
@@ -137,18 +165,34 @@ class UndirectedWeightedGraph : private LabeledUndirectedGraph<EdgeWeight> {
         return getEdgeLabel(vertex1, vertex2, throwIfInexistent);
     }
 
+    /// Returns the weights of the edges of \p vertex, in the same order as
+    /// @ref getOutNeighbours.
+    const EdgeWeights &getOutEdgeWeights(VertexIndex vertex) const {
+        return BaseClass::getOutEdgeLabels(vertex);
+    }
+
     /// Changes the weight of the edge connecting \p vertex1 and \p vertex2 to
     /// \p newWeight. If the edge doesn't exist, it is created.
     void setEdgeWeight(
         VertexIndex vertex1, VertexIndex vertex2, EdgeWeight newWeight
     ) {
-        if (hasEdge(vertex1, vertex2)) {
-            auto &currentWeight = edgeLabels[{vertex1, vertex2}];
-            totalWeight += newWeight - currentWeight;
-            currentWeight = newWeight;
-        } else {
+        assertVertexInRange(vertex1);
+        assertVertexInRange(vertex2);
+
+        size_t edges = Directed::visitLabels(
+            vertex1, vertex2,
+            [&](EdgeWeight &currentWeight) {
+                totalWeight += newWeight - currentWeight;
+                currentWeight = newWeight;
+            }
+        );
+        if (edges == 0)
             addEdge(vertex1, vertex2, newWeight);
-        }
+        else if (vertex1 != vertex2)
+            Directed::visitLabels(
+                vertex2, vertex1,
+                [&](EdgeWeight &currentWeight) { currentWeight = newWeight; }
+            );
     }
 
     /// @copydoc DirectedWeightedGraph::removeSelfLoops
@@ -159,44 +203,50 @@ class UndirectedWeightedGraph : private LabeledUndirectedGraph<EdgeWeight> {
 
     /// @copydoc DirectedWeightedGraph::removeDuplicateEdges
     void removeDuplicateEdges() {
-        for (VertexIndex i : *this) {
-            std::set<VertexIndex> seenVertices;
-            auto j = adjacencyList[i].begin();
-
-            while (j != adjacencyList[i].end()) {
-                if (!seenVertices.count(*j)) {
-                    seenVertices.insert(*j);
-                    ++j;
-                } else {
-                    if (i <= *j) {
-                        totalWeight -= getEdgeLabel(i, *j, false);
-                        --edgeNumber;
-                    }
-                    adjacencyList[i].erase(j++);
+        Directed::eraseDuplicateEdges(
+            [&](VertexIndex i, VertexIndex j, EdgeWeight &, EdgeWeight weight) {
+                if (i <= j) {
+                    totalWeight -= weight;
+                    --edgeNumber;
                 }
             }
-            seenVertices.clear();
-        }
+        );
     }
 
     /// @copydoc DirectedWeightedGraph::removeVertexFromEdgeList
     void removeVertexFromEdgeList(VertexIndex vertex) {
         assertVertexInRange(vertex);
 
-        Successors::iterator j;
-        for (VertexIndex i : *this) {
-            j = adjacencyList[i].begin();
-            while (j != adjacencyList[i].end())
-                if (i == vertex || *j == vertex) {
-                    if (i <= *j) {
-                        totalWeight -= getEdgeLabel(i, *j, false);
+        for (VertexIndex i : *this)
+            Directed::eraseNeighboursIf(
+                i,
+                [&](VertexIndex j, EdgeWeight weight) {
+                    if (i != vertex && j != vertex)
+                        return false;
+                    if (i <= j) {
+                        totalWeight -= weight;
                         --edgeNumber;
                     }
-                    adjacencyList[i].erase(j++);
-                } else {
-                    ++j;
+                    return true;
                 }
-        }
+            );
+    }
+
+    /// @copydoc LabeledDirectedGraph::removeVertices
+    std::vector<VertexIndex>
+    removeVertices(const std::vector<VertexIndex> &vertices) {
+        std::vector<VertexIndex> newIndices =
+            getIndicesAfterRemoval(vertices, getSize());
+        Directed::compactVertices(
+            newIndices,
+            [&](VertexIndex i, VertexIndex j, EdgeWeight weight) {
+                if (i <= j) {
+                    totalWeight -= weight;
+                    --edgeNumber;
+                }
+            }
+        );
+        return newIndices;
     }
 
     /// @copydoc DirectedWeightedGraph::clearEdges
@@ -210,6 +260,16 @@ class UndirectedWeightedGraph : private LabeledUndirectedGraph<EdgeWeight> {
         return static_cast<const BaseClass &>(*this);
     }
 
+    /// @copydoc LabeledDirectedGraph::getPermutedGraph
+    BasicUndirectedWeightedGraph
+    getPermutedGraph(const std::vector<VertexIndex> &newIndices) const {
+        BasicUndirectedWeightedGraph permutedGraph;
+        static_cast<BaseClass &>(permutedGraph) =
+            BaseClass::getPermutedGraph(newIndices);
+        permutedGraph.totalWeight = totalWeight;
+        return permutedGraph;
+    }
+
     /// @copydoc DirectedWeightedGraph::getWeightMatrix
     WeightMatrix getWeightMatrix() const {
         WeightMatrix weightMatrix(
@@ -217,28 +277,49 @@ class UndirectedWeightedGraph : private LabeledUndirectedGraph<EdgeWeight> {
         );
 
         for (VertexIndex i = 0; i < size; ++i)
-            for (auto &j : getOutNeighbours(i))
-                weightMatrix[i][j] = getEdgeWeight(i, j);
+            Directed::forEachOutEdge(i, [&](VertexIndex j, EdgeWeight weight) {
+                weightMatrix[i][j] = weight;
+            });
         return weightMatrix;
     }
 
+    /// Constructs the weight matrix in compressed sparse form in
+    /// \f$O(V+E)\f$. The matrix is symmetric, so both orientations give the
+    /// same arrays.
+    SparseMatrix<EdgeWeight> getSparseWeights(
+        SparseOrientation orientation = SparseOrientation::Rows
+    ) const {
+        SparseTriplets<EdgeWeight> triplets;
+        triplets.reserve(2 * edgeNumber);
+        for (VertexIndex i = 0; i < size; ++i)
+            Directed::forEachOutEdge(i, [&](VertexIndex j, EdgeWeight weight) {
+                triplets.addEntry(i, j, weight);
+            });
+        return buildSparseMatrix(size, triplets, orientation, KeepLastEntry());
+    }
+
     /// @copydoc DirectedWeightedGraph::operator<<
     friend std::ostream &
-    operator<<(std::ostream &stream, const UndirectedWeightedGraph &graph) {
+    operator<<(
+        std::ostream &stream, const BasicUndirectedWeightedGraph &graph
+    ) {
         stream << "UndirectedWeightedGraph of size: " << graph.getSize() << "\n"
                << "Neighbours of:\n";
 
         for (VertexIndex i : graph) {
             stream << i << ": ";
+            auto weight = graph.getOutEdgeWeights(i).begin();
             for (auto &neighbour : graph.getOutNeighbours(i))
-                stream << neighbour << "(" << graph.getEdgeWeight(i, neighbour)
-                       << "), ";
+                stream << neighbour << "(" << *weight++ << "), ";
             stream << "\n";
         }
         return stream;
     }
 };
 
+/// Undirected weighted graph with the default storage.
+using UndirectedWeightedGraph = BasicUndirectedWeightedGraph<>;
+
 } // namespace BaseGraph
 
 #endif
@@ -0,0 +1,306 @@
+#ifndef BASE_GRAPH_VERSIONED_DIRECTED_GRAPH_HPP
+#define BASE_GRAPH_VERSIONED_DIRECTED_GRAPH_HPP
+
+#include "BaseGraph/types.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace BaseGraph {
+
+/**
+ * Immutable version of a @ref LabeledVersionedDirectedGraph, obtained with
+ * @ref LabeledVersionedDirectedGraph::getSnapshot in \f$O(1)\f$.
+ *
+ * The out edges of the vertices are stored in blocks of @ref getBlockSize
+ * consecutive vertices, which are shared between the versions of the graph
+ * until the graph modifies them. A snapshot is thus never affected by the
+ * later updates of the graph and can be read by any number of threads, even
+ * while the graph is modified by another thread. Copying a snapshot is
+ * \f$O(1)\f$ and thread-safe.
+ *
+ * Snapshots are accepted by the algorithms that only read the neighbours of
+ * vertices (e.g. @ref algorithms::findGeodesics).
+ *
+ * @tparam EdgeLabel Container of edge information. Requires a default
+ * constructor.
+ */
+template <typename EdgeLabel>
+class LabeledDirectedGraphSnapshot {
+  public:
+    /// Contains the out neighbours of a vertex.
+    typedef std::vector<VertexIndex> Successors;
+    /// Contains the labels of the out edges of a vertex.
+    typedef std::vector<EdgeLabel> EdgeLabels;
+
+    /// Number of consecutive vertices whose out edges are stored, and copied
+    /// on write, together.
+    static constexpr size_t getBlockSize() { return 64; }
+
+  protected:
+    /// Out edges of @ref getBlockSize consecutive vertices.
+    struct Block {
+        std::vector<Successors> neighbours;
+        /// Labels in the order of `neighbours`. Empty for unlabeled graphs.
+        std::vector<EdgeLabels> labels;
+
+        Block()
+            : neighbours(getBlockSize()),
+              labels(isLabeled() ? getBlockSize() : 0) {}
+    };
+    typedef std::vector<std::shared_ptr<Block>> Blocks;
+
+    /// Blocks of the version. A block is shared with other versions when its
+    /// use count is larger than one, in which case it must not be modified.
+    std::shared_ptr<Blocks> blocks = std::make_shared<Blocks>();
+    size_t size = 0;
+    size_t edgeNumber = 0;
+
+  public:
+    /// Returns the number of vertices.
+    size_t getSize() const { return size; }
+    /// Returns the number of edges.
+    size_t getEdgeNumber() const { return edgeNumber; }
+
+    /// Returns vertices to which \p vertex is connected.
+    const Successors &getOutNeighbours(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return getBlock(vertex).neighbours[vertex % getBlockSize()];
+    }
+    /// Returns the labels of the out edges of \p vertex, in the same order as
+    /// @ref getOutNeighbours. Unavailable for unlabeled graphs.
+    template <typename... Dummy, typename U = EdgeLabel>
+    const typename std::enable_if<
+        !std::is_same<U, NoLabel>::value, EdgeLabels>::type &
+    getOutEdgeLabels(VertexIndex vertex) const {
+        assertVertexInRange(vertex);
+        return getBlock(vertex).labels[vertex % getBlockSize()];
+    }
+    /// Counts the number of edges coming from \p vertex.
+    size_t getOutDegree(VertexIndex vertex) const {
+        return getOutNeighbours(vertex).size();
+    }
+
+    /// Returns if a directed edge of any label connects \p source to \p
+    /// destination.
+    bool hasEdge(VertexIndex source, VertexIndex destination) const {
+        assertVertexInRange(destination);
+        const Successors &neighbours = getOutNeighbours(source);
+        return std::find(neighbours.begin(), neighbours.end(), destination) !=
+               neighbours.end();
+    }
+    /// @copydoc LabeledDirectedGraph::getEdgeLabel
+    EdgeLabel getEdgeLabel(
+        VertexIndex source, VertexIndex destination,
+        bool throwIfInexistent = true
+    ) const {
+        assertVertexInRange(destination);
+        const Successors &neighbours = getOutNeighbours(source);
+        auto position =
+            std::find(neighbours.begin(), neighbours.end(), destination);
+        if (position == neighbours.end()) {
+            if (throwIfInexistent)
+                throw std::invalid_argument("Edge label doesn't exist.");
+            return EdgeLabel();
+        }
+        if (!isLabeled())
+            return EdgeLabel();
+        return getBlock(source).labels[source % getBlockSize()]
+                                      [position - neighbours.begin()];
+    }
+
+    /// Throws `std::out_of_range` if \p vertex is not contained in the graph.
+    void assertVertexInRange(VertexIndex vertex) const {
+        if (vertex >= size)
+            throw std::out_of_range(
+                "Vertex index (" + std::to_string(vertex) +
+                ") greater than the graph's size(" + std::to_string(size) + ")."
+            );
+    }
+
+    /// Returns VertexIterator of first vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator begin() const { return VertexIterator(0); }
+    /// Returns VertexIterator of last vertex. Allows ranged-based loop on the
+    /// graph's vertices.
+    VertexIterator end() const { return VertexIterator(size); }
+
+  protected:
+    static constexpr bool isLabeled() {
+        return !std::is_same<EdgeLabel, NoLabel>::value;
+    }
+
+    const Block &getBlock(VertexIndex vertex) const {
+        return *(*blocks)[vertex / getBlockSize()];
+    }
+};
+
+/**
+ * Directed graph with edge labels, self-loops and without multiedges, whose
+ * versions can be read concurrently with its updates. When no \p EdgeLabel is
+ * specified, it acts as an unlabeled graph.
+ *
+ * @ref getSnapshot returns, in \f$O(1)\f$, an immutable view of the current
+ * version of the graph. The out edges are stored in blocks of consecutive
+ * vertices (see @ref LabeledDirectedGraphSnapshot::getBlockSize) that are
+ * shared with the snapshots. The first update of a block after a snapshot
+ * copies the block, and the first update after a snapshot copies the
+ * pointers to the blocks, so the graph only pays for the blocks it modifies.
+ * Blocks that are no longer used by any snapshot are modified in place.
+ *
+ * The graph itself must only be used by one thread at a time, which hands the
+ * snapshots to the readers:
+ * \code{.cpp}
+ * BaseGraph::DirectedGraphSnapshot snapshot = graph.getSnapshot();
+ * auto reading = std::async(std::launch::async, [snapshot]() {
+ *     return BaseGraph::algorithms::findGeodesics(snapshot, 0, 5);
+ * });
+ * // ... graph.addEdge(...), graph.removeEdge(...)
+ * auto path = reading.get(); // Path in the graph when the snapshot was taken
+ * \endcode
+ *
+ * The references returned by the methods of the graph are invalidated by the
+ * updates of the block of the vertex. Those returned by a snapshot remain
+ * valid as long as the snapshot exists.
+ *
+ * @tparam EdgeLabel Container of edge information. Requires a default
+ * constructor.
+ */
+template <typename EdgeLabel>
+class LabeledVersionedDirectedGraph
+    : public LabeledDirectedGraphSnapshot<EdgeLabel> {
+    typedef LabeledDirectedGraphSnapshot<EdgeLabel> Snapshot;
+    typedef typename Snapshot::Block Block;
+    typedef typename Snapshot::Blocks Blocks;
+
+    using Snapshot::blocks;
+    using Snapshot::edgeNumber;
+    using Snapshot::isLabeled;
+    using Snapshot::size;
+
+  public:
+    using typename Snapshot::EdgeLabels;
+    using typename Snapshot::Successors;
+    using Snapshot::getBlockSize;
+
+    /// Constructs a graph of \p size vertices without edges.
+    explicit LabeledVersionedDirectedGraph(size_t size = 0) { resize(size); }
+
+    /// Returns an immutable view of the current version of the graph, in
+    /// \f$O(1)\f$.
+    Snapshot getSnapshot() const { return *this; }
+
+    /// Sets the number of vertices to \p newSize.
+    /// @param newSize Number of vertices. Must be larger than the current
+    /// number of vertices.
+    void resize(size_t newSize);
+
+    /// Adds labeled directed edge from vertex \p source to \p destination.
+    /// @param force If `false`, the edge is not added if it already exists.
+    void addEdge(
+        VertexIndex source, VertexIndex destination, const EdgeLabel &label,
+        bool force = false
+    );
+    /// Adds directed edge from vertex \p source to \p destination with the
+    /// default label constructor.
+    void addEdge(
+        VertexIndex source, VertexIndex destination, bool force = false
+    ) {
+        addEdge(source, destination, EdgeLabel(), force);
+    }
+    /// Removes directed edges (including duplicates) from \p source to \p
+    /// destination.
+    void removeEdge(VertexIndex source, VertexIndex destination);
+
+  protected:
+    /// Returns the block of \p vertex after copying what it shares with
+    /// other versions.
+    Block &getWritableBlock(VertexIndex vertex);
+};
+
+/// Unlabeled directed graph whose versions can be read concurrently.
+using VersionedDirectedGraph = LabeledVersionedDirectedGraph<NoLabel>;
+/// Immutable version of a @ref VersionedDirectedGraph.
+using DirectedGraphSnapshot = LabeledDirectedGraphSnapshot<NoLabel>;
+
+template <typename EdgeLabel>
+void LabeledVersionedDirectedGraph<EdgeLabel>::resize(size_t newSize) {
+    if (newSize < size)
+        throw std::invalid_argument("Graph's size cannot be reduced.");
+
+    size_t blockNumber = (newSize + getBlockSize() - 1) / getBlockSize();
+    if (blockNumber > blocks->size()) {
+        if (blocks.use_count() > 1)
+            blocks = std::make_shared<Blocks>(*blocks);
+        while (blocks->size() < blockNumber)
+            blocks->push_back(std::make_shared<Block>());
+    }
+    size = newSize;
+}
+
+template <typename EdgeLabel>
+void LabeledVersionedDirectedGraph<EdgeLabel>::addEdge(
+    VertexIndex source, VertexIndex destination, const EdgeLabel &label,
+    bool force
+) {
+    if (!force && this->hasEdge(source, destination))
+        return;
+    this->assertVertexInRange(source);
+    this->assertVertexInRange(destination);
+
+    Block &block = getWritableBlock(source);
+    block.neighbours[source % getBlockSize()].push_back(destination);
+    if (isLabeled())
+        block.labels[source % getBlockSize()].push_back(label);
+    ++edgeNumber;
+}
+
+template <typename EdgeLabel>
+void LabeledVersionedDirectedGraph<EdgeLabel>::removeEdge(
+    VertexIndex source, VertexIndex destination
+) {
+    // Avoids copying the block when there is nothing to remove.
+    if (!this->hasEdge(source, destination))
+        return;
+
+    Block &block = getWritableBlock(source);
+    Successors &neighbours = block.neighbours[source % getBlockSize()];
+    size_t kept = 0;
+    for (size_t k = 0; k < neighbours.size(); ++k) {
+        if (neighbours[k] == destination)
+            continue;
+        if (isLabeled())
+            block.labels[source % getBlockSize()][kept] =
+                std::move(block.labels[source % getBlockSize()][k]);
+        neighbours[kept++] = neighbours[k];
+    }
+    edgeNumber -= neighbours.size() - kept;
+    neighbours.resize(kept);
+    if (isLabeled())
+        block.labels[source % getBlockSize()].resize(kept);
+}
+
+template <typename EdgeLabel>
+typename LabeledVersionedDirectedGraph<EdgeLabel>::Block &
+LabeledVersionedDirectedGraph<EdgeLabel>::getWritableBlock(
+    VertexIndex vertex
+) {
+    if (blocks.use_count() > 1)
+        blocks = std::make_shared<Blocks>(*blocks);
+    std::shared_ptr<Block> &block = (*blocks)[vertex / getBlockSize()];
+    if (block.use_count() > 1)
+        block = std::make_shared<Block>(*block);
+    // The use counts were read without synchronization: this orders the
+    // reads of the last snapshot that released the block before the writes.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return *block;
+}
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,225 @@
+#ifndef BASE_GRAPH_VERTEX_PROPERTIES_HPP
+#define BASE_GRAPH_VERTEX_PROPERTIES_HPP
+
+#include "BaseGraph/graph_views.hpp"
+#include "BaseGraph/types.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace BaseGraph {
+
+/**
+ * Named columns of vertex properties, one value per vertex, owned by a graph
+ * (see `getVertexProperties`). Each column is a `std::vector<T>` indexed by
+ * vertex, so its values are contiguous and can be scanned or vectorized like
+ * any array:
+ *
+ *     auto &ages = graph.getVertexProperties().add<double>("age");
+ *     ages[3] = 41;
+ *     auto &labels = graph.getVertexProperties().get<std::string>("label");
+ *
+ * The graph keeps its columns in sync with its vertices: they grow with
+ * `resize`, lose the rows of the vertices removed by `removeVertices`, are
+ * permuted by `getPermutedGraph` and follow the subgraphs of @ref
+ * algorithms::getSubgraph and @ref algorithms::getSubgraphWithRemap. The
+ * columns must therefore not be resized directly. Use a column of `char` or
+ * `uint8_t` instead of `bool`, whose `std::vector` isn't contiguous.
+ */
+class VertexProperties {
+    struct ColumnBase {
+        virtual ~ColumnBase() {}
+        virtual std::unique_ptr<ColumnBase> clone() const = 0;
+        virtual void resize(size_t size) = 0;
+        virtual void applyIndicesAfterRemoval(
+            const std::vector<VertexIndex> &newIndices
+        ) = 0;
+        /// Returns a column whose values are `values[vertices[0]],
+        /// values[vertices[1]], ...`.
+        virtual std::unique_ptr<ColumnBase>
+        getSelected(const std::vector<VertexIndex> &vertices) const = 0;
+    };
+
+    template <typename T>
+    struct Column : ColumnBase {
+        std::vector<T> values;
+        /// Value of the vertices added by @ref resize.
+        T defaultValue;
+
+        Column(std::vector<T> values, const T &defaultValue)
+            : values(std::move(values)), defaultValue(defaultValue) {}
+
+        std::unique_ptr<ColumnBase> clone() const {
+            return std::unique_ptr<ColumnBase>(new Column(*this));
+        }
+        void resize(size_t size) { values.resize(size, defaultValue); }
+        void applyIndicesAfterRemoval(
+            const std::vector<VertexIndex> &newIndices
+        ) {
+            BaseGraph::applyIndicesAfterRemoval(values, newIndices);
+        }
+        std::unique_ptr<ColumnBase>
+        getSelected(const std::vector<VertexIndex> &vertices) const {
+            std::vector<T> selectedValues;
+            selectedValues.reserve(vertices.size());
+            for (VertexIndex vertex : vertices)
+                selectedValues.push_back(values[vertex]);
+            return std::unique_ptr<ColumnBase>(
+                new Column(std::move(selectedValues), defaultValue)
+            );
+        }
+    };
+
+    size_t size = 0;
+    std::vector<std::pair<std::string, std::unique_ptr<ColumnBase>>> columns;
+
+    ColumnBase *find(const std::string &name) const {
+        for (auto &column : columns)
+            if (column.first == name)
+                return column.second.get();
+        return nullptr;
+    }
+
+    template <typename T>
+    Column<T> &getColumn(const std::string &name) const {
+        ColumnBase *column = find(name);
+        if (column == nullptr)
+            throw std::invalid_argument(
+                "Vertex property \"" + name + "\" doesn't exist."
+            );
+        Column<T> *typedColumn = dynamic_cast<Column<T> *>(column);
+        if (typedColumn == nullptr)
+            throw std::invalid_argument(
+                "Vertex property \"" + name + "\" has another type."
+            );
+        return *typedColumn;
+    }
+
+  public:
+    /// Constructs a table without columns for \p size vertices.
+    explicit VertexProperties(size_t size = 0) : size(size) {}
+
+    VertexProperties(const VertexProperties &other) : size(other.size) {
+        for (auto &column : other.columns)
+            columns.emplace_back(column.first, column.second->clone());
+    }
+    VertexProperties &operator=(const VertexProperties &other) {
+        if (this != &other) {
+            VertexProperties copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+    VertexProperties(VertexProperties &&) = default;
+    VertexProperties &operator=(VertexProperties &&) = default;
+
+    /// Returns the number of vertices, which is the length of every column.
+    size_t getSize() const { return size; }
+    /// Returns the number of columns.
+    size_t getColumnNumber() const { return columns.size(); }
+    /// Returns the names of the columns, in the order they were added.
+    std::vector<std::string> getNames() const {
+        std::vector<std::string> names;
+        for (auto &column : columns)
+            names.push_back(column.first);
+        return names;
+    }
+    /// Returns if a column is named \p name.
+    bool has(const std::string &name) const { return find(name) != nullptr; }
+
+    /**
+     * Adds a column named \p name in which every vertex has \p defaultValue,
+     * which is also given to the vertices added later. Throws
+     * `std::invalid_argument` if the column already exists.
+     */
+    template <typename T>
+    std::vector<T> &add(const std::string &name, const T &defaultValue = T()) {
+        return add(name, std::vector<T>(size, defaultValue), defaultValue);
+    }
+    /**
+     * Adds a column named \p name that contains \p values. The vertices added
+     * later receive \p defaultValue. Throws `std::invalid_argument` if the
+     * column already exists or if there isn't one value per vertex.
+     */
+    template <typename T>
+    std::vector<T> &add(
+        const std::string &name, std::vector<T> values,
+        const T &defaultValue = T()
+    ) {
+        if (has(name))
+            throw std::invalid_argument(
+                "Vertex property \"" + name + "\" already exists."
+            );
+        if (values.size() != size)
+            throw std::invalid_argument(
+                "Vertex property \"" + name + "\" must have one value per "
+                "vertex."
+            );
+        Column<T> *column = new Column<T>(std::move(values), defaultValue);
+        columns.emplace_back(name, std::unique_ptr<ColumnBase>(column));
+        return column->values;
+    }
+    /// Removes the column named \p name, if it exists.
+    void remove(const std::string &name) {
+        for (auto it = columns.begin(); it != columns.end(); ++it)
+            if (it->first == name) {
+                columns.erase(it);
+                return;
+            }
+    }
+
+    /// Returns the values of column \p name, indexed by vertex. Throws
+    /// `std::invalid_argument` if the column doesn't exist or if its type
+    /// isn't \p T.
+    template <typename T>
+    std::vector<T> &get(const std::string &name) {
+        return getColumn<T>(name).values;
+    }
+    /// @copydoc get
+    template <typename T>
+    const std::vector<T> &get(const std::string &name) const {
+        return getColumn<T>(name).values;
+    }
+
+    /// Sets the number of vertices to \p newSize. The new vertices receive
+    /// the default value of each column.
+    void resize(size_t newSize) {
+        for (auto &column : columns)
+            column.second->resize(newSize);
+        size = newSize;
+    }
+    /// Keeps the rows of the vertices that aren't removed, at their new
+    /// index (see @ref getIndicesAfterRemoval).
+    void applyIndicesAfterRemoval(const std::vector<VertexIndex> &newIndices) {
+        for (auto &column : columns)
+            column.second->applyIndicesAfterRemoval(newIndices);
+        size = 0;
+        for (VertexIndex newIndex : newIndices)
+            if (newIndex != REMOVED_VERTEX)
+                ++size;
+    }
+    /// Returns a copy in which the row of vertex \c i is moved to
+    /// `newIndices[i]`. Throws `std::invalid_argument` if \p newIndices is
+    /// not a permutation of the vertices.
+    VertexProperties
+    getPermuted(const std::vector<VertexIndex> &newIndices) const {
+        return getSelected(getInversePermutation(newIndices, size));
+    }
+    /// Returns a copy whose row \c i is the row of vertex `vertices[i]`.
+    VertexProperties
+    getSelected(const std::vector<VertexIndex> &vertices) const {
+        VertexProperties selected(vertices.size());
+        for (auto &column : columns)
+            selected.columns.emplace_back(
+                column.first, column.second->getSelected(vertices)
+            );
+        return selected;
+    }
+};
+
+} // namespace BaseGraph
+
+#endif
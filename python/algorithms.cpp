@@ -12,16 +12,15 @@ using namespace BaseGraph;
 template <template <class...> class Graph, typename EdgeLabel>
 void defineAlgorithmsType(py::module &m) {
     using Class = Graph<EdgeLabel>;
-    m.def("find_geodesics", &algorithms::findGeodesics<Graph, EdgeLabel>);
-    m.def("find_all_geodesics",
-          &algorithms::findAllGeodesics<Graph, EdgeLabel>);
+    m.def("find_geodesics", &algorithms::findGeodesics<Class>);
+    m.def("find_all_geodesics", &algorithms::findAllGeodesics<Class>);
     m.def("find_geodesics_from_vertex",
-          &algorithms::findGeodesicsFromVertex<Graph, EdgeLabel>);
+          &algorithms::findGeodesicsFromVertex<Class>);
     m.def("find_all_geodesics_from_vertex",
-          &algorithms::findAllGeodesicsFromVertex<Graph, EdgeLabel>);
-    m.def("find_subgraph", &algorithms::getSubgraph<Graph, EdgeLabel>);
+          &algorithms::findAllGeodesicsFromVertex<Class>);
+    m.def("find_subgraph", &algorithms::getSubgraph<Class>);
     m.def("find_subgraph_with_remap",
-          &algorithms::getSubgraphWithRemap<Graph, EdgeLabel>);
+          &algorithms::getSubgraphWithRemap<Class>);
 }
 
 template <typename EdgeLabel>
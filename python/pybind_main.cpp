@@ -1,3 +1,4 @@
+#include "BaseGraph/types.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 
@@ -8,6 +9,7 @@ void defineIOTools(py::module &m);
 void defineAlgorithms(py::module &m);
 
 PYBIND11_MODULE(_core, m) {
+    m.attr("vertex_index_bits") = 8 * sizeof(BaseGraph::VertexIndex);
     defineAllGraphs(m);
     py::module_ ioModule =
         m.def_submodule("io", "Read (write) graphs to (from) files.");
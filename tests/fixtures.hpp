@@ -6,6 +6,7 @@
 
 #include "gtest/gtest.h"
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <typeinfo>
 #include <vector>
@@ -210,4 +211,20 @@ class ThreeComponentsGraph : public ::testing::Test {
     }
 };
 
+template <typename T>
+std::vector<typename T::value_type> toVector(const T &range) {
+    return std::vector<typename T::value_type>(range.begin(), range.end());
+}
+
+inline BaseGraph::LabeledDirectedGraph<std::string> getLabeledDirectedGraph() {
+    BaseGraph::LabeledDirectedGraph<std::string> graph(5);
+    graph.addEdge(0, 3, std::string("a"));
+    graph.addEdge(0, 1, std::string("b"));
+    graph.addEdge(0, 2, std::string("c"));
+    graph.addEdge(2, 2, std::string("d"));
+    graph.addEdge(3, 0, std::string("e"));
+    graph.addEdge(4, 0, std::string("f"));
+    return graph;
+}
+
 #endif
@@ -0,0 +1,158 @@
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_multigraph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> VectorSuccessors;
+
+TEST(AddEdges, directedGraph_duplicateEdges_sameAsSuccessiveAddEdge) {
+    std::vector<Edge> edges = {{0, 2}, {3, 1}, {0, 1}, {0, 2}, {1, 1}, {3, 1}};
+    DirectedGraph expectedGraph(4);
+    for (auto edge : edges)
+        expectedGraph.addEdge(edge.first, edge.second);
+
+    DirectedGraph graph;
+    graph.addEdges(edges);
+
+    EXPECT_EQ(graph.getSize(), 4);
+    EXPECT_EQ(graph.getEdgeNumber(), 4);
+    EXPECT_EQ(graph.getOutNeighbours(0), Successors({2, 1}));
+    EXPECT_EQ(graph.getOutNeighbours(3), Successors({1}));
+    EXPECT_EQ(graph, expectedGraph);
+}
+
+TEST(AddEdges, directedGraph_existingEdges_existingEdgesSkipped) {
+    DirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(2, 0);
+
+    graph.addEdges(std::list<Edge>{{0, 2}, {0, 1}, {2, 0}, {2, 2}});
+
+    EXPECT_EQ(graph.getOutNeighbours(0), Successors({1, 2}));
+    EXPECT_EQ(graph.getOutNeighbours(2), Successors({0, 2}));
+    EXPECT_EQ(graph.getEdgeNumber(), 4);
+}
+
+TEST(AddEdges, directedGraph_force_duplicatesAdded) {
+    DirectedGraph graph(2);
+    graph.addEdge(0, 1);
+
+    graph.addEdges(std::vector<Edge>{{0, 1}, {0, 1}}, true);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), Successors({1, 1, 1}));
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+}
+
+TEST(AddEdges, labeledDirectedGraph_duplicateEdges_firstLabelKept) {
+    LabeledDirectedGraph<std::string> graph(2);
+    graph.addEdge(1, 0, std::string("a"));
+
+    graph.addEdges(std::vector<LabeledEdge<std::string>>{
+        {0, 1, "b"}, {1, 0, "c"}, {0, 1, "d"}, {1, 1, "e"}});
+
+    EXPECT_EQ(graph.getEdgeLabel(0, 1), "b");
+    EXPECT_EQ(graph.getEdgeLabel(1, 0), "a");
+    EXPECT_EQ(graph.getEdgeLabel(1, 1), "e");
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+}
+
+TEST(AddEdges, sortedStorage_existingNeighbours_neighboursAndLabelsMerged) {
+    LabeledDirectedGraph<std::string, SortedStorage<>> graph(5);
+    graph.addEdge(0, 1, std::string("a"));
+    graph.addEdge(0, 3, std::string("b"));
+
+    graph.addEdges(std::vector<LabeledEdge<std::string>>{
+        {0, 4, "c"}, {0, 0, "d"}, {0, 2, "e"}, {0, 3, "f"}});
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({0, 1, 2, 3, 4}));
+    EXPECT_EQ(
+        graph.getOutEdgeLabels(0),
+        std::vector<std::string>({"d", "a", "e", "b", "c"})
+    );
+}
+
+TEST(AddEdges, trackedInNeighbours_newEdges_inNeighboursUpdated) {
+    DirectedGraph graph(3);
+    graph.trackInNeighbours();
+    graph.addEdges(std::vector<Edge>{{2, 0}, {1, 0}, {2, 0}});
+
+    EXPECT_EQ(graph.getInNeighbours(0), Successors({1, 2}));
+}
+
+TEST(AddEdges, undirectedGraph_bothOrientations_sameAsSuccessiveAddEdge) {
+    std::vector<Edge> edges = {{0, 2}, {2, 0}, {1, 2}, {1, 1}, {3, 0}};
+    UndirectedGraph expectedGraph(4);
+    for (auto edge : edges)
+        expectedGraph.addEdge(edge.first, edge.second);
+
+    UndirectedGraph graph(edges);
+
+    EXPECT_EQ(graph.getEdgeNumber(), 4);
+    EXPECT_EQ(graph.getNeighbours(0), Successors({2, 3}));
+    EXPECT_EQ(graph.getNeighbours(1), Successors({2, 1}));
+    EXPECT_EQ(graph.getNeighbours(2), Successors({0, 1}));
+    EXPECT_EQ(graph, expectedGraph);
+}
+
+TEST(AddEdges, weightedGraphs_duplicateEdges_totalWeightOfKeptEdges) {
+    std::vector<LabeledEdge<EdgeWeight>> edges = {
+        {0, 1, 1.5}, {1, 0, 2}, {0, 1, 4}, {2, 2, 8}};
+
+    DirectedWeightedGraph directed(edges);
+    EXPECT_EQ(directed.getEdgeNumber(), 3);
+    EXPECT_EQ(directed.getTotalWeight(), 11.5);
+    EXPECT_EQ(directed.getEdgeWeight(0, 1), 1.5);
+
+    UndirectedWeightedGraph undirected(edges);
+    EXPECT_EQ(undirected.getEdgeNumber(), 2);
+    EXPECT_EQ(undirected.getTotalWeight(), 9.5);
+    EXPECT_EQ(undirected.getEdgeWeight(1, 0), 1.5);
+}
+
+TEST(AddEdges, directedMultigraph_repeatedEdges_multiplicitiesMerged) {
+    DirectedMultigraph graph(3);
+    graph.addMultiedge(0, 1, 2);
+
+    graph.addEdges(std::vector<LabeledEdge<EdgeMultiplicity>>{
+        {0, 1, 3}, {1, 2, 1}, {1, 2, 4}, {2, 0, 0}, {3, 3, 1}});
+
+    EXPECT_EQ(graph.getSize(), 4);
+    EXPECT_EQ(graph.getEdgeMultiplicity(0, 1), 5);
+    EXPECT_EQ(graph.getEdgeMultiplicity(1, 2), 5);
+    EXPECT_FALSE(graph.hasEdge(2, 0));
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+    EXPECT_EQ(graph.getTotalEdgeNumber(), 11);
+    EXPECT_EQ(graph.getOutDegrees(), std::vector<size_t>({5, 5, 0, 1}));
+    EXPECT_EQ(graph.getInDegrees(), std::vector<size_t>({0, 5, 5, 1}));
+}
+
+TEST(AddEdges, undirectedMultigraph_repeatedEdges_multiplicitiesMerged) {
+    UndirectedMultigraph graph(3);
+    graph.addMultiedge(1, 0, 2);
+
+    graph.addEdges(std::vector<Edge>{{0, 1}, {1, 0}, {2, 2}, {2, 2}});
+
+    EXPECT_EQ(graph.getEdgeMultiplicity(0, 1), 4);
+    EXPECT_EQ(graph.getEdgeMultiplicity(1, 0), 4);
+    EXPECT_EQ(graph.getEdgeMultiplicity(2, 2), 2);
+    EXPECT_EQ(graph.getEdgeNumber(), 2);
+    EXPECT_EQ(graph.getTotalEdgeNumber(), 6);
+    EXPECT_EQ(graph.getDegrees(), std::vector<size_t>({4, 4, 4}));
+}
+
+TEST(AddEdges, anyGraph_vertexLargerThanSize_graphResized) {
+    DirectedGraph graph(2);
+    graph.addEdges(std::vector<Edge>{{0, 5}});
+
+    EXPECT_EQ(graph.getSize(), 6);
+    EXPECT_TRUE(graph.hasEdge(0, 5));
+}
@@ -0,0 +1,155 @@
+#include "BaseGraph/arena_allocator.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "fixtures.hpp"
+
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> VectorSuccessors;
+typedef AllocatorStorage<ArenaAllocator, VectorStorage> ArenaVectorStorage;
+
+TEST(MonotonicArena, allocate_anyAlignment_alignedAndCounted) {
+    MonotonicArena arena(64);
+    arena.allocate(1, 1);
+    void *aligned = arena.allocate(16, 16);
+    void *large = arena.allocate(200, 8);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 16, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(large) % 8, 0);
+    EXPECT_EQ(arena.getUsedBytes(), 217);
+    EXPECT_GE(arena.getReservedBytes(), 264);
+
+    arena.release();
+    EXPECT_EQ(arena.getUsedBytes(), 0);
+    EXPECT_EQ(arena.getReservedBytes(), 0);
+}
+
+TEST(ArenaScope, nestedScopes_previousArenaRestored) {
+    MonotonicArena arena1, arena2;
+    EXPECT_EQ(ArenaScope::getCurrentArena(), nullptr);
+    {
+        ArenaScope scope1(arena1);
+        {
+            ArenaScope scope2(arena2);
+            EXPECT_EQ(ArenaAllocator<int>().getArena(), &arena2);
+        }
+        EXPECT_EQ(ArenaAllocator<int>().getArena(), &arena1);
+    }
+    EXPECT_EQ(ArenaAllocator<int>().getArena(), nullptr);
+}
+
+TEST(ArenaStorage, directedGraph_addEdges_neighboursAllocatedInArena) {
+    MonotonicArena arena;
+    {
+        ArenaScope scope(arena);
+        LabeledDirectedGraph<NoLabel, ArenaStorage> graph(3);
+        size_t emptyGraphBytes = arena.getUsedBytes();
+
+        graph.addEdge(0, 1);
+        graph.addEdge(0, 2);
+        graph.addEdge(2, 0);
+
+        EXPECT_GT(arena.getUsedBytes(), emptyGraphBytes);
+        EXPECT_EQ(
+            toVector(graph.getOutNeighbours(0)), VectorSuccessors({1, 2})
+        );
+        EXPECT_TRUE(graph.hasEdge(2, 0));
+
+        graph.removeEdge(0, 1);
+        EXPECT_EQ(toVector(graph.getOutNeighbours(0)), VectorSuccessors({2}));
+    }
+    arena.release();
+}
+
+TEST(ArenaStorage, graphBuiltInScope_edgesAddedOutsideScope_arenaKept) {
+    MonotonicArena arena;
+    {
+        LabeledDirectedGraph<NoLabel, ArenaStorage> graph;
+        {
+            ArenaScope scope(arena);
+            graph.resize(2);
+        }
+        size_t usedBytes = arena.getUsedBytes();
+        graph.addEdge(0, 1);
+
+        EXPECT_GT(arena.getUsedBytes(), usedBytes);
+        EXPECT_EQ(graph.getOutNeighbours(0).get_allocator().getArena(), &arena);
+    }
+    arena.release();
+}
+
+TEST(ArenaStorage, noScope_globalHeapUsed) {
+    LabeledDirectedGraph<NoLabel, ArenaStorage> graph(2);
+    graph.addEdge(0, 1);
+
+    EXPECT_EQ(graph.getOutNeighbours(0).get_allocator().getArena(), nullptr);
+    EXPECT_TRUE(graph.hasEdge(0, 1));
+}
+
+TEST(ArenaStorage, labeledGraph_addEdges_labelsAllocatedInArena) {
+    MonotonicArena arena;
+    {
+        ArenaScope scope(arena);
+        LabeledDirectedGraph<std::string, ArenaStorage> graph(2);
+        size_t unlabeledBytes = 0;
+        {
+            LabeledDirectedGraph<NoLabel, ArenaStorage> unlabeledGraph(2);
+            size_t usedBytes = arena.getUsedBytes();
+            unlabeledGraph.addEdge(0, 1);
+            unlabeledBytes = arena.getUsedBytes() - usedBytes;
+        }
+        size_t usedBytes = arena.getUsedBytes();
+        graph.addEdge(0, 1, std::string("a"));
+
+        EXPECT_GT(arena.getUsedBytes() - usedBytes, unlabeledBytes);
+        EXPECT_EQ(graph.getEdgeLabel(0, 1), "a");
+    }
+    arena.release();
+}
+
+TEST(ArenaStorage, sortedVectorStorage_addEdges_sortedNeighbours) {
+    MonotonicArena arena;
+    {
+        ArenaScope scope(arena);
+        typedef SortedStorage<ArenaVectorStorage> SortedArenaStorage;
+        LabeledDirectedGraph<NoLabel, SortedArenaStorage> graph(4);
+        graph.addEdges(std::vector<Edge>{{0, 3}, {0, 1}, {0, 2}});
+        graph.addEdge(0, 0);
+
+        EXPECT_EQ(
+            toVector(graph.getOutNeighbours(0)), VectorSuccessors({0, 1, 2, 3})
+        );
+        EXPECT_GT(arena.getUsedBytes(), 0);
+    }
+    arena.release();
+}
+
+TEST(ArenaStorage, otherGraphs_sameEdgesAsDefaultStorage) {
+    MonotonicArena arena;
+    {
+        ArenaScope scope(arena);
+        BasicDirectedWeightedGraph<ArenaStorage> weightedGraph(3);
+        weightedGraph.addEdge(0, 1, 1.5);
+        weightedGraph.addEdge(1, 2, 2);
+        weightedGraph.trackInNeighbours();
+        weightedGraph.removeVertexFromEdgeList(1);
+
+        EXPECT_EQ(weightedGraph.getTotalWeight(), 0);
+        EXPECT_EQ(weightedGraph.getEdgeNumber(), 0);
+
+        LabeledUndirectedGraph<NoLabel, ArenaStorage> undirectedGraph(3);
+        undirectedGraph.addEdge(0, 1);
+        undirectedGraph.addEdge(2, 1);
+
+        EXPECT_EQ(
+            toVector(undirectedGraph.getNeighbours(1)), VectorSuccessors({0, 2})
+        );
+    }
+    arena.release();
+}
@@ -0,0 +1,261 @@
+#include "BaseGraph/algorithms/paths.hpp"
+#include "BaseGraph/algorithms/topology.hpp"
+#include "BaseGraph/compact_directed_graph.hpp"
+#include "BaseGraph/compact_undirected_graph.hpp"
+#include "fixtures.hpp"
+
+#include "gtest/gtest.h"
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> Neighbours;
+
+TEST(CompactDirectedGraph, freeze_anyGraph_neighboursSortedAndEdgesKept) {
+    auto compact = freeze(getLabeledDirectedGraph());
+
+    EXPECT_EQ(compact.getSize(), 5);
+    EXPECT_EQ(compact.getEdgeNumber(), 6);
+    EXPECT_EQ(toVector(compact.getOutNeighbours(0)), Neighbours({1, 2, 3}));
+    EXPECT_EQ(toVector(compact.getOutNeighbours(1)), Neighbours({}));
+    EXPECT_EQ(toVector(compact.getOutNeighbours(2)), Neighbours({2}));
+    EXPECT_EQ(toVector(compact.getOutNeighbours(4)), Neighbours({0}));
+}
+
+TEST(CompactDirectedGraph, getOutEdgeLabels_labeledGraph_parallelToNeighbours) {
+    auto compact = freeze(getLabeledDirectedGraph());
+
+    EXPECT_EQ(
+        toVector(compact.getOutEdgeLabels(0)),
+        std::vector<std::string>({"b", "c", "a"})
+    );
+    EXPECT_EQ(compact.getEdgeLabel(0, 3), "a");
+    EXPECT_EQ(compact.getEdgeLabel(4, 0), "f");
+}
+
+TEST(CompactDirectedGraph, getEdgeLabel_inexistentEdge_throwOrDefault) {
+    auto compact = freeze(getLabeledDirectedGraph());
+
+    EXPECT_THROW(compact.getEdgeLabel(1, 0), std::invalid_argument);
+    EXPECT_EQ(compact.getEdgeLabel(1, 0, false), "");
+    EXPECT_THROW(compact.getEdgeLabel(0, 5), std::out_of_range);
+}
+
+TEST(CompactDirectedGraph, hasEdge_anyEdge_sameAsOriginalGraph) {
+    auto graph = getLabeledDirectedGraph();
+    auto compact = freeze(graph);
+
+    for (VertexIndex i : graph)
+        for (VertexIndex j : graph)
+            EXPECT_EQ(compact.hasEdge(i, j), graph.hasEdge(i, j));
+    EXPECT_TRUE(compact.hasEdge(0, 1, "b"));
+    EXPECT_FALSE(compact.hasEdge(0, 1, "a"));
+    EXPECT_THROW(compact.hasEdge(5, 0), std::out_of_range);
+}
+
+TEST(CompactDirectedGraph, degrees_anyGraph_sameAsOriginalGraph) {
+    auto graph = getLabeledDirectedGraph();
+    auto compact = freeze(graph);
+
+    EXPECT_EQ(compact.getOutDegrees(), graph.getOutDegrees());
+    EXPECT_EQ(compact.getInDegrees(), graph.getInDegrees());
+    EXPECT_EQ(compact.getInDegree(0), 2);
+    EXPECT_EQ(compact.getAdjacencyMatrix(), graph.getAdjacencyMatrix());
+}
+
+TEST(CompactDirectedGraph, edges_anyGraph_eachEdgeInOrder) {
+    DirectedGraph graph(5);
+    graph.addEdge(3, 1);
+    graph.addEdge(0, 4);
+    graph.addEdge(0, 2);
+    auto compact = freeze(graph);
+
+    std::list<Edge> loopEdges;
+    for (const Edge &edge : compact.edges())
+        loopEdges.push_back(edge);
+    EXPECT_EQ(loopEdges, std::list<Edge>({{0, 2}, {0, 4}, {3, 1}}));
+}
+
+TEST(CompactDirectedGraph, edges_noEdge_emptyLoop) {
+    CompactDirectedGraph emptyGraph(3);
+    CompactDirectedGraph nullGraph;
+
+    EXPECT_EQ(emptyGraph.edges().begin(), emptyGraph.edges().end());
+    EXPECT_EQ(nullGraph.edges().begin(), nullGraph.edges().end());
+}
+
+TEST(
+    CompactDirectedGraph,
+    constructor_vectorStorageWithDuplicates_duplicatesKept
+) {
+    LabeledDirectedGraph<NoLabel, VectorStorage> graph(3);
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2, true);
+
+    CompactDirectedGraph compact(graph);
+    EXPECT_EQ(toVector(compact.getOutNeighbours(0)), Neighbours({1, 2, 2}));
+    EXPECT_EQ(compact.getEdgeNumber(), 3);
+}
+
+TEST(CompactDirectedGraph, operatorEqual_sameEdgesDifferentOrder_equal) {
+    DirectedGraph graph1(3), graph2(3);
+    graph1.addEdge(0, 1);
+    graph1.addEdge(0, 2);
+    graph2.addEdge(0, 2);
+    graph2.addEdge(0, 1);
+
+    EXPECT_EQ(freeze(graph1), freeze(graph2));
+    graph2.addEdge(1, 2);
+    EXPECT_NE(freeze(graph1), freeze(graph2));
+}
+
+TEST(CompactDirectedWeightedGraph, freeze_weightedGraph_weightsKept) {
+    DirectedWeightedGraph graph(3);
+    graph.addEdge(0, 2, 1.5);
+    graph.addEdge(0, 1, -2);
+    graph.addEdge(2, 1, 3);
+    auto compact = freeze(graph);
+
+    EXPECT_EQ(compact.getTotalWeight(), 2.5);
+    EXPECT_EQ(compact.getEdgeWeight(0, 2), 1.5);
+    EXPECT_EQ(
+        toVector(compact.getOutEdgeWeights(0)),
+        std::vector<EdgeWeight>({-2, 1.5})
+    );
+    EXPECT_EQ(compact.getWeightMatrix(), graph.getWeightMatrix());
+}
+
+TEST(CompactDirectedMultigraph, freeze_multigraph_multiplicitiesKept) {
+    DirectedMultigraph graph(3);
+    graph.addMultiedge(0, 2, 3);
+    graph.addMultiedge(0, 1, 2);
+    graph.addEdge(2, 2);
+    auto compact = freeze(graph);
+
+    EXPECT_EQ(compact.getEdgeNumber(), 3);
+    EXPECT_EQ(compact.getTotalEdgeNumber(), 6);
+    EXPECT_EQ(compact.getEdgeMultiplicity(0, 2), 3);
+    EXPECT_EQ(compact.getEdgeMultiplicity(1, 2), 0);
+    EXPECT_EQ(compact.getOutDegrees(), graph.getOutDegrees());
+    EXPECT_EQ(compact.getInDegrees(), graph.getInDegrees());
+    EXPECT_EQ(compact.getAdjacencyMatrix(), graph.getAdjacencyMatrix());
+}
+
+static LabeledUndirectedGraph<std::string> getLabeledUndirectedGraph() {
+    LabeledUndirectedGraph<std::string> graph(4);
+    graph.addEdge(2, 0, std::string("a"));
+    graph.addEdge(0, 1, std::string("b"));
+    graph.addEdge(1, 1, std::string("c"));
+    graph.addEdge(3, 1, std::string("d"));
+    return graph;
+}
+
+TEST(CompactUndirectedGraph, freeze_anyGraph_edgesInBothNeighbourhoods) {
+    auto compact = freeze(getLabeledUndirectedGraph());
+
+    EXPECT_EQ(compact.getEdgeNumber(), 4);
+    EXPECT_EQ(toVector(compact.getNeighbours(0)), Neighbours({1, 2}));
+    EXPECT_EQ(toVector(compact.getNeighbours(1)), Neighbours({0, 1, 3}));
+    EXPECT_EQ(toVector(compact.getNeighbours(2)), Neighbours({0}));
+    EXPECT_TRUE(compact.hasEdge(3, 1, "d"));
+    EXPECT_EQ(compact.getEdgeLabel(1, 3), "d");
+    EXPECT_EQ(compact.getEdgeLabel(3, 1), "d");
+}
+
+TEST(CompactUndirectedGraph, getDegree_selfLoop_countedAsInOriginalGraph) {
+    auto graph = getLabeledUndirectedGraph();
+    auto compact = freeze(graph);
+
+    EXPECT_EQ(compact.getDegree(1), 4);
+    EXPECT_EQ(compact.getDegree(1, false), 3);
+    EXPECT_EQ(compact.getDegrees(), graph.getDegrees());
+    EXPECT_EQ(compact.getAdjacencyMatrix(), graph.getAdjacencyMatrix());
+}
+
+TEST(CompactUndirectedGraph, edges_anyGraph_eachEdgeOnce) {
+    auto compact = freeze(getLabeledUndirectedGraph());
+
+    std::list<Edge> loopEdges;
+    for (const Edge &edge : compact.edges())
+        loopEdges.push_back(edge);
+    EXPECT_EQ(loopEdges, std::list<Edge>({{0, 1}, {0, 2}, {1, 1}, {1, 3}}));
+}
+
+TEST(CompactUndirectedWeightedGraph, freeze_weightedGraph_weightsKept) {
+    UndirectedWeightedGraph graph(3);
+    graph.addEdge(0, 2, 1.5);
+    graph.addEdge(1, 0, 2);
+    auto compact = freeze(graph);
+
+    EXPECT_EQ(compact.getTotalWeight(), 3.5);
+    EXPECT_EQ(compact.getEdgeWeight(2, 0), 1.5);
+    EXPECT_EQ(compact.getWeightMatrix(), graph.getWeightMatrix());
+}
+
+TEST(
+    CompactUndirectedMultigraph,
+    freeze_multigraph_degreesCountMultiplicities
+) {
+    UndirectedMultigraph graph(3);
+    graph.addMultiedge(0, 2, 3);
+    graph.addMultiedge(1, 1, 2);
+    graph.addEdge(1, 0);
+    auto compact = freeze(graph);
+
+    EXPECT_EQ(compact.getTotalEdgeNumber(), 6);
+    EXPECT_EQ(compact.getEdgeMultiplicity(2, 0), 3);
+    EXPECT_EQ(compact.getDegrees(), graph.getDegrees());
+    EXPECT_EQ(compact.getDegrees(false), graph.getDegrees(false));
+    EXPECT_EQ(compact.getAdjacencyMatrix(), graph.getAdjacencyMatrix());
+}
+
+TEST(CompactGraphAlgorithms, paths_compactGraph_sameResultAsOriginalGraph) {
+    std::list<Edge> edges = {{0, 1}, {1, 2}, {2, 3}, {0, 4}, {4, 3}, {3, 5}};
+    UndirectedGraph graph(edges);
+    auto compact = freeze(graph);
+
+    EXPECT_EQ(
+        algorithms::findAllGeodesics(compact, 0, 5),
+        algorithms::findAllGeodesics(graph, 0, 5)
+    );
+    EXPECT_EQ(
+        algorithms::findGeodesicsFromVertex(compact, 2),
+        algorithms::findGeodesicsFromVertex(graph, 2)
+    );
+}
+
+TEST(CompactGraphAlgorithms, dijkstra_compactWeightedGraph_sameResult) {
+    DirectedWeightedGraph graph(4);
+    graph.addEdge(0, 1, 1);
+    graph.addEdge(1, 2, 1);
+    graph.addEdge(0, 2, 3);
+    graph.addEdge(2, 3, 0.5);
+
+    EXPECT_EQ(
+        algorithms::findGeodesicsDijkstra(freeze(graph), 0),
+        algorithms::findGeodesicsDijkstra(graph, 0)
+    );
+}
+
+TEST(CompactGraphAlgorithms, getSubgraph_compactGraph_compactSubgraph) {
+    auto compact = freeze(getLabeledUndirectedGraph());
+
+    LabeledCompactUndirectedGraph<std::string> subgraph =
+        algorithms::getSubgraph(compact, {0, 1, 3});
+    EXPECT_EQ(subgraph.getSize(), 4);
+    EXPECT_EQ(subgraph.getEdgeNumber(), 3);
+    EXPECT_EQ(subgraph.getEdgeLabel(1, 3), "d");
+    EXPECT_FALSE(subgraph.hasEdge(0, 2));
+
+    auto remapped = algorithms::getSubgraphWithRemap(
+        freeze(getLabeledDirectedGraph()), {0, 3}
+    );
+    EXPECT_EQ(remapped.first.getSize(), 2);
+    EXPECT_EQ(remapped.first.getEdgeNumber(), 2);
+    EXPECT_EQ(
+        remapped.first.getEdgeLabel(remapped.second[3], remapped.second[0]), "e"
+    );
+}
@@ -0,0 +1,170 @@
+#include "BaseGraph/algorithms/paths.hpp"
+#include "BaseGraph/compressed_directed_graph.hpp"
+#include "BaseGraph/compressed_undirected_graph.hpp"
+#include "fixtures.hpp"
+
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> Neighbours;
+
+TEST(CompressedDirectedGraph, compress_anyGraph_neighboursSortedAndEdgesKept) {
+    auto compressed = compress(getLabeledDirectedGraph());
+
+    EXPECT_EQ(compressed.getSize(), 5);
+    EXPECT_EQ(compressed.getEdgeNumber(), 6);
+    EXPECT_EQ(toVector(compressed.getOutNeighbours(0)), Neighbours({1, 2, 3}));
+    EXPECT_EQ(toVector(compressed.getOutNeighbours(1)), Neighbours({}));
+    EXPECT_EQ(toVector(compressed.getOutNeighbours(2)), Neighbours({2}));
+    EXPECT_EQ(toVector(compressed.getOutNeighbours(4)), Neighbours({0}));
+    EXPECT_TRUE(compressed.getOutNeighbours(1).empty());
+}
+
+TEST(CompressedDirectedGraph, compress_largeGaps_neighboursDecoded) {
+    DirectedGraph graph(1000000);
+    graph.addEdge(999999, 0);
+    graph.addEdge(999999, 127);
+    graph.addEdge(999999, 128);
+    graph.addEdge(999999, 500000);
+    graph.addEdge(999999, 999999);
+    graph.addEdge(3, 999998);
+    graph.addEdge(3, 999998, true);
+
+    CompressedDirectedGraph compressed(graph);
+
+    EXPECT_EQ(
+        toVector(compressed.getOutNeighbours(999999)),
+        Neighbours({0, 127, 128, 500000, 999999})
+    );
+    EXPECT_EQ(
+        toVector(compressed.getOutNeighbours(3)), Neighbours({999998, 999998})
+    );
+    EXPECT_EQ(compressed.getEdgeNumber(), 7);
+}
+
+TEST(CompressedDirectedGraph, getMemoryUsage_closeNeighbours_oneBytePerEdge) {
+    DirectedGraph graph(100);
+    for (VertexIndex i = 0; i < 100; ++i)
+        for (VertexIndex j = i; j < 100 && j < i + 10; ++j)
+            graph.addEdge(i, j);
+
+    CompressedDirectedGraph compressed(graph);
+
+    // Each row holds its degree and one byte per neighbour.
+    EXPECT_EQ(
+        compressed.getMemoryUsage().adjacency,
+        101 * sizeof(size_t) + 100 + graph.getEdgeNumber()
+    );
+}
+
+TEST(CompressedDirectedGraph, hasEdge_anyEdge_correctAnswer) {
+    auto compressed = compress(getLabeledDirectedGraph());
+
+    EXPECT_TRUE(compressed.hasEdge(0, 2));
+    EXPECT_TRUE(compressed.hasEdge(2, 2));
+    EXPECT_FALSE(compressed.hasEdge(0, 4));
+    EXPECT_FALSE(compressed.hasEdge(1, 0));
+    EXPECT_THROW(compressed.hasEdge(0, 5), std::out_of_range);
+    EXPECT_THROW(compressed.hasEdge(5, 0), std::out_of_range);
+}
+
+TEST(CompressedDirectedGraph, degrees_anyGraph_sameAsOriginalGraph) {
+    auto graph = getLabeledDirectedGraph();
+    auto compressed = compress(graph);
+
+    EXPECT_EQ(compressed.getOutDegree(0), 3);
+    EXPECT_EQ(compressed.getOutDegrees(), graph.getOutDegrees());
+    EXPECT_EQ(compressed.getInDegree(0), 2);
+    EXPECT_EQ(compressed.getInDegrees(), graph.getInDegrees());
+    EXPECT_EQ(compressed.getAdjacencyMatrix(), graph.getAdjacencyMatrix());
+}
+
+TEST(CompressedDirectedGraph, edges_anyGraph_allEdgesInOrder) {
+    auto compressed = compress(getLabeledDirectedGraph());
+
+    std::vector<Edge> edges;
+    for (auto edge : compressed.edges())
+        edges.push_back(edge);
+
+    EXPECT_EQ(
+        edges,
+        std::vector<Edge>({{0, 1}, {0, 2}, {0, 3}, {2, 2}, {3, 0}, {4, 0}})
+    );
+}
+
+TEST(CompressedDirectedGraph, equalityOperator_sameEdgesInOtherOrder_equal) {
+    DirectedGraph graph1(3), graph2(3);
+    graph1.addEdge(0, 2);
+    graph1.addEdge(0, 1);
+    graph2.addEdge(0, 1);
+    graph2.addEdge(0, 2);
+
+    EXPECT_EQ(compress(graph1), compress(graph2));
+    graph2.addEdge(1, 2);
+    EXPECT_NE(compress(graph1), compress(graph2));
+    EXPECT_EQ(compress(DirectedGraph(3)), CompressedDirectedGraph(3));
+}
+
+TEST(CompressedDirectedGraph, findVertexPredecessors_sameAsOriginalGraph) {
+    auto graph = getLabeledDirectedGraph();
+
+    EXPECT_EQ(
+        algorithms::findVertexPredecessors(compress(graph), 4),
+        algorithms::findVertexPredecessors(graph, 4)
+    );
+    EXPECT_EQ(
+        algorithms::findAllGeodesicsFromVertex(compress(graph), 3),
+        algorithms::findAllGeodesicsFromVertex(graph, 3)
+    );
+}
+
+TEST(CompressedUndirectedGraph, compress_anyGraph_edgesStoredInBothEndpoints) {
+    UndirectedGraph graph(4);
+    graph.addEdge(0, 2);
+    graph.addEdge(2, 1);
+    graph.addEdge(3, 3);
+    graph.addEdge(3, 0);
+
+    auto compressed = compress(graph);
+
+    EXPECT_EQ(compressed.getEdgeNumber(), 4);
+    EXPECT_EQ(toVector(compressed.getNeighbours(0)), Neighbours({2, 3}));
+    EXPECT_EQ(toVector(compressed.getNeighbours(2)), Neighbours({0, 1}));
+    EXPECT_EQ(toVector(compressed.getNeighbours(3)), Neighbours({0, 3}));
+    EXPECT_TRUE(compressed.hasEdge(1, 2));
+    EXPECT_EQ(compressed.getDegree(3), 3);
+    EXPECT_EQ(compressed.getDegree(3, false), 2);
+    EXPECT_EQ(compressed.getDegrees(), graph.getDegrees());
+    EXPECT_EQ(compressed.getAdjacencyMatrix(), graph.getAdjacencyMatrix());
+}
+
+TEST(CompressedUndirectedGraph, edges_anyGraph_eachEdgeOnce) {
+    UndirectedGraph graph(4);
+    graph.addEdge(0, 2);
+    graph.addEdge(2, 1);
+    graph.addEdge(3, 3);
+    graph.addEdge(3, 0);
+
+    auto compressed = compress(graph);
+    std::vector<Edge> edges;
+    for (auto edge : compressed.edges())
+        edges.push_back(edge);
+
+    EXPECT_EQ(edges, std::vector<Edge>({{0, 2}, {0, 3}, {1, 2}, {3, 3}}));
+}
+
+TEST(CompressedUndirectedGraph, findVertexPredecessors_sameAsOriginalGraph) {
+    UndirectedGraph graph(5);
+    graph.addEdge(0, 1);
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(0, 3);
+
+    EXPECT_EQ(
+        algorithms::findVertexPredecessors(compress(graph), 0),
+        algorithms::findVertexPredecessors(graph, 0)
+    );
+}
@@ -0,0 +1,131 @@
+#include "BaseGraph/concurrent_insertion.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace BaseGraph;
+
+static const size_t threadNumber = 8;
+static const size_t vertexNumber = 50;
+
+// Every edge is generated twice, possibly by different threads.
+static std::vector<Edge> getEdges() {
+    std::vector<Edge> edges;
+    unsigned int state = 2024;
+    for (size_t k = 0; k < 2000; ++k) {
+        state = state * 1103515245 + 12345;
+        VertexIndex source = (state >> 8) % vertexNumber;
+        state = state * 1103515245 + 12345;
+        edges.push_back({source, VertexIndex((state >> 8) % vertexNumber)});
+    }
+    std::vector<Edge> duplicatedEdges(edges.rbegin(), edges.rend());
+    edges.insert(edges.end(), duplicatedEdges.begin(), duplicatedEdges.end());
+    return edges;
+}
+
+template <typename Inserter>
+static void insertFromThreads(
+    Inserter &inserter, const std::vector<Edge> &edges, bool force = false
+) {
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadNumber; ++t)
+        threads.emplace_back([&, t]() {
+            for (size_t k = t; k < edges.size(); k += threadNumber)
+                inserter.addEdge(edges[k].first, edges[k].second, force);
+        });
+    for (auto &thread : threads)
+        thread.join();
+}
+
+template <typename Graph>
+static std::vector<VertexIndex>
+getSortedNeighbours(const Graph &graph, VertexIndex vertex) {
+    auto neighbours = graph.getOutNeighbours(vertex);
+    std::vector<VertexIndex> sorted(neighbours.begin(), neighbours.end());
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
+template <typename Graph1, typename Graph2>
+static void expectSameNeighbours(const Graph1 &graph, const Graph2 &expected) {
+    EXPECT_EQ(graph.getEdgeNumber(), expected.getEdgeNumber());
+    for (VertexIndex i : expected)
+        EXPECT_EQ(
+            getSortedNeighbours(graph, i), getSortedNeighbours(expected, i)
+        );
+}
+
+TEST(ConcurrentEdgeInserter, directedGraph_sameAsSerialInsertion) {
+    auto edges = getEdges();
+    DirectedGraph expectedGraph(vertexNumber);
+    for (auto edge : edges)
+        expectedGraph.addEdge(edge.first, edge.second);
+
+    DirectedGraph graph(vertexNumber);
+    graph.trackInNeighbours();
+    {
+        ConcurrentEdgeInserter<DirectedGraph> inserter(graph, 7);
+        insertFromThreads(inserter, edges);
+        EXPECT_EQ(
+            inserter.getInsertedEdgeNumber(), expectedGraph.getEdgeNumber()
+        );
+    }
+    expectSameNeighbours(graph, expectedGraph);
+    for (VertexIndex i : graph)
+        EXPECT_EQ(graph.getInDegree(i), expectedGraph.getInDegree(i));
+}
+
+TEST(ConcurrentEdgeInserter, undirectedGraph_sameAsSerialInsertion) {
+    auto edges = getEdges();
+    UndirectedGraph expectedGraph(vertexNumber);
+    for (auto edge : edges)
+        expectedGraph.addEdge(edge.first, edge.second);
+
+    LabeledUndirectedGraph<NoLabel, SortedStorage<>> graph(vertexNumber);
+    {
+        ConcurrentEdgeInserter<decltype(graph)> inserter(graph);
+        insertFromThreads(inserter, edges);
+    }
+    expectSameNeighbours(graph, expectedGraph);
+    for (VertexIndex i : graph) {
+        auto neighbours = graph.getNeighbours(i);
+        EXPECT_TRUE(std::is_sorted(neighbours.begin(), neighbours.end()));
+    }
+}
+
+TEST(ConcurrentEdgeInserter, forcedInsertion_everyEdgeAdded) {
+    auto edges = getEdges();
+    UndirectedGraph graph(vertexNumber);
+    {
+        ConcurrentEdgeInserter<UndirectedGraph> inserter(graph, 1);
+        insertFromThreads(inserter, edges, true);
+    }
+    EXPECT_EQ(graph.getEdgeNumber(), edges.size());
+
+    size_t degreeSum = 0;
+    for (VertexIndex i : graph)
+        degreeSum += graph.getDegree(i);
+    EXPECT_EQ(degreeSum, 2 * edges.size());
+}
+
+TEST(ConcurrentEdgeInserter, labeledGraph_labelsKept) {
+    LabeledDirectedGraph<std::string> graph(3);
+    {
+        ConcurrentEdgeInserter<LabeledDirectedGraph<std::string>> inserter(
+            graph
+        );
+        EXPECT_TRUE(inserter.addEdge(0, 1, std::string("a")));
+        EXPECT_FALSE(inserter.addEdge(0, 1, std::string("b")));
+        EXPECT_TRUE(inserter.addEdge(2, 0, std::string("c")));
+        EXPECT_THROW(inserter.addEdge(0, 3), std::out_of_range);
+    }
+    EXPECT_EQ(graph.getEdgeNumber(), 2);
+    EXPECT_EQ(graph.getEdgeLabel(0, 1), "a");
+    EXPECT_EQ(graph.getEdgeLabel(2, 0), "c");
+}
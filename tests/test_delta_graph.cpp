@@ -0,0 +1,141 @@
+#include "BaseGraph/algorithms/paths.hpp"
+#include "BaseGraph/compact_directed_graph.hpp"
+#include "BaseGraph/delta_directed_graph.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "fixtures.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> Neighbours;
+
+static DirectedGraph getBaseGraph() {
+    DirectedGraph graph(5);
+    graph.addEdges(std::vector<Edge>{
+        {0, 1}, {0, 3}, {0, 4}, {1, 2}, {2, 0}, {3, 3}, {4, 1}
+    });
+    return graph;
+}
+
+template <typename Graph>
+static void expectSameEdges(
+    const DeltaDirectedGraph &deltaGraph, const Graph &graph
+) {
+    ASSERT_EQ(deltaGraph.getSize(), graph.getSize());
+    EXPECT_EQ(deltaGraph.getEdgeNumber(), graph.getEdgeNumber());
+    for (VertexIndex i : graph) {
+        Neighbours neighbours = toVector(graph.getOutNeighbours(i));
+        std::sort(neighbours.begin(), neighbours.end());
+        EXPECT_EQ(toVector(deltaGraph.getOutNeighbours(i)), neighbours);
+        EXPECT_EQ(deltaGraph.getOutDegree(i), neighbours.size());
+    }
+}
+
+TEST(DeltaDirectedGraph, anyUpdates_neighboursCombineBaseAndDelta) {
+    DirectedGraph graph = getBaseGraph();
+    DeltaDirectedGraph deltaGraph(freeze(graph));
+
+    deltaGraph.addEdge(0, 2);
+    deltaGraph.addEdge(0, 1);
+    deltaGraph.removeEdge(0, 3);
+    deltaGraph.removeEdge(3, 3);
+    deltaGraph.removeEdge(3, 3);
+    deltaGraph.addEdge(4, 0);
+    deltaGraph.removeEdge(4, 0);
+    deltaGraph.removeEdge(2, 4);
+
+    EXPECT_EQ(toVector(deltaGraph.getOutNeighbours(0)), Neighbours({1, 2, 4}));
+    EXPECT_EQ(toVector(deltaGraph.getOutNeighbours(3)), Neighbours());
+    EXPECT_EQ(toVector(deltaGraph.getOutNeighbours(4)), Neighbours({1}));
+    EXPECT_TRUE(deltaGraph.hasEdge(0, 2));
+    EXPECT_FALSE(deltaGraph.hasEdge(0, 3));
+    EXPECT_EQ(deltaGraph.getEdgeNumber(), 6);
+    EXPECT_EQ(deltaGraph.getDeltaSize(), 3);
+    EXPECT_EQ(deltaGraph.getBaseGraph().getEdgeNumber(), 7);
+
+    deltaGraph.addEdge(0, 3);
+    EXPECT_TRUE(deltaGraph.hasEdge(0, 3));
+    EXPECT_EQ(deltaGraph.getDeltaSize(), 2);
+    EXPECT_THROW(deltaGraph.addEdge(0, 5), std::out_of_range);
+}
+
+TEST(DeltaDirectedGraph, randomUpdates_sameAsMutableGraph) {
+    DirectedGraph graph = getBaseGraph();
+    DeltaDirectedGraph deltaGraph(freeze(graph));
+    graph.resize(7);
+    deltaGraph.resize(7);
+
+    unsigned int state = 12345;
+    auto nextVertex = [&]() {
+        state = state * 1103515245 + 12345;
+        return VertexIndex((state >> 16) % 7);
+    };
+    for (size_t step = 0; step < 300; ++step) {
+        VertexIndex source = nextVertex(), destination = nextVertex();
+        if (step % 3 == 0) {
+            graph.removeEdge(source, destination);
+            deltaGraph.removeEdge(source, destination);
+        } else {
+            graph.addEdge(source, destination);
+            deltaGraph.addEdge(source, destination);
+        }
+        if (step == 150)
+            deltaGraph.merge();
+    }
+    expectSameEdges(deltaGraph, graph);
+    for (VertexIndex source : {0, 3, 6})
+        EXPECT_EQ(
+            algorithms::findVertexPredecessors(deltaGraph, source).first,
+            algorithms::findVertexPredecessors(graph, source).first
+        );
+
+    deltaGraph.merge();
+    EXPECT_EQ(deltaGraph.getDeltaSize(), 0);
+    expectSameEdges(deltaGraph, graph);
+}
+
+TEST(DeltaDirectedGraph, mergeWithSnapshot_laterUpdatesKept) {
+    DirectedGraph graph = getBaseGraph();
+    DeltaDirectedGraph deltaGraph(freeze(graph));
+    deltaGraph.addEdge(1, 4);
+    deltaGraph.removeEdge(0, 1);
+
+    DeltaDirectedGraph snapshot = deltaGraph;
+    auto mergedBase = snapshot.getMergedGraph();
+    deltaGraph.addEdge(2, 3);
+    deltaGraph.removeEdge(1, 4);
+    deltaGraph.addEdge(0, 1);
+    deltaGraph.merge(mergedBase, snapshot);
+
+    EXPECT_EQ(deltaGraph.getBaseGraph(), mergedBase);
+    EXPECT_EQ(deltaGraph.getDeltaSize(), 3);
+    graph.addEdge(2, 3);
+    expectSameEdges(deltaGraph, graph);
+    EXPECT_THROW(deltaGraph.merge(mergedBase, snapshot), std::invalid_argument);
+}
+
+TEST(LabeledDeltaDirectedGraph, anyUpdates_labelsKept) {
+    LabeledDirectedGraph<std::string> graph(3);
+    graph.addEdge(0, 1, std::string("a"));
+    graph.addEdge(1, 2, std::string("b"));
+    LabeledDeltaDirectedGraph<std::string> deltaGraph(freeze(graph));
+
+    deltaGraph.addEdge(0, 2, std::string("c"));
+    deltaGraph.removeEdge(1, 2);
+    deltaGraph.addEdge(1, 2, std::string("d"));
+    EXPECT_EQ(deltaGraph.getEdgeLabel(0, 1), "a");
+    EXPECT_EQ(deltaGraph.getEdgeLabel(0, 2), "c");
+    EXPECT_EQ(deltaGraph.getEdgeLabel(1, 2), "d");
+    EXPECT_EQ(deltaGraph.getEdgeLabel(2, 0, false), "");
+    EXPECT_THROW(deltaGraph.getEdgeLabel(2, 0), std::invalid_argument);
+
+    auto mergedGraph = deltaGraph.getMergedGraph();
+    EXPECT_EQ(mergedGraph.getEdgeNumber(), 3);
+    EXPECT_EQ(mergedGraph.getEdgeLabel(1, 2), "d");
+    EXPECT_EQ(mergedGraph.getEdgeLabel(0, 2), "c");
+}
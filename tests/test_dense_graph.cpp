@@ -0,0 +1,175 @@
+#include "BaseGraph/algorithms/paths.hpp"
+#include "BaseGraph/dense_directed_graph.hpp"
+#include "BaseGraph/dense_undirected_graph.hpp"
+#include "fixtures.hpp"
+
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> Neighbours;
+
+TEST(DenseDirectedGraph, addEdge_anyEdges_neighboursInIncreasingOrder) {
+    DenseDirectedGraph graph(130);
+    graph.addEdge(0, 129);
+    graph.addEdge(0, 64);
+    graph.addEdge(0, 0);
+    graph.addEdge(0, 63);
+    graph.addEdge(0, 64);
+
+    EXPECT_EQ(
+        toVector(graph.getOutNeighbours(0)), Neighbours({0, 63, 64, 129})
+    );
+    EXPECT_TRUE(graph.getOutNeighbours(1).empty());
+    EXPECT_EQ(graph.getEdgeNumber(), 4);
+    EXPECT_EQ(graph.getOutDegree(0), 4);
+}
+
+TEST(DenseDirectedGraph, hasEdge_existentAndInexistentEdges_correctAnswer) {
+    DenseDirectedGraph graph(3);
+    graph.addEdge(0, 2);
+
+    EXPECT_TRUE(graph.hasEdge(0, 2));
+    EXPECT_FALSE(graph.hasEdge(2, 0));
+    EXPECT_THROW(graph.hasEdge(0, 3), std::out_of_range);
+    EXPECT_THROW(graph.addEdge(3, 0), std::out_of_range);
+}
+
+TEST(DenseDirectedGraph, removeEdge_anyEdge_edgeNumberUpdated) {
+    DenseDirectedGraph graph(3);
+    graph.addEdge(0, 2);
+    graph.addEdge(1, 2);
+
+    graph.removeEdge(0, 2);
+    graph.removeEdge(2, 1);
+
+    EXPECT_FALSE(graph.hasEdge(0, 2));
+    EXPECT_TRUE(graph.hasEdge(1, 2));
+    EXPECT_EQ(graph.getEdgeNumber(), 1);
+
+    graph.clearEdges();
+    EXPECT_EQ(graph.getEdgeNumber(), 0);
+    EXPECT_FALSE(graph.hasEdge(1, 2));
+}
+
+TEST(DenseDirectedGraph, constructor_listGraph_sameEdgesAndDegrees) {
+    DirectedGraph graph(4);
+    graph.addEdge(0, 3);
+    graph.addEdge(0, 1);
+    graph.addEdge(2, 1);
+    graph.addEdge(3, 3);
+    graph.addEdge(0, 1, true);
+
+    DenseDirectedGraph dense(graph);
+
+    EXPECT_EQ(dense.getEdgeNumber(), 4);
+    EXPECT_EQ(toVector(dense.getOutNeighbours(0)), Neighbours({1, 3}));
+    EXPECT_EQ(dense.getOutDegrees(), std::vector<size_t>({2, 0, 1, 1}));
+    EXPECT_EQ(dense.getInDegrees(), std::vector<size_t>({0, 2, 0, 2}));
+    EXPECT_EQ(dense.getInDegree(1), 2);
+    EXPECT_EQ(
+        algorithms::findVertexPredecessors(dense, 0),
+        algorithms::findVertexPredecessors(graph, 0)
+    );
+}
+
+TEST(DenseDirectedGraph, intersectionAndUnion_rowsOverManyWords_wordsCombined) {
+    DenseDirectedGraph graph(200);
+    for (VertexIndex j : {1, 70, 150, 199})
+        graph.addEdge(0, j);
+    for (VertexIndex j : {2, 70, 199})
+        graph.addEdge(5, j);
+
+    EXPECT_EQ(graph.getCommonOutNeighbours(0, 5), Neighbours({70, 199}));
+    EXPECT_EQ(graph.countCommonOutNeighbours(0, 5), 2);
+    EXPECT_EQ(
+        graph.getOutNeighbourUnion(0, 5), Neighbours({1, 2, 70, 150, 199})
+    );
+    EXPECT_EQ(graph.countOutNeighbourUnion(0, 5), 5);
+}
+
+TEST(DenseDirectedGraph, edges_anyGraph_edgesGroupedBySource) {
+    DenseDirectedGraph graph(70);
+    graph.addEdge(69, 0);
+    graph.addEdge(2, 65);
+    graph.addEdge(2, 1);
+
+    std::vector<Edge> edges;
+    for (auto edge : graph.edges())
+        edges.push_back(edge);
+
+    EXPECT_EQ(edges, std::vector<Edge>({{2, 1}, {2, 65}, {69, 0}}));
+}
+
+TEST(DenseDirectedGraph, resize_smallerSize_edgesOfRemovedVerticesRemoved) {
+    DenseDirectedGraph graph(70);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 69);
+    graph.addEdge(69, 1);
+
+    graph.resize(65);
+
+    EXPECT_EQ(graph.getSize(), 65);
+    EXPECT_EQ(graph.getEdgeNumber(), 1);
+    EXPECT_TRUE(graph.hasEdge(0, 1));
+    EXPECT_EQ(graph.getMemoryUsage().adjacency, 65 * 2 * sizeof(uint64_t));
+}
+
+TEST(DenseUndirectedGraph, addAndRemoveEdge_anyEdge_bothRowsUpdated) {
+    DenseUndirectedGraph graph(4);
+    graph.addEdge(0, 2);
+    graph.addEdge(2, 0);
+    graph.addEdge(3, 3);
+    graph.addEdge(1, 2);
+
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+    EXPECT_TRUE(graph.hasEdge(2, 0));
+    EXPECT_EQ(toVector(graph.getNeighbours(2)), Neighbours({0, 1}));
+
+    graph.removeEdge(2, 0);
+    EXPECT_FALSE(graph.hasEdge(0, 2));
+    EXPECT_EQ(graph.getEdgeNumber(), 2);
+}
+
+TEST(DenseUndirectedGraph, degrees_selfLoops_countedTwiceByDefault) {
+    UndirectedGraph graph(4);
+    graph.addEdge(0, 2);
+    graph.addEdge(3, 3);
+    graph.addEdge(3, 0);
+
+    DenseUndirectedGraph dense(graph);
+
+    EXPECT_EQ(dense.getDegree(3), 3);
+    EXPECT_EQ(dense.getDegree(3, false), 2);
+    EXPECT_EQ(dense.getDegrees(), graph.getDegrees());
+    EXPECT_EQ(dense.getAdjacencyMatrix(), graph.getAdjacencyMatrix());
+}
+
+TEST(DenseUndirectedGraph, commonNeighbours_triangle_thirdVertexFound) {
+    DenseUndirectedGraph graph(4);
+    graph.addEdge(0, 1);
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 0);
+    graph.addEdge(2, 3);
+
+    EXPECT_EQ(graph.getCommonNeighbours(0, 1), Neighbours({2}));
+    EXPECT_EQ(graph.countCommonNeighbours(0, 3), 1);
+    EXPECT_EQ(graph.getNeighbourUnion(0, 3), Neighbours({1, 2}));
+    EXPECT_EQ(graph.countNeighbourUnion(1, 2), 4);
+}
+
+TEST(DenseUndirectedGraph, edges_anyGraph_eachEdgeOnce) {
+    DenseUndirectedGraph graph(4);
+    graph.addEdge(0, 2);
+    graph.addEdge(2, 1);
+    graph.addEdge(3, 3);
+    graph.addEdge(3, 0);
+
+    std::vector<Edge> edges;
+    for (auto edge : graph.edges())
+        edges.push_back(edge);
+
+    EXPECT_EQ(edges, std::vector<Edge>({{0, 2}, {0, 3}, {1, 2}, {3, 3}}));
+}
@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include <deque>
 #include <list>
+#include <set>
 #include <stdexcept>
 
 typedef ::testing::Types<std::string, int> TestTypes;
@@ -196,6 +197,40 @@ TYPED_TEST(
     );
 }
 
+TYPED_TEST(LabeledDirectedGraph_, setEdgeLabel_forceInexistentEdge_doNothing) {
+    this->graph.setEdgeLabel(0, 2, this->labels[0], true);
+
+    EXPECT_FALSE(this->graph.hasEdge(0, 2));
+    EXPECT_EQ(this->graph.getEdgeNumber(), 0);
+}
+
+TYPED_TEST(
+    LabeledDirectedGraph_, getOutEdgeLabels_anyEdges_labelsInNeighbourOrder
+) {
+    this->graph.addEdge(0, 2, this->labels[0]);
+    this->graph.addEdge(0, 1, this->labels[1]);
+    this->graph.addEdge(0, 3, this->labels[2]);
+
+    std::list<TypeParam> expectedLabels = {
+        this->labels[0], this->labels[1], this->labels[2]};
+    EXPECT_EQ(this->graph.getOutEdgeLabels(0), expectedLabels);
+    EXPECT_EQ(this->graph.getOutEdgeLabels(1), std::list<TypeParam>());
+}
+
+TYPED_TEST(
+    LabeledDirectedGraph_, getOutEdgeLabels_edgeRemoved_labelsStayAligned
+) {
+    this->graph.addEdge(0, 2, this->labels[0]);
+    this->graph.addEdge(0, 1, this->labels[1]);
+    this->graph.addEdge(0, 3, this->labels[2]);
+    this->graph.removeEdge(0, 1);
+
+    this->EXPECT_NEIGHBOURS(0, {2, 3});
+    std::list<TypeParam> expectedLabels = {this->labels[0], this->labels[2]};
+    EXPECT_EQ(this->graph.getOutEdgeLabels(0), expectedLabels);
+    this->EXPECT_LABEL({0, 3}, 2);
+}
+
 TYPED_TEST(
     LabeledDirectedGraph_, setEdgeLabel_vertexOutOfRange_throwInvalidArgument
 ) {
@@ -460,6 +495,31 @@ TYPED_TEST(LabeledDirectedGraph_, equalityOperator_oppositeEdges_returnFalse) {
     EXPECT_FALSE(graph2 == graph);
 }
 
+TYPED_TEST(
+    LabeledDirectedGraph_,
+    equalityOperator_parallelEdgesWithDifferentLabels_comparedAsMultiset
+) {
+    BaseGraph::LabeledDirectedGraph<TypeParam> graph(2);
+    BaseGraph::LabeledDirectedGraph<TypeParam> graph2(2);
+    graph.addEdge(0, 1, this->labels[0], true);
+    graph.addEdge(0, 1, this->labels[1], true);
+    graph.addEdge(0, 1, this->labels[1], true);
+    graph2.addEdge(0, 1, this->labels[1], true);
+    graph2.addEdge(0, 1, this->labels[0], true);
+    graph2.addEdge(0, 1, this->labels[1], true);
+
+    EXPECT_TRUE(graph == graph);
+    EXPECT_TRUE(graph == graph2);
+    EXPECT_TRUE(graph2 == graph);
+
+    BaseGraph::LabeledDirectedGraph<TypeParam> graph3(2);
+    graph3.addEdge(0, 1, this->labels[0], true);
+    graph3.addEdge(0, 1, this->labels[0], true);
+    graph3.addEdge(0, 1, this->labels[1], true);
+    EXPECT_FALSE(graph == graph3);
+    EXPECT_FALSE(graph3 == graph);
+}
+
 template <template <class...> class Container, class... Args, typename Labels>
 static void hasEdgesWithContainer(Labels &labels) {
     using EdgeLabel = typename Labels::value_type;
@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include <deque>
 #include <list>
+#include <set>
 #include <queue>
 #include <stdexcept>
 
@@ -227,6 +228,21 @@ TEST(DirectedMultigraph, getEdgeMultiplicity_inexistentEdge_return0) {
     EXPECT_EQ(graph.getEdgeMultiplicity(1, 0), 0);
 }
 
+TEST(
+    DirectedMultigraph,
+    getOutEdgeMultiplicities_anyEdges_multiplicitiesOfNeighbours
+) {
+    BaseGraph::DirectedMultigraph graph(3);
+    graph.addMultiedge(0, 2, 3);
+    graph.addEdge(0, 0);
+    graph.addEdge(0, 2);
+
+    EXPECT_EQ(
+        graph.getOutEdgeMultiplicities(0), std::list<unsigned int>({4, 1})
+    );
+    EXPECT_EQ(graph.getOutDegree(0), 5);
+}
+
 TEST(DirectedMultigraph, getEdgeMultiplicity_vertexOutOfRange_throwOutOfRange) {
     BaseGraph::DirectedMultigraph graph(0);
     EXPECT_THROW(graph.getEdgeMultiplicity(0, 0), std::out_of_range);
@@ -281,6 +297,28 @@ TEST(DirectedMultigraph, getInDegrees_anyGraph_returnCorrectDegrees) {
     EXPECT_EQ(graph.getInDegree(2), 0);
 }
 
+TEST(DirectedMultigraph, degrees_afterEdgeRemovals_degreesUpdated) {
+    BaseGraph::DirectedMultigraph graph(3);
+    graph.addMultiedge(0, 1, 3);
+    graph.addMultiedge(1, 2, 2);
+    graph.addEdge(2, 0);
+    graph.addEdge(2, 2);
+
+    graph.removeMultiedge(0, 1, 2);
+    graph.setEdgeMultiplicity(1, 2, 5);
+    EXPECT_EQ(graph.getOutDegrees(), std::vector<size_t>({1, 5, 2}));
+    EXPECT_EQ(graph.getInDegrees(), std::vector<size_t>({1, 1, 6}));
+
+    graph.removeVertexFromEdgeList(2);
+    EXPECT_EQ(graph.getOutDegrees(), std::vector<size_t>({1, 0, 0}));
+    EXPECT_EQ(graph.getInDegrees(), std::vector<size_t>({0, 1, 0}));
+
+    graph.resize(4);
+    graph.clearEdges();
+    EXPECT_EQ(graph.getOutDegrees(), std::vector<size_t>({0, 0, 0, 0}));
+    EXPECT_EQ(graph.getInDegree(3), 0);
+}
+
 TEST(DirectedMultigraph, getDegree_vertexOutOfRange_throwOutOfRange) {
     BaseGraph::DirectedMultigraph graph(0);
 
@@ -372,6 +410,26 @@ TEST(
     );
 }
 
+TEST(DirectedMultigraph, mergeDuplicateEdges_multiedge_multiplicitiesSummed) {
+    BaseGraph::DirectedMultigraph graph(multiplicities.size());
+    graph.addMultiedge(0, 1, multiplicities[0]);
+    graph.addMultiedge(0, 2, multiplicities[1]);
+    graph.addMultiedge(0, 1, multiplicities[0], true);
+    graph.addMultiedge(1, 1, multiplicities[2]);
+    graph.addMultiedge(1, 1, multiplicities[2], true);
+
+    graph.mergeDuplicateEdges();
+
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+    EXPECT_EQ(graph.getEdgeMultiplicity(0, 1), 2 * multiplicities[0]);
+    EXPECT_EQ(graph.getEdgeMultiplicity(1, 1), 2 * multiplicities[2]);
+    EXPECT_EQ(
+        graph.getTotalEdgeNumber(),
+        2 * multiplicities[0] + multiplicities[1] + 2 * multiplicities[2]
+    );
+    EXPECT_EQ(graph.getOutDegree(0), 2 * multiplicities[0] + multiplicities[1]);
+}
+
 TEST(DirectedMultigraph, removeSelfLoops_noSelfLoop_doNothing) {
     BaseGraph::DirectedMultigraph graph(multiplicities.size());
     graph.addMultiedge(0, 1, multiplicities[0]);
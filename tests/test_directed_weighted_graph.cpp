@@ -97,6 +97,18 @@ TEST(
     EXPECT_EQ(graph.getTotalWeight(), 0);
 }
 
+TEST(DirectedWeightedGraph, getOutEdgeWeights_edgeRemoved_weightsStayAligned) {
+    BaseGraph::DirectedWeightedGraph graph(3);
+    graph.addEdge(0, 2, 1.5);
+    graph.addEdge(0, 1, -2);
+    graph.addEdge(0, 0, 1);
+    graph.removeEdge(0, 1);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), BaseGraph::Successors({2, 0}));
+    EXPECT_EQ(graph.getOutEdgeWeights(0), std::list<double>({1.5, 1}));
+    EXPECT_EQ(graph.getTotalWeight(), 2.5);
+}
+
 TEST(DirectedWeightedGraph, setEdgeWeight_vertexOutOfRange_throwOutOfRange) {
     BaseGraph::DirectedWeightedGraph graph(0);
     EXPECT_THROW(graph.setEdgeWeight(0, 0, 1), std::out_of_range);
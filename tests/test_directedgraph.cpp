@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <deque>
 #include <list>
+#include <set>
 #include <stdexcept>
 
 TEST(DirectedGraph, getEdgesFrom_vertexOutOfRange_throwInvalidArgument) {
@@ -482,3 +483,17 @@ TEST(DirectedGraph, equalityOperator_oppositeEdges_returnFalse) {
     EXPECT_FALSE(graph == graph2);
     EXPECT_FALSE(graph2 == graph);
 }
+
+TEST(
+    DirectedGraph, equalityOperator_duplicateEdgesInsteadOfEdge_returnFalse
+) {
+    BaseGraph::DirectedGraph graph(3);
+    BaseGraph::DirectedGraph graph2(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 1, true);
+    graph2.addEdge(0, 1);
+    graph2.addEdge(0, 2);
+
+    EXPECT_FALSE(graph == graph2);
+    EXPECT_FALSE(graph2 == graph);
+}
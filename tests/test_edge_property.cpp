@@ -0,0 +1,89 @@
+#include "BaseGraph/compact_directed_graph.hpp"
+#include "BaseGraph/compact_undirected_graph.hpp"
+#include "BaseGraph/edge_property.hpp"
+
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include <vector>
+
+using namespace BaseGraph;
+
+static CompactDirectedGraph getDirectedGraph() {
+    DirectedGraph graph(4);
+    graph.addEdges(std::vector<Edge>{{2, 0}, {0, 3}, {0, 1}, {3, 3}, {2, 1}});
+    return freeze(graph);
+}
+
+static CompactUndirectedGraph getUndirectedGraph() {
+    UndirectedGraph graph(4);
+    graph.addEdges(std::vector<Edge>{{2, 0}, {0, 3}, {1, 0}, {3, 3}, {2, 1}});
+    graph.addEdge(1, 0, true);
+    return freeze(graph);
+}
+
+TEST(CompactDirectedGraph, getOutEdges_anyGraph_idsOrderedBySourceThenDest) {
+    auto graph = getDirectedGraph();
+    std::vector<Edge> edgesById;
+    for (VertexIndex i : graph)
+        for (OutEdge edge : graph.getOutEdges(i)) {
+            EXPECT_EQ(edge.id, edgesById.size());
+            EXPECT_EQ(graph.getEdgeId(i, edge.neighbour), edge.id);
+            edgesById.push_back({i, edge.neighbour});
+        }
+    EXPECT_EQ(
+        edgesById, std::vector<Edge>({{0, 1}, {0, 3}, {2, 0}, {2, 1}, {3, 3}})
+    );
+    EXPECT_TRUE(graph.getOutEdges(1).empty());
+    EXPECT_THROW(graph.getEdgeId(1, 0), std::invalid_argument);
+    EXPECT_THROW(graph.getEdgeId(4, 0), std::out_of_range);
+}
+
+TEST(CompactUndirectedGraph, getOutEdges_anyGraph_idSharedByBothEndpoints) {
+    auto graph = getUndirectedGraph();
+    std::vector<size_t> occurrences(graph.getEdgeNumber(), 0);
+    for (VertexIndex i : graph)
+        for (OutEdge edge : graph.getOutEdges(i)) {
+            ASSERT_LT(edge.id, graph.getEdgeNumber());
+            occurrences[edge.id] += i == edge.neighbour ? 2 : 1;
+        }
+    EXPECT_EQ(occurrences, std::vector<size_t>(graph.getEdgeNumber(), 2));
+
+    EXPECT_EQ(graph.getEdgeId(0, 1), 0);
+    EXPECT_EQ(graph.getEdgeId(1, 0), 0);
+    EXPECT_EQ(graph.getEdgeId(0, 2), 2);
+    EXPECT_EQ(graph.getEdgeId(3, 0), 3);
+    EXPECT_EQ(graph.getEdgeId(2, 1), 4);
+    EXPECT_EQ(graph.getEdgeId(3, 3), 5);
+    EXPECT_THROW(graph.getEdgeId(1, 3), std::invalid_argument);
+}
+
+TEST(CompactUndirectedGraph, getPermutedGraph_anyGraph_idsRebuilt) {
+    auto graph = getUndirectedGraph().getPermutedGraph({3, 2, 1, 0});
+    EdgeProperty<size_t> occurrences(graph);
+    for (VertexIndex i : graph)
+        for (OutEdge edge : graph.getOutEdges(i))
+            occurrences[edge.id] += i == edge.neighbour ? 2 : 1;
+    EXPECT_EQ(
+        occurrences.getValues(), std::vector<size_t>(graph.getEdgeNumber(), 2)
+    );
+    EXPECT_EQ(graph.getEdgeId(3, 2), graph.getEdgeId(2, 3));
+}
+
+TEST(EdgeProperty, compactWeightedGraph_valuesIndexedByEdgeId) {
+    DirectedWeightedGraph mutableGraph(3);
+    mutableGraph.addEdge(0, 1, 1.5);
+    mutableGraph.addEdge(1, 2, 2);
+    mutableGraph.addEdge(2, 0, -1);
+    CompactDirectedWeightedGraph graph(mutableGraph);
+
+    EdgeProperty<double> flows(graph, 1);
+    ASSERT_EQ(flows.size(), 3);
+    for (VertexIndex i : graph)
+        for (OutEdge edge : graph.getOutEdges(i))
+            flows[edge.id] *= graph.getEdgeWeight(i, edge.neighbour);
+    EXPECT_EQ(flows.getValues(), std::vector<double>({1.5, 2, -1}));
+    EXPECT_EQ(flows[graph.getEdgeId(2, 0)], -1);
+
+    EdgeProperty<int> counts(4, 7);
+    EXPECT_EQ(counts.getValues(), std::vector<int>(4, 7));
+}
@@ -0,0 +1,162 @@
+#include "BaseGraph/concurrent_insertion.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+// Rebuilds the graph with its edges added in reverse order, so that its
+// fingerprint is computed from scratch.
+template <typename Graph>
+static Graph getRebuiltGraph(const Graph &graph) {
+    std::vector<Edge> edges;
+    for (auto edge : graph.edges())
+        edges.push_back(edge);
+    Graph rebuiltGraph(graph.getSize());
+    for (auto edge = edges.rbegin(); edge != edges.rend(); ++edge)
+        rebuiltGraph.addEdge(edge->first, edge->second, true);
+    return rebuiltGraph;
+}
+
+TEST(DirectedGraph, getFingerprint_sameEdgesInOtherOrder_sameFingerprint) {
+    DirectedGraph graph1(4), graph2(4);
+    graph1.addEdges(std::vector<Edge>{{0, 1}, {2, 3}, {3, 3}, {0, 2}});
+    graph2.addEdge(0, 2);
+    graph2.addEdge(3, 3);
+    graph2.addEdge(2, 3);
+    graph2.addEdge(0, 1);
+    LabeledDirectedGraph<NoLabel, SortedStorage<>> sortedGraph(4);
+    sortedGraph.addEdges(std::vector<Edge>{{3, 3}, {0, 2}, {0, 1}, {2, 3}});
+
+    EXPECT_EQ(graph1.getFingerprint(), graph2.getFingerprint());
+    EXPECT_EQ(graph1.getFingerprint(), sortedGraph.getFingerprint());
+    EXPECT_EQ(graph1, graph2);
+
+    graph2.addEdge(1, 0);
+    EXPECT_NE(graph1.getFingerprint(), graph2.getFingerprint());
+    graph2.removeEdge(1, 0);
+    EXPECT_EQ(graph1.getFingerprint(), graph2.getFingerprint());
+    graph2.resize(5);
+    EXPECT_NE(graph1.getFingerprint(), graph2.getFingerprint());
+}
+
+TEST(DirectedGraph, getFingerprint_anyModification_equalToRebuiltGraph) {
+    DirectedGraph graph(6);
+    graph.trackInNeighbours();
+    graph.addEdges(
+        std::vector<Edge>{{0, 1}, {1, 2}, {2, 0}, {4, 5}, {5, 5}, {3, 1}}
+    );
+    graph.addEdge(0, 1, true);
+    graph.addEdge(0, 1, true);
+    EXPECT_EQ(graph.getFingerprint(), getRebuiltGraph(graph).getFingerprint());
+
+    graph.removeDuplicateEdges();
+    EXPECT_EQ(graph.getFingerprint(), getRebuiltGraph(graph).getFingerprint());
+    graph.removeVertexFromEdgeList(1);
+    EXPECT_EQ(graph.getFingerprint(), getRebuiltGraph(graph).getFingerprint());
+    graph.removeVertices({0, 3});
+    EXPECT_EQ(graph.getFingerprint(), getRebuiltGraph(graph).getFingerprint());
+
+    auto permutedGraph = graph.getPermutedGraph({3, 1, 0, 2});
+    EXPECT_EQ(
+        permutedGraph.getFingerprint(),
+        getRebuiltGraph(permutedGraph).getFingerprint()
+    );
+    graph.clearEdges();
+    EXPECT_EQ(graph.getFingerprint(), DirectedGraph(4).getFingerprint());
+}
+
+TEST(LabeledDirectedGraph, getFingerprint_labelChanged_fingerprintChanged) {
+    LabeledDirectedGraph<std::string> graph1(3), graph2(3);
+    graph1.addEdge(0, 1, std::string("a"));
+    graph2.addEdge(0, 1, std::string("b"));
+    EXPECT_NE(graph1.getFingerprint(), graph2.getFingerprint());
+
+    graph2.setEdgeLabel(0, 1, "a");
+    EXPECT_EQ(graph1.getFingerprint(), graph2.getFingerprint());
+    EXPECT_EQ(graph1, graph2);
+}
+
+template <typename Graph>
+static void testParallelEdgesWithDifferentLabels() {
+    Graph graph1(3), graph2(3);
+    graph1.addEdge(0, 1, 0, true);
+    graph1.addEdge(0, 1, 1, true);
+    graph1.addEdge(0, 2, 2, true);
+    graph1.addEdge(0, 1, 1, true);
+    graph2.addEdge(0, 1, 1, true);
+    graph2.addEdge(0, 2, 2, true);
+    graph2.addEdge(0, 1, 1, true);
+    graph2.addEdge(0, 1, 0, true);
+
+    EXPECT_EQ(graph1, graph1);
+    EXPECT_EQ(graph1.getFingerprint(), graph2.getFingerprint());
+    EXPECT_EQ(graph1, graph2);
+    EXPECT_EQ(graph2, graph1);
+
+    Graph graph3(3);
+    graph3.addEdge(0, 1, 0, true);
+    graph3.addEdge(0, 1, 0, true);
+    graph3.addEdge(0, 2, 2, true);
+    graph3.addEdge(0, 1, 1, true);
+    EXPECT_NE(graph1, graph3);
+    EXPECT_NE(graph3, graph1);
+}
+
+TEST(
+    LabeledDirectedGraph,
+    equalityOperator_parallelEdgesWithDifferentLabels_independentOfOrder
+) {
+    testParallelEdgesWithDifferentLabels<LabeledDirectedGraph<int>>();
+    testParallelEdgesWithDifferentLabels<
+        LabeledDirectedGraph<int, SortedStorage<>>>();
+}
+
+TEST(UndirectedWeightedGraph, getFingerprint_weightsChanged_matchesOtherGraph) {
+    UndirectedWeightedGraph graph1(3), graph2(3);
+    graph1.addEdge(0, 1, 2);
+    graph1.addEdge(2, 2, 1.5);
+    graph2.addEdge(2, 2, 1.5);
+    graph2.addEdge(1, 0, 3);
+    EXPECT_NE(graph1.getFingerprint(), graph2.getFingerprint());
+
+    graph2.setEdgeWeight(0, 1, 2);
+    EXPECT_EQ(graph1.getFingerprint(), graph2.getFingerprint());
+    graph2.removeEdge(2, 2);
+    graph2.addEdge(2, 2, 1.5);
+    EXPECT_EQ(graph1.getFingerprint(), graph2.getFingerprint());
+}
+
+TEST(DirectedMultigraph, getFingerprint_multiplicitiesChanged_matchesOther) {
+    DirectedMultigraph graph1(3), graph2(3);
+    graph1.addMultiedge(0, 1, 3);
+    graph1.addMultiedge(1, 2, 1);
+
+    graph2.addMultiedge(1, 2, 2);
+    graph2.addMultiedge(0, 1, 1);
+    graph2.addMultiedge(0, 1, 2, true);
+    graph2.mergeDuplicateEdges();
+    graph2.removeMultiedge(1, 2, 1);
+    EXPECT_EQ(graph1.getFingerprint(), graph2.getFingerprint());
+
+    graph2.setEdgeMultiplicity(0, 1, 4);
+    EXPECT_NE(graph1.getFingerprint(), graph2.getFingerprint());
+    graph2.removeEdge(0, 1);
+    EXPECT_EQ(graph1.getFingerprint(), graph2.getFingerprint());
+}
+
+TEST(UndirectedGraph, getFingerprint_concurrentInsertion_equalToRebuiltGraph) {
+    UndirectedGraph graph(4);
+    {
+        ConcurrentEdgeInserter<UndirectedGraph> inserter(graph);
+        inserter.addEdge(0, 1);
+        inserter.addEdge(2, 2);
+        inserter.addEdge(3, 1);
+    }
+    EXPECT_EQ(graph.getFingerprint(), getRebuiltGraph(graph).getFingerprint());
+}
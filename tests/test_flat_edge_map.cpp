@@ -0,0 +1,133 @@
+#include "BaseGraph/boost_hash.hpp"
+#include "BaseGraph/flat_edge_map.hpp"
+#include "BaseGraph/types.h"
+
+#include "gtest/gtest.h"
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+using namespace BaseGraph;
+
+TEST(FlatEdgeMap, insert_newEdges_edgesFound) {
+    FlatEdgeMap<std::string> map;
+    EXPECT_TRUE(map.insert({0, 1}, "a").second);
+    EXPECT_TRUE(map.insert({1, 0}, "b").second);
+
+    ASSERT_NE(map.find({0, 1}), nullptr);
+    EXPECT_EQ(*map.find({0, 1}), "a");
+    EXPECT_EQ(*map.find({1, 0}), "b");
+    EXPECT_EQ(map.find({1, 1}), nullptr);
+    EXPECT_EQ(map.size(), 2);
+}
+
+TEST(FlatEdgeMap, insert_existentEdge_valueUnchanged) {
+    FlatEdgeMap<int> map;
+    map.insert({2, 3}, 1);
+    auto inserted = map.insert({2, 3}, 2);
+
+    EXPECT_FALSE(inserted.second);
+    EXPECT_EQ(*inserted.first, 1);
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST(FlatEdgeMap, insert_reservedEdge_throwInvalidArgument) {
+    FlatEdgeMap<int> map;
+    VertexIndex reserved = std::numeric_limits<VertexIndex>::max();
+    EXPECT_THROW(map.insert({reserved, 0}), std::invalid_argument);
+}
+
+TEST(FlatEdgeMap, accessOperator_inexistentEdge_defaultValueInserted) {
+    FlatEdgeMap<int> map;
+    map[{0, 4}] += 3;
+    map[{0, 4}] += 2;
+
+    EXPECT_EQ(*map.find({0, 4}), 5);
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST(FlatEdgeMap, reserve_anySize_capacityIsPowerOfTwoAndLargeEnough) {
+    FlatEdgeMap<int> map(100);
+
+    EXPECT_GE(map.capacity() * 3, 100 * 4);
+    EXPECT_EQ(map.capacity() & (map.capacity() - 1), 0);
+}
+
+TEST(FlatEdgeMap, erase_existentEdge_otherEdgesStillFound) {
+    FlatEdgeSet set;
+    for (VertexIndex i = 0; i < 50; ++i)
+        set.insert({i, i + 1});
+
+    EXPECT_TRUE(set.erase({10, 11}));
+    EXPECT_FALSE(set.erase({10, 11}));
+    EXPECT_FALSE(set.contains({10, 11}));
+    for (VertexIndex i = 0; i < 50; ++i)
+        EXPECT_EQ(set.contains({i, i + 1}), i != 10);
+    EXPECT_EQ(set.size(), 49);
+}
+
+TEST(FlatEdgeMap, randomOperations_sameContentAsStdMap) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<VertexIndex> vertex(0, 30);
+    FlatEdgeMap<int> map;
+    std::map<Edge, int> expected;
+
+    for (int k = 0; k < 5000; ++k) {
+        Edge edge = {vertex(generator), vertex(generator)};
+        if (k % 3 == 0) {
+            EXPECT_EQ(map.erase(edge), expected.erase(edge) == 1);
+        } else {
+            map.insert(edge, k);
+            expected.insert({edge, k});
+        }
+    }
+
+    EXPECT_EQ(map.size(), expected.size());
+    for (const auto &element : expected) {
+        ASSERT_NE(map.find(element.first), nullptr);
+        EXPECT_EQ(*map.find(element.first), element.second);
+    }
+    size_t visited = 0;
+    map.forEach([&](const Edge &edge, int value) {
+        EXPECT_EQ(expected.at(edge), value);
+        ++visited;
+    });
+    EXPECT_EQ(visited, expected.size());
+}
+
+TEST(FlatEdgeMap, clear_anyMap_emptyAndReusable) {
+    FlatEdgeSet set;
+    set.insert({0, 1});
+    set.clear();
+
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains({0, 1}));
+    set.insert({0, 1});
+    EXPECT_TRUE(set.contains({0, 1}));
+}
+
+TEST(FlatEdgeMap, insert_largestVertexIndices_edgesFound) {
+    const VertexIndex largest = std::numeric_limits<VertexIndex>::max() - 1;
+    FlatEdgeMap<int> map;
+    map.insert({largest, 0}, 1);
+    map.insert({0, largest}, 2);
+    map.insert({largest, largest}, 3);
+
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(*map.find({largest, 0}), 1);
+    EXPECT_EQ(*map.find({0, largest}), 2);
+    EXPECT_EQ(*map.find({largest, largest}), 3);
+    EXPECT_FALSE(map.contains({largest - 1, largest}));
+}
+
+TEST(hashEdge, reversedEdges_differentHashes) {
+    hashEdge hash;
+    EXPECT_NE(hash({0, 1}), hash({1, 0}));
+    EXPECT_NE(hash({2, 3}), hash({3, 2}));
+
+    std::unordered_map<Edge, int, hashEdge> map = {{{0, 1}, 1}, {{1, 0}, 2}};
+    EXPECT_EQ(map.at({1, 0}), 2);
+}
@@ -0,0 +1,165 @@
+#include "BaseGraph/algorithms/paths.hpp"
+#include "BaseGraph/algorithms/topology.hpp"
+#include "BaseGraph/compressed_directed_graph.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/graph_views.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "fixtures.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> Neighbours;
+
+template <typename T>
+static Neighbours toSortedVector(const T &range) {
+    Neighbours neighbours(range.begin(), range.end());
+    std::sort(neighbours.begin(), neighbours.end());
+    return neighbours;
+}
+
+static DirectedGraph getDirectedGraph() {
+    DirectedGraph graph(6);
+    graph.trackInNeighbours();
+    graph.addEdges(std::vector<Edge>{
+        {0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 3}, {4, 3}, {4, 5}, {5, 4}
+    });
+    return graph;
+}
+
+TEST(ReversedGraphView, getOutNeighbours_anyVertex_inNeighboursOfGraph) {
+    DirectedGraph graph = getDirectedGraph();
+    auto view = getReversedView(graph);
+
+    EXPECT_EQ(view.getSize(), 6);
+    EXPECT_EQ(view.getEdgeNumber(), 8);
+    EXPECT_EQ(toVector(view.getOutNeighbours(3)), Neighbours({2, 3, 4}));
+    EXPECT_EQ(toVector(view.getInNeighbours(2)), Neighbours({0, 3}));
+    EXPECT_EQ(view.getOutDegree(3), 3);
+    EXPECT_EQ(view.getInDegree(4), 2);
+    EXPECT_TRUE(view.hasEdge(1, 0));
+    EXPECT_FALSE(view.hasEdge(0, 1));
+}
+
+TEST(ReversedGraphView, findVertexPredecessors_sameAsReversedGraph) {
+    DirectedGraph graph = getDirectedGraph();
+
+    for (VertexIndex source : {0, 3, 5})
+        EXPECT_EQ(
+            algorithms::findVertexPredecessors(getReversedView(graph), source),
+            algorithms::findVertexPredecessors(
+                graph.getReversedGraph(), source
+            )
+        );
+    EXPECT_EQ(
+        algorithms::findAllGeodesics(getReversedView(graph), 3, 1),
+        algorithms::findAllGeodesics(graph.getReversedGraph(), 3, 1)
+    );
+}
+
+TEST(ReversedGraphView, inNeighboursNotTracked_throwLogicError) {
+    DirectedGraph graph(2);
+    graph.addEdge(0, 1);
+
+    EXPECT_THROW(getReversedView(graph).getOutNeighbours(1), std::logic_error);
+}
+
+TEST(SymmetrizedGraphView, getNeighbours_anyVertex_outThenInNeighbours) {
+    DirectedGraph graph = getDirectedGraph();
+    auto view = getSymmetrizedView(graph);
+
+    EXPECT_EQ(toVector(view.getNeighbours(2)), Neighbours({0, 3, 1}));
+    EXPECT_EQ(toVector(view.getNeighbours(3)), Neighbours({3, 2, 4}));
+    EXPECT_EQ(toVector(view.getNeighbours(4)), Neighbours({3, 5, 5}));
+    EXPECT_EQ(view.getDegree(3), 3);
+    EXPECT_TRUE(view.hasEdge(1, 0));
+    EXPECT_FALSE(view.hasEdge(0, 3));
+}
+
+TEST(SymmetrizedGraphView, findVertexPredecessors_sameAsUndirectedGraph) {
+    DirectedGraph graph = getDirectedGraph();
+    UndirectedGraph undirectedGraph(graph.getSize());
+    for (auto edge : graph.edges())
+        undirectedGraph.addEdge(edge.first, edge.second);
+
+    for (VertexIndex source : {0, 3, 5})
+        EXPECT_EQ(
+            algorithms::findVertexPredecessors(
+                getSymmetrizedView(graph), source
+            ).first,
+            algorithms::findVertexPredecessors(undirectedGraph, source).first
+        );
+}
+
+TEST(InducedSubgraphView, getOutNeighbours_removedVertices_skipped) {
+    DirectedGraph graph = getDirectedGraph();
+    auto view = getInducedSubgraphView(graph, {0, 2, 3, 4});
+
+    EXPECT_TRUE(view.hasVertex(0));
+    EXPECT_FALSE(view.hasVertex(1));
+    EXPECT_EQ(toVector(view.getOutNeighbours(0)), Neighbours());
+    EXPECT_EQ(toVector(view.getOutNeighbours(1)), Neighbours());
+    EXPECT_EQ(toVector(view.getOutNeighbours(2)), Neighbours({0, 3}));
+    EXPECT_EQ(toVector(view.getOutNeighbours(4)), Neighbours({3}));
+    EXPECT_EQ(toVector(view.getInNeighbours(3)), Neighbours({2, 3, 4}));
+    EXPECT_EQ(view.getOutDegree(2), 2);
+    EXPECT_FALSE(view.hasEdge(0, 1));
+    EXPECT_TRUE(view.hasEdge(2, 0));
+
+    EXPECT_THROW(getInducedSubgraphView(graph, {0, 6}), std::out_of_range);
+    EXPECT_THROW(
+        InducedSubgraphView<DirectedGraph>(graph, std::vector<bool>(2)),
+        std::invalid_argument
+    );
+}
+
+TEST(InducedSubgraphView, anyGraph_sameAsSubgraph) {
+    UndirectedGraph graph(5);
+    graph.addEdges(std::vector<Edge>{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}});
+    auto view = getInducedSubgraphView(graph, {0, 2, 3, 4});
+    auto subgraph = algorithms::getSubgraph(graph, {0, 2, 3, 4});
+
+    for (VertexIndex i : graph)
+        EXPECT_EQ(
+            toSortedVector(view.getNeighbours(i)),
+            toSortedVector(subgraph.getNeighbours(i))
+        );
+    EXPECT_EQ(
+        algorithms::findVertexPredecessors(view, 2).first,
+        algorithms::findVertexPredecessors(subgraph, 2).first
+    );
+
+    DirectedGraph directedGraph = getDirectedGraph();
+    auto compressedGraph = compress(directedGraph);
+    EXPECT_EQ(
+        toVector(getInducedSubgraphView(compressedGraph, {0, 2, 3})
+                     .getOutNeighbours(2)),
+        Neighbours({0, 3})
+    );
+}
+
+TEST(GraphViews, nestedViews_composedWithoutCopy) {
+    DirectedWeightedGraph graph(4);
+    graph.trackInNeighbours();
+    graph.addEdge(0, 1, 1.5);
+    graph.addEdge(1, 2, 2);
+    graph.addEdge(3, 2, 1);
+
+    InducedSubgraphView<DirectedWeightedGraph> subgraph(
+        graph, std::vector<bool>{false, true, true, true}
+    );
+    auto view = getReversedView(subgraph);
+
+    EXPECT_EQ(toVector(view.getOutNeighbours(2)), Neighbours({1, 3}));
+    EXPECT_EQ(toVector(view.getOutNeighbours(1)), Neighbours());
+    EXPECT_EQ(algorithms::findGeodesics(view, 2, 1), algorithms::Path({2, 1}));
+    EXPECT_EQ(
+        toVector(getSymmetrizedView(subgraph).getNeighbours(2)),
+        Neighbours({1, 3})
+    );
+}
@@ -0,0 +1,165 @@
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> VectorSuccessors;
+
+TEST(InNeighbours, getInNeighbours_notTracked_throwLogicError) {
+    DirectedGraph graph(3);
+    graph.addEdge(0, 1);
+
+    EXPECT_FALSE(graph.isTrackingInNeighbours());
+    EXPECT_THROW(graph.getInNeighbours(1), std::logic_error);
+}
+
+TEST(InNeighbours, trackInNeighbours_existingEdges_inNeighboursBuilt) {
+    DirectedGraph graph(4);
+    graph.addEdge(2, 1);
+    graph.addEdge(0, 1);
+    graph.addEdge(1, 1);
+    graph.addEdge(3, 0);
+
+    graph.trackInNeighbours();
+
+    EXPECT_EQ(graph.getInNeighbours(0), Successors({3}));
+    EXPECT_EQ(graph.getInNeighbours(1), Successors({0, 1, 2}));
+    EXPECT_EQ(graph.getInNeighbours(3), Successors({}));
+}
+
+TEST(InNeighbours, addEdge_tracked_inNeighboursUpdated) {
+    DirectedGraph graph(3);
+    graph.trackInNeighbours();
+    graph.addEdge(2, 0);
+    graph.addEdge(1, 0);
+    graph.addEdge(1, 0);
+    graph.addEdge(0, 0, true);
+
+    EXPECT_EQ(graph.getInNeighbours(0), Successors({2, 1, 0}));
+    EXPECT_EQ(graph.getInDegree(0), 3);
+    EXPECT_EQ(graph.getInDegrees(), std::vector<size_t>({3, 0, 0}));
+}
+
+TEST(InNeighbours, removeEdge_duplicateEdges_allInNeighboursRemoved) {
+    DirectedGraph graph(3);
+    graph.trackInNeighbours();
+    graph.addEdge(1, 0);
+    graph.addEdge(2, 0);
+    graph.addEdge(1, 0, true);
+
+    graph.removeEdge(1, 0);
+
+    EXPECT_EQ(graph.getInNeighbours(0), Successors({2}));
+    EXPECT_EQ(graph.getInDegree(0), 1);
+}
+
+TEST(InNeighbours, removeVertexFromEdgeList_tracked_edgesOfVertexRemoved) {
+    DirectedGraph graph(4);
+    graph.trackInNeighbours();
+    graph.addEdge(0, 1);
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 1);
+    graph.addEdge(1, 1);
+    graph.addEdge(3, 1);
+    graph.addEdge(3, 2);
+
+    graph.removeVertexFromEdgeList(1);
+
+    EXPECT_EQ(graph.getEdgeNumber(), 1);
+    EXPECT_EQ(graph.getOutNeighbours(0), Successors({}));
+    EXPECT_EQ(graph.getOutNeighbours(3), Successors({2}));
+    EXPECT_EQ(graph.getInNeighbours(1), Successors({}));
+    EXPECT_EQ(graph.getInNeighbours(2), Successors({3}));
+}
+
+TEST(InNeighbours, removeDuplicateEdges_tracked_oneInNeighbourKept) {
+    DirectedGraph graph(3);
+    graph.trackInNeighbours();
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 2, true);
+    graph.addEdge(1, 2);
+
+    graph.removeDuplicateEdges();
+
+    EXPECT_EQ(graph.getInNeighbours(2), Successors({0, 1}));
+}
+
+TEST(InNeighbours, resizeAndClearEdges_tracked_inNeighboursFollowGraph) {
+    DirectedGraph graph(2);
+    graph.trackInNeighbours();
+    graph.addEdge(0, 1);
+    graph.resize(3);
+    graph.addEdge(1, 2);
+
+    EXPECT_EQ(graph.getInNeighbours(2), Successors({1}));
+
+    graph.clearEdges();
+    EXPECT_EQ(graph.getInNeighbours(1), Successors({}));
+    EXPECT_EQ(graph.getInNeighbours(2), Successors({}));
+}
+
+TEST(InNeighbours, trackInNeighbours_false_inNeighboursReleased) {
+    DirectedGraph graph(2);
+    graph.trackInNeighbours();
+    graph.addEdge(0, 1);
+
+    graph.trackInNeighbours(false);
+
+    EXPECT_FALSE(graph.isTrackingInNeighbours());
+    EXPECT_THROW(graph.getInNeighbours(1), std::logic_error);
+    EXPECT_EQ(graph.getInDegree(1), 1);
+}
+
+TEST(InNeighbours, sortedStorage_addAndRemoveEdges_inNeighboursSorted) {
+    LabeledDirectedGraph<NoLabel, SortedStorage<>> graph(4);
+    graph.addEdge(3, 0);
+    graph.addEdge(1, 0);
+    graph.trackInNeighbours();
+    graph.addEdge(2, 0);
+    graph.addEdge(0, 0);
+
+    EXPECT_EQ(graph.getInNeighbours(0), VectorSuccessors({0, 1, 2, 3}));
+
+    graph.removeEdge(1, 0);
+    EXPECT_EQ(graph.getInNeighbours(0), VectorSuccessors({0, 2, 3}));
+}
+
+TEST(InNeighbours, weightedGraph_removeVertexFromEdgeList_totalWeightUpdated) {
+    DirectedWeightedGraph graph(3);
+    graph.trackInNeighbours();
+    graph.addEdge(0, 1, 1.5);
+    graph.addEdge(2, 1, 2);
+    graph.addEdge(1, 2, 4);
+    graph.addEdge(2, 0, 8);
+
+    graph.removeVertexFromEdgeList(1);
+
+    EXPECT_EQ(graph.getTotalWeight(), 8);
+    EXPECT_EQ(graph.getEdgeNumber(), 1);
+    EXPECT_EQ(graph.getInNeighbours(0), Successors({2}));
+    EXPECT_EQ(graph.getInNeighbours(2), Successors({}));
+}
+
+TEST(InNeighbours, multigraph_getInDegree_multiplicitiesCounted) {
+    DirectedMultigraph graph(3);
+    graph.trackInNeighbours();
+    graph.addMultiedge(0, 2, 3);
+    graph.addMultiedge(1, 2, 2);
+    graph.addEdge(2, 2);
+
+    EXPECT_EQ(graph.getInNeighbours(2), Successors({0, 1, 2}));
+    EXPECT_EQ(graph.getInDegree(2), 6);
+
+    graph.removeMultiedge(0, 2, 3);
+    EXPECT_EQ(graph.getInNeighbours(2), Successors({1, 2}));
+    EXPECT_EQ(graph.getInDegree(2), 3);
+
+    graph.removeVertexFromEdgeList(1);
+    EXPECT_EQ(graph.getTotalEdgeNumber(), 1);
+    EXPECT_EQ(graph.getInNeighbours(2), Successors({2}));
+}
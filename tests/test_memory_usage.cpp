@@ -0,0 +1,104 @@
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_multigraph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef LabeledDirectedGraph<NoLabel, VectorStorage> VectorDirectedGraph;
+
+TEST(MemoryUsage, getMemoryUsage_unlabeledGraph_noLabelMemory) {
+    DirectedGraph graph(3);
+    graph.addEdge(0, 1);
+
+    MemoryUsage usage = graph.getMemoryUsage();
+    EXPECT_GT(usage.adjacency, 0);
+    EXPECT_EQ(usage.labels, 0);
+    EXPECT_GE(usage.bookkeeping, sizeof(DirectedGraph));
+    EXPECT_EQ(
+        usage.total(), usage.adjacency + usage.labels + usage.bookkeeping
+    );
+}
+
+TEST(MemoryUsage, getMemoryUsage_moreEdges_adjacencyGrows) {
+    DirectedGraph graph(3);
+    size_t emptyAdjacency = graph.getMemoryUsage().adjacency;
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2);
+
+    EXPECT_EQ(
+        graph.getMemoryUsage().adjacency - emptyAdjacency,
+        2 * (sizeof(VertexIndex) + 2 * sizeof(void *))
+    );
+}
+
+TEST(MemoryUsage, getMemoryUsage_weightedGraph_labelsCounted) {
+    BasicDirectedWeightedGraph<VectorStorage> graph(2);
+    graph.reserve(2, 8);
+    graph.addEdge(0, 1, 1.5);
+
+    EXPECT_GE(
+        graph.getMemoryUsage().labels, 2 * sizeof(std::vector<EdgeWeight>) +
+                                           8 * sizeof(EdgeWeight)
+    );
+}
+
+TEST(MemoryUsage, reserve_vectorStorage_capacitySpreadOverVertices) {
+    VectorDirectedGraph graph(4);
+    graph.reserve(10, 8);
+
+    EXPECT_EQ(graph.getSize(), 4);
+    EXPECT_GE(graph.getMemoryUsage().adjacency, 8 * sizeof(VertexIndex));
+    EXPECT_GE(graph.getOutNeighbours(3).capacity(), 2);
+}
+
+TEST(MemoryUsage, shrinkToFit_reservedGraph_memoryReleased) {
+    VectorDirectedGraph graph(4);
+    graph.reserve(100, 400);
+    graph.addEdge(0, 1);
+    size_t reservedMemory = graph.getMemoryUsage().total();
+
+    graph.shrinkToFit();
+
+    EXPECT_LT(graph.getMemoryUsage().total(), reservedMemory);
+    EXPECT_EQ(graph.getOutNeighbours(0).capacity(), 1);
+    EXPECT_TRUE(graph.hasEdge(0, 1));
+}
+
+TEST(MemoryUsage, undirectedGraph_reserve_bothEndpointsReserved) {
+    LabeledUndirectedGraph<NoLabel, VectorStorage> graph(2);
+    graph.reserve(2, 3);
+
+    EXPECT_GE(graph.getOutNeighbours(0).capacity(), 3);
+    EXPECT_GE(graph.getOutNeighbours(1).capacity(), 3);
+}
+
+TEST(MemoryUsage, multigraphs_getMemoryUsage_degreeCountersInBookkeeping) {
+    DirectedMultigraph directed(10);
+    EXPECT_GE(
+        directed.getMemoryUsage().bookkeeping,
+        sizeof(DirectedMultigraph) + 20 * sizeof(size_t)
+    );
+
+    UndirectedMultigraph undirected(10);
+    undirected.shrinkToFit();
+    EXPECT_GE(
+        undirected.getMemoryUsage().bookkeeping,
+        sizeof(UndirectedMultigraph) + 20 * sizeof(size_t)
+    );
+}
+
+TEST(MemoryUsage, trackedInNeighbours_getMemoryUsage_adjacencyIncludesIndex) {
+    DirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    size_t untrackedAdjacency = graph.getMemoryUsage().adjacency;
+
+    graph.trackInNeighbours();
+
+    EXPECT_GT(graph.getMemoryUsage().adjacency, untrackedAdjacency);
+}
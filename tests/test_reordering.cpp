@@ -0,0 +1,275 @@
+#include "BaseGraph/algorithms/reordering.hpp"
+#include "BaseGraph/compact_directed_graph.hpp"
+#include "BaseGraph/compact_undirected_graph.hpp"
+#include "BaseGraph/compressed_undirected_graph.hpp"
+#include "BaseGraph/dense_undirected_graph.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_multigraph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> Indices;
+
+static bool isPermutation(const Indices &newIndices, size_t size) {
+    Indices sortedIndices(newIndices);
+    std::sort(sortedIndices.begin(), sortedIndices.end());
+    for (VertexIndex i = 0; i < sortedIndices.size(); ++i)
+        if (sortedIndices[i] != i)
+            return false;
+    return sortedIndices.size() == size;
+}
+
+static std::vector<Edge> permuteEdges(
+    const std::vector<Edge> &edges, const Indices &newIndices, bool undirected
+) {
+    std::vector<Edge> permutedEdges;
+    for (auto edge : edges) {
+        Edge permutedEdge = {newIndices[edge.first], newIndices[edge.second]};
+        if (undirected && permutedEdge.first > permutedEdge.second)
+            std::swap(permutedEdge.first, permutedEdge.second);
+        permutedEdges.push_back(permutedEdge);
+    }
+    std::sort(permutedEdges.begin(), permutedEdges.end());
+    return permutedEdges;
+}
+
+template <typename Graph>
+static std::vector<Edge> getSortedEdges(const Graph &graph) {
+    std::vector<Edge> edges;
+    for (auto edge : graph.edges())
+        edges.push_back(edge);
+    std::sort(edges.begin(), edges.end());
+    return edges;
+}
+
+template <typename Graph>
+static std::vector<Edge> getSortedUndirectedEdges(const Graph &graph) {
+    std::vector<Edge> edges;
+    for (auto edge : graph.edges())
+        edges.push_back(
+            {std::min(edge.first, edge.second),
+             std::max(edge.first, edge.second)}
+        );
+    std::sort(edges.begin(), edges.end());
+    return edges;
+}
+
+// Path 0-1-2-3-4 with the indices shuffled, and an isolated vertex 5.
+static UndirectedGraph getShuffledPath() {
+    UndirectedGraph graph(6);
+    graph.addEdges(std::vector<Edge>{{3, 0}, {0, 4}, {4, 1}, {1, 2}});
+    return graph;
+}
+
+static const Indices newIndices = {3, 0, 5, 1, 4, 2};
+
+TEST(Reordering, anyOrdering_validPermutation) {
+    DirectedGraph graph(7);
+    graph.addEdges(std::vector<Edge>{
+        {0, 1}, {0, 2}, {0, 3}, {3, 1}, {4, 5}, {5, 4}, {5, 5}, {2, 6}, {6, 0}
+    });
+
+    EXPECT_TRUE(isPermutation(algorithms::getDegreeOrdering(graph), 7));
+    EXPECT_TRUE(
+        isPermutation(algorithms::getBreadthFirstOrdering(graph, 4), 7)
+    );
+    EXPECT_TRUE(
+        isPermutation(algorithms::getReverseCuthillMcKeeOrdering(graph), 7)
+    );
+    for (size_t windowSize : {1, 3, 10})
+        EXPECT_TRUE(isPermutation(
+            algorithms::getGorderOrdering(graph, windowSize), 7
+        ));
+    EXPECT_TRUE(algorithms::getGorderOrdering(DirectedGraph(0)).empty());
+}
+
+TEST(Reordering, getDegreeOrdering_anyGraph_stableOrderByDegree) {
+    UndirectedGraph graph(5);
+    graph.addEdges(std::vector<Edge>{{0, 1}, {1, 2}, {1, 3}, {3, 2}});
+
+    EXPECT_EQ(algorithms::getDegreeOrdering(graph), Indices({3, 0, 1, 2, 4}));
+    EXPECT_EQ(
+        algorithms::getDegreeOrdering(graph, false), Indices({1, 4, 2, 3, 0})
+    );
+}
+
+TEST(Reordering, getBreadthFirstOrdering_path_indicesFollowPath) {
+    UndirectedGraph graph = getShuffledPath();
+
+    EXPECT_EQ(
+        algorithms::getBreadthFirstOrdering(graph, 3),
+        Indices({1, 3, 4, 0, 2, 5})
+    );
+}
+
+TEST(Reordering, getReverseCuthillMcKeeOrdering_path_bandwidthOfOne) {
+    UndirectedGraph graph = getShuffledPath();
+    auto newIndices = algorithms::getReverseCuthillMcKeeOrdering(graph);
+    UndirectedGraph permutedGraph = graph.getPermutedGraph(newIndices);
+
+    EXPECT_EQ(newIndices[5], 5);
+    for (auto edge : permutedGraph.edges())
+        EXPECT_EQ(std::max(edge.first, edge.second) -
+                      std::min(edge.first, edge.second),
+                  1);
+}
+
+TEST(Reordering, getGorderOrdering_twoCliques_cliquesContiguous) {
+    UndirectedGraph graph(8);
+    for (VertexIndex i : {0, 2, 4, 6})
+        for (VertexIndex j : {0, 2, 4, 6})
+            if (i < j) {
+                graph.addEdge(i, j);
+                graph.addEdge(i + 1, j + 1);
+            }
+    graph.addEdge(0, 1);
+    auto newIndices = algorithms::getGorderOrdering(graph, 3);
+
+    Indices evenVertices;
+    for (VertexIndex i : {0, 2, 4, 6})
+        evenVertices.push_back(newIndices[i]);
+    std::sort(evenVertices.begin(), evenVertices.end());
+    EXPECT_EQ(evenVertices.back() - evenVertices.front(), 3);
+}
+
+TEST(DirectedGraph, getPermutedGraph_anyGraph_edgesAndLabelsPermuted) {
+    LabeledDirectedGraph<std::string> graph(6);
+    graph.trackInNeighbours();
+    graph.addEdge(0, 1, std::string("a"));
+    graph.addEdge(2, 2, std::string("b"));
+    graph.addEdge(5, 0, std::string("c"));
+    graph.addEdge(0, 3, std::string("d"));
+
+    auto permutedGraph = graph.getPermutedGraph(newIndices);
+    EXPECT_EQ(permutedGraph.getEdgeNumber(), 4);
+    EXPECT_EQ(
+        permutedGraph.getOutNeighbours(3), std::list<VertexIndex>({0, 1})
+    );
+    EXPECT_EQ(permutedGraph.getEdgeLabel(3, 1), "d");
+    EXPECT_EQ(permutedGraph.getEdgeLabel(5, 5), "b");
+    EXPECT_EQ(permutedGraph.getEdgeLabel(2, 3), "c");
+    EXPECT_EQ(
+        permutedGraph.getInNeighbours(3), std::list<VertexIndex>({2})
+    );
+    EXPECT_EQ(
+        getSortedEdges(permutedGraph),
+        permuteEdges(getSortedEdges(graph), newIndices, false)
+    );
+}
+
+TEST(DirectedGraph, getPermutedGraph_sortedStorage_neighboursSorted) {
+    LabeledDirectedGraph<NoLabel, SortedStorage<>> graph(6);
+    graph.addEdges(std::vector<Edge>{{0, 1}, {0, 3}, {0, 5}, {4, 2}});
+
+    auto permutedGraph = graph.getPermutedGraph(newIndices);
+    auto neighbours = permutedGraph.getOutNeighbours(3);
+    EXPECT_EQ(
+        Indices(neighbours.begin(), neighbours.end()), Indices({0, 1, 2})
+    );
+    EXPECT_EQ(
+        getSortedEdges(permutedGraph),
+        permuteEdges(getSortedEdges(graph), newIndices, false)
+    );
+}
+
+TEST(DirectedGraph, getPermutedGraph_invalidPermutation_throwInvalidArgument) {
+    DirectedGraph graph(3);
+
+    EXPECT_THROW(graph.getPermutedGraph({0, 1}), std::invalid_argument);
+    EXPECT_THROW(graph.getPermutedGraph({0, 1, 3}), std::invalid_argument);
+    EXPECT_THROW(graph.getPermutedGraph({0, 1, 1}), std::invalid_argument);
+    EXPECT_THROW(
+        CompactDirectedGraph(graph).getPermutedGraph({2, 2, 0}),
+        std::invalid_argument
+    );
+}
+
+TEST(UndirectedGraph, getPermutedGraph_anyGraph_edgesPermuted) {
+    UndirectedGraph graph = getShuffledPath();
+    graph.addEdge(2, 2);
+
+    auto permutedGraph = graph.getPermutedGraph(newIndices);
+    EXPECT_EQ(permutedGraph.getEdgeNumber(), 5);
+    EXPECT_EQ(permutedGraph.getDegree(5), 3);
+    EXPECT_EQ(
+        getSortedUndirectedEdges(permutedGraph),
+        permuteEdges(getSortedUndirectedEdges(graph), newIndices, true)
+    );
+}
+
+TEST(WeightedGraphs, getPermutedGraph_anyGraph_weightsPermuted) {
+    DirectedWeightedGraph directedGraph(6);
+    directedGraph.addEdge(0, 1, 1.5);
+    directedGraph.addEdge(4, 4, -2);
+    auto permutedDirectedGraph = directedGraph.getPermutedGraph(newIndices);
+    EXPECT_EQ(permutedDirectedGraph.getEdgeWeight(3, 0), 1.5);
+    EXPECT_EQ(permutedDirectedGraph.getEdgeWeight(4, 4), -2);
+    EXPECT_EQ(permutedDirectedGraph.getTotalWeight(), -0.5);
+
+    UndirectedWeightedGraph undirectedGraph(6);
+    undirectedGraph.addEdge(2, 5, 3);
+    auto permutedUndirectedGraph = undirectedGraph.getPermutedGraph(newIndices);
+    EXPECT_EQ(permutedUndirectedGraph.getEdgeWeight(2, 5), 3);
+    EXPECT_EQ(permutedUndirectedGraph.getTotalWeight(), 3);
+    EXPECT_EQ(permutedUndirectedGraph.getEdgeNumber(), 1);
+}
+
+TEST(Multigraphs, getPermutedGraph_anyGraph_multiplicitiesPermuted) {
+    DirectedMultigraph directedGraph(6);
+    directedGraph.addMultiedge(0, 1, 3);
+    directedGraph.addMultiedge(2, 0, 2);
+    auto permutedDirectedGraph = directedGraph.getPermutedGraph(newIndices);
+    EXPECT_EQ(permutedDirectedGraph.getEdgeMultiplicity(3, 0), 3);
+    EXPECT_EQ(permutedDirectedGraph.getEdgeMultiplicity(5, 3), 2);
+    EXPECT_EQ(permutedDirectedGraph.getOutDegree(3), 3);
+    EXPECT_EQ(permutedDirectedGraph.getInDegree(3), 2);
+    EXPECT_EQ(permutedDirectedGraph.getTotalEdgeNumber(), 5);
+
+    UndirectedMultigraph undirectedGraph(6);
+    undirectedGraph.addMultiedge(0, 1, 3);
+    undirectedGraph.addMultiedge(2, 2, 2);
+    auto permutedUndirectedGraph = undirectedGraph.getPermutedGraph(newIndices);
+    EXPECT_EQ(permutedUndirectedGraph.getEdgeMultiplicity(0, 3), 3);
+    EXPECT_EQ(permutedUndirectedGraph.getDegree(5), 4);
+    EXPECT_EQ(permutedUndirectedGraph.getDegree(3), 3);
+    EXPECT_EQ(permutedUndirectedGraph.getTotalEdgeNumber(), 5);
+}
+
+TEST(ReadOnlyGraphs, getPermutedGraph_anyGraph_edgesPermuted) {
+    UndirectedGraph graph = getShuffledPath();
+    graph.addEdge(2, 2);
+    auto expectedEdges =
+        permuteEdges(getSortedUndirectedEdges(graph), newIndices, true);
+
+    auto compactGraph = CompactUndirectedGraph(graph).getPermutedGraph(
+        newIndices
+    );
+    EXPECT_EQ(compactGraph.getEdgeNumber(), 5);
+    EXPECT_EQ(getSortedUndirectedEdges(compactGraph), expectedEdges);
+
+    auto compressedGraph = compress(graph).getPermutedGraph(newIndices);
+    EXPECT_EQ(compressedGraph.getEdgeNumber(), 5);
+    EXPECT_EQ(getSortedUndirectedEdges(compressedGraph), expectedEdges);
+
+    DenseUndirectedGraph denseGraph(6);
+    for (auto edge : graph.edges())
+        denseGraph.addEdge(edge.first, edge.second);
+    auto permutedDenseGraph = denseGraph.getPermutedGraph(newIndices);
+    EXPECT_EQ(permutedDenseGraph.getEdgeNumber(), 5);
+    EXPECT_EQ(getSortedUndirectedEdges(permutedDenseGraph), expectedEdges);
+
+    auto reorderedGraph = CompactUndirectedGraph(graph).getPermutedGraph(
+        algorithms::getReverseCuthillMcKeeOrdering(graph)
+    );
+    EXPECT_EQ(reorderedGraph.getEdgeNumber(), 5);
+}
@@ -0,0 +1,141 @@
+#include "BaseGraph/algorithms/paths.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/small_vector.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef SmallVector<int, 2> IntSmallVector;
+typedef SmallVector<std::string, 1> StringSmallVector;
+typedef SmallVector<VertexIndex, 4> SmallSuccessors;
+typedef LabeledDirectedGraph<NoLabel, SmallVectorStorage<4>>
+    SmallDirectedGraph;
+
+TEST(SmallVector, pushBack_fewElements_storedInline) {
+    IntSmallVector elements;
+    elements.push_back(1);
+    elements.push_back(2);
+
+    EXPECT_TRUE(elements.isInline());
+    EXPECT_EQ(elements.capacity(), 2);
+    EXPECT_EQ(
+        std::vector<int>(elements.begin(), elements.end()),
+        std::vector<int>({1, 2})
+    );
+}
+
+TEST(SmallVector, pushBack_moreElementsThanInline_spillsToHeap) {
+    IntSmallVector elements = {1, 2};
+    elements.push_back(elements[0]);
+
+    EXPECT_FALSE(elements.isInline());
+    EXPECT_EQ(elements, IntSmallVector({1, 2, 1}));
+
+    elements.erase(elements.begin(), elements.begin() + 2);
+    elements.shrink_to_fit();
+    EXPECT_TRUE(elements.isInline());
+    EXPECT_EQ(elements, IntSmallVector({1}));
+}
+
+TEST(SmallVector, insertAndErase_anyPosition_orderKept) {
+    IntSmallVector elements = {1, 3};
+    elements.insert(elements.begin() + 1, 2);
+    elements.insert(elements.begin(), 0);
+    elements.insert(elements.end(), 4);
+
+    EXPECT_EQ(elements, IntSmallVector({0, 1, 2, 3, 4}));
+
+    elements.erase(elements.begin() + 2);
+    EXPECT_EQ(elements, IntSmallVector({0, 1, 3, 4}));
+}
+
+TEST(SmallVector, copyMoveAndSwap_inlineAndHeapElements_elementsKept) {
+    StringSmallVector inlineElements = {"a"};
+    StringSmallVector heapElements = {"b", "c"};
+
+    StringSmallVector copy(heapElements);
+    EXPECT_EQ(copy, heapElements);
+
+    inlineElements.swap(heapElements);
+    EXPECT_EQ(inlineElements, StringSmallVector({"b", "c"}));
+    EXPECT_EQ(heapElements, StringSmallVector({"a"}));
+
+    StringSmallVector moved(std::move(inlineElements));
+    EXPECT_EQ(moved, copy);
+    EXPECT_TRUE(inlineElements.empty());
+}
+
+TEST(SmallVectorStorage, addAndRemoveEdges_directedGraph_sameAsListStorage) {
+    SmallDirectedGraph graph(3);
+    DirectedGraph listGraph(3);
+    for (VertexIndex j : {2, 1, 0, 1, 0, 2}) {
+        graph.addEdge(0, j, true);
+        listGraph.addEdge(0, j, true);
+    }
+    graph.removeEdge(0, 1);
+    listGraph.removeEdge(0, 1);
+    graph.addEdge(2, 0);
+    listGraph.addEdge(2, 0);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), SmallSuccessors({2, 0, 0, 2}));
+    EXPECT_EQ(graph.getEdgeNumber(), listGraph.getEdgeNumber());
+    EXPECT_EQ(graph.getInDegrees(), listGraph.getInDegrees());
+    EXPECT_EQ(
+        algorithms::findVertexPredecessors(graph, 2),
+        algorithms::findVertexPredecessors(listGraph, 2)
+    );
+}
+
+TEST(SmallVectorStorage, getMemoryUsage_lowDegrees_noNeighbourAllocation) {
+    SmallDirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2);
+    graph.addEdge(1, 2);
+    size_t inlineAdjacency = graph.getMemoryUsage().adjacency;
+
+    EXPECT_EQ(inlineAdjacency, 3 * sizeof(SmallSuccessors));
+
+    for (VertexIndex j : {0, 1, 2})
+        graph.addEdge(2, j);
+    graph.addEdge(2, 2, true);
+    graph.addEdge(2, 2, true);
+    EXPECT_EQ(
+        graph.getMemoryUsage().adjacency,
+        inlineAdjacency + 8 * sizeof(VertexIndex)
+    );
+}
+
+TEST(SmallVectorStorage, labeledGraphs_labelsFollowNeighbours) {
+    LabeledDirectedGraph<std::string, SmallVectorStorage<2>> graph(3);
+    graph.addEdge(0, 2, std::string("a"));
+    graph.addEdge(0, 1, std::string("b"));
+    graph.addEdge(0, 0, std::string("c"));
+    graph.removeEdge(0, 2);
+
+    EXPECT_EQ(graph.getEdgeLabel(0, 1), "b");
+    EXPECT_EQ(graph.getEdgeLabel(0, 0), "c");
+
+    BasicDirectedMultigraph<SmallVectorStorage<>> multigraph(2);
+    multigraph.addMultiedge(0, 1, 3);
+    multigraph.addEdge(0, 1);
+    EXPECT_EQ(multigraph.getEdgeMultiplicity(0, 1), 4);
+}
+
+TEST(SmallVectorStorage, sortedStorage_undirectedGraph_neighboursSorted) {
+    LabeledUndirectedGraph<NoLabel, SortedStorage<SmallVectorStorage<2>>>
+        graph(4);
+    graph.addEdge(0, 3);
+    graph.addEdge(0, 1);
+    graph.addEdge(2, 0);
+    graph.removeEdge(1, 0);
+
+    EXPECT_EQ(graph.getNeighbours(0), (SmallVector<VertexIndex, 2>({2, 3})));
+    EXPECT_TRUE(graph.hasEdge(3, 0));
+}
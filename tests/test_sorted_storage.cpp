@@ -0,0 +1,169 @@
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_multigraph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef LabeledDirectedGraph<NoLabel, SortedStorage<>> SortedDirectedGraph;
+typedef LabeledUndirectedGraph<NoLabel, SortedStorage<>> SortedUndirectedGraph;
+typedef std::vector<VertexIndex> VectorSuccessors;
+
+TEST(SortedStorage, addEdge_directedGraph_successorsSorted) {
+    SortedDirectedGraph graph(5);
+    graph.addEdge(0, 3);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 4);
+    graph.addEdge(0, 0);
+    graph.addEdge(0, 3);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({0, 1, 3, 4}));
+    EXPECT_EQ(graph.getEdgeNumber(), 4);
+}
+
+TEST(SortedStorage, addEdge_force_duplicatesAdjacent) {
+    SortedDirectedGraph graph(3);
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2, true);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({1, 2, 2}));
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+}
+
+TEST(SortedStorage, hasEdge_directedGraph_sameAsUnsortedGraph) {
+    std::list<Edge> edges = {{0, 4}, {0, 2}, {2, 0}, {3, 3}, {1, 4}};
+    SortedDirectedGraph sortedGraph(edges);
+    DirectedGraph graph(edges);
+
+    for (VertexIndex i : graph)
+        for (VertexIndex j : graph)
+            EXPECT_EQ(sortedGraph.hasEdge(i, j), graph.hasEdge(i, j));
+}
+
+TEST(SortedStorage, removeEdge_directedGraphWithDuplicates_allRemoved) {
+    SortedDirectedGraph graph(4);
+    graph.addEdge(0, 3);
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 2, true);
+    graph.addEdge(0, 1);
+
+    graph.removeEdge(0, 2);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({1, 3}));
+    EXPECT_EQ(graph.getEdgeNumber(), 2);
+}
+
+TEST(SortedStorage, removeDuplicateEdges_directedGraph_oneOccurrenceKept) {
+    SortedDirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 1, true);
+    graph.addEdge(0, 1, true);
+    graph.addEdge(1, 1);
+    graph.addEdge(1, 1, true);
+
+    graph.removeDuplicateEdges();
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({1, 2}));
+    EXPECT_EQ(graph.getOutNeighbours(1), VectorSuccessors({1}));
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+}
+
+TEST(SortedStorage, operatorEqual_differentInsertionOrder_equal) {
+    LabeledDirectedGraph<std::string, SortedStorage<>> graph1(3), graph2(3);
+    graph1.addEdge(0, 1, std::string("a"));
+    graph1.addEdge(0, 2, std::string("b"));
+    graph2.addEdge(0, 2, std::string("b"));
+    graph2.addEdge(0, 1, std::string("a"));
+
+    EXPECT_TRUE(graph1 == graph2);
+
+    graph2.setEdgeLabel(0, 1, "c");
+    EXPECT_FALSE(graph1 == graph2);
+}
+
+TEST(SortedStorage, operatorEqual_differentEdges_notEqual) {
+    SortedDirectedGraph graph1(3), graph2(3);
+    graph1.addEdge(0, 1);
+    graph2.addEdge(0, 2);
+
+    EXPECT_FALSE(graph1 == graph2);
+}
+
+TEST(SortedStorage, addEdge_undirectedGraph_bothNeighboursSorted) {
+    SortedUndirectedGraph graph(4);
+    graph.addEdge(2, 1);
+    graph.addEdge(0, 1);
+    graph.addEdge(1, 1);
+    graph.addEdge(3, 1);
+    graph.addEdge(1, 3);
+
+    EXPECT_EQ(graph.getNeighbours(1), VectorSuccessors({0, 1, 2, 3}));
+    EXPECT_EQ(graph.getNeighbours(3), VectorSuccessors({1}));
+    EXPECT_EQ(graph.getEdgeNumber(), 4);
+    EXPECT_TRUE(graph.hasEdge(3, 1));
+}
+
+TEST(SortedStorage, removeDuplicateEdges_undirectedGraph_edgeNumberUpdated) {
+    SortedUndirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(1, 0, true);
+    graph.addEdge(2, 2);
+    graph.addEdge(2, 2, true);
+    graph.addEdge(1, 2);
+
+    graph.removeDuplicateEdges();
+
+    EXPECT_EQ(graph.getNeighbours(0), VectorSuccessors({1}));
+    EXPECT_EQ(graph.getNeighbours(1), VectorSuccessors({0, 2}));
+    EXPECT_EQ(graph.getNeighbours(2), VectorSuccessors({1, 2}));
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+}
+
+TEST(SortedStorage, weightedGraphs_addEdge_successorsSortedAndWeightsKept) {
+    BasicDirectedWeightedGraph<SortedStorage<>> directed(3);
+    directed.addEdge(0, 2, 1.5);
+    directed.addEdge(0, 1, 2);
+    EXPECT_EQ(directed.getOutNeighbours(0), VectorSuccessors({1, 2}));
+    EXPECT_EQ(directed.getEdgeWeight(0, 2), 1.5);
+
+    BasicUndirectedWeightedGraph<SortedStorage<>> undirected(3);
+    undirected.addEdge(2, 0, 1.5);
+    undirected.addEdge(1, 0, 2);
+    EXPECT_EQ(undirected.getOutNeighbours(0), VectorSuccessors({1, 2}));
+    EXPECT_EQ(undirected.getTotalWeight(), 3.5);
+}
+
+TEST(SortedStorage, multigraphs_addMultiedge_successorsSorted) {
+    BasicDirectedMultigraph<SortedStorage<>> directed(3);
+    directed.addMultiedge(0, 2, 2);
+    directed.addEdge(0, 1);
+    directed.addEdge(0, 2);
+    EXPECT_EQ(directed.getOutNeighbours(0), VectorSuccessors({1, 2}));
+    EXPECT_EQ(directed.getEdgeMultiplicity(0, 2), 3);
+
+    BasicUndirectedMultigraph<SortedStorage<>> undirected(3);
+    undirected.addMultiedge(2, 0, 2);
+    undirected.addEdge(1, 0);
+    undirected.removeMultiedge(0, 2, 2);
+    EXPECT_EQ(undirected.getOutNeighbours(0), VectorSuccessors({1}));
+    EXPECT_EQ(undirected.getTotalEdgeNumber(), 1);
+}
+
+TEST(SortedStorage, listContainer_addEdge_successorsSorted) {
+    LabeledDirectedGraph<NoLabel, SortedStorage<ListStorage>> graph(3);
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 0);
+    graph.addEdge(0, 1);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), Successors({0, 1, 2}));
+    EXPECT_TRUE(graph.hasEdge(0, 1));
+}
@@ -0,0 +1,182 @@
+#include "BaseGraph/compact_undirected_graph.hpp"
+#include "BaseGraph/compressed_undirected_graph.hpp"
+#include "BaseGraph/dense_undirected_graph.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/sparse_matrix.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_multigraph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<size_t> Offsets;
+typedef std::vector<VertexIndex> Indices;
+typedef std::vector<size_t> Counts;
+typedef std::vector<EdgeWeight> Weights;
+
+template <typename T>
+static std::vector<std::vector<T>> toDense(const SparseMatrix<T> &matrix) {
+    std::vector<std::vector<T>> dense(
+        matrix.size, std::vector<T>(matrix.size, 0)
+    );
+    SparseTriplets<T> triplets = matrix.toTriplets();
+    for (size_t k = 0; k < triplets.values.size(); ++k)
+        dense[triplets.rows[k]][triplets.columns[k]] = triplets.values[k];
+    return dense;
+}
+
+static DirectedGraph getDirectedGraph() {
+    DirectedGraph graph(4);
+    graph.addEdge(0, 3);
+    graph.addEdge(0, 1);
+    graph.addEdge(2, 0);
+    graph.addEdge(2, 2);
+    graph.addEdge(3, 1);
+    return graph;
+}
+
+TEST(SparseMatrix, buildSparseMatrix_unsortedTriplets_sortedAndMerged) {
+    SparseTriplets<int> triplets;
+    triplets.addEntry(1, 2, 1);
+    triplets.addEntry(0, 1, 2);
+    triplets.addEntry(1, 0, 3);
+    triplets.addEntry(1, 2, 4);
+
+    auto summed =
+        buildSparseMatrix(3, triplets, SparseOrientation::Rows, SumEntries());
+    EXPECT_EQ(summed.offsets, Offsets({0, 1, 3, 3}));
+    EXPECT_EQ(summed.indices, Indices({1, 0, 2}));
+    EXPECT_EQ(summed.values, std::vector<int>({2, 3, 5}));
+
+    auto kept = buildSparseMatrix(
+        3, triplets, SparseOrientation::Columns, KeepLastEntry()
+    );
+    EXPECT_EQ(kept.offsets, Offsets({0, 1, 2, 3}));
+    EXPECT_EQ(kept.indices, Indices({1, 0, 1}));
+    EXPECT_EQ(kept.values, std::vector<int>({3, 2, 4}));
+}
+
+TEST(SparseMatrix, toTriplets_columnOrientation_rowsAndColumnsKept) {
+    auto matrix = getDirectedGraph().getSparseAdjacency(
+        SparseOrientation::Columns
+    );
+    SparseTriplets<size_t> triplets = matrix.toTriplets();
+
+    EXPECT_EQ(triplets.rows, Indices({2, 0, 3, 2, 0}));
+    EXPECT_EQ(triplets.columns, Indices({0, 1, 1, 2, 3}));
+    EXPECT_EQ(triplets.values, Counts({1, 1, 1, 1, 1}));
+}
+
+TEST(DirectedGraph, getSparseAdjacency_rowOrientation_compressedSparseRows) {
+    auto matrix = getDirectedGraph().getSparseAdjacency();
+
+    EXPECT_EQ(matrix.size, 4);
+    EXPECT_EQ(matrix.offsets, Offsets({0, 2, 2, 4, 5}));
+    EXPECT_EQ(matrix.indices, Indices({1, 3, 0, 2, 1}));
+    EXPECT_EQ(matrix.getNonzeroNumber(), 5);
+}
+
+TEST(DirectedGraph, getSparseAdjacency_anyOrientation_sameAsDenseMatrix) {
+    DirectedGraph graph = getDirectedGraph();
+    graph.addEdge(0, 3, true);
+
+    EXPECT_EQ(toDense(graph.getSparseAdjacency()), graph.getAdjacencyMatrix());
+    EXPECT_EQ(
+        toDense(graph.getSparseAdjacency(SparseOrientation::Columns)),
+        graph.getAdjacencyMatrix()
+    );
+}
+
+TEST(UndirectedGraph, getSparseAdjacency_selfLoops_countedLikeDenseMatrix) {
+    UndirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(1, 1);
+    graph.addEdge(2, 0);
+
+    auto matrix = graph.getSparseAdjacency();
+    EXPECT_EQ(matrix.offsets, Offsets({0, 2, 4, 5}));
+    EXPECT_EQ(matrix.indices, Indices({1, 2, 0, 1, 0}));
+    EXPECT_EQ(matrix.values, Counts({1, 1, 1, 2, 1}));
+    EXPECT_EQ(
+        toDense(graph.getSparseAdjacency(false)),
+        graph.getAdjacencyMatrix(false)
+    );
+}
+
+TEST(WeightedGraphs, getSparseWeights_anyGraph_sameAsWeightMatrix) {
+    DirectedWeightedGraph directedGraph(3);
+    directedGraph.addEdge(0, 2, 1.5);
+    directedGraph.addEdge(2, 1, -2);
+    directedGraph.addEdge(1, 1, 0.5);
+
+    auto matrix = directedGraph.getSparseWeights(SparseOrientation::Columns);
+    EXPECT_EQ(matrix.offsets, Offsets({0, 0, 2, 3}));
+    EXPECT_EQ(matrix.values, Weights({0.5, -2, 1.5}));
+    EXPECT_EQ(toDense(matrix), directedGraph.getWeightMatrix());
+
+    UndirectedWeightedGraph undirectedGraph(3);
+    undirectedGraph.addEdge(0, 2, 1.5);
+    undirectedGraph.addEdge(1, 1, 0.5);
+    EXPECT_EQ(
+        toDense(undirectedGraph.getSparseWeights()),
+        undirectedGraph.getWeightMatrix()
+    );
+    EXPECT_EQ(
+        toDense(undirectedGraph.getSparseAdjacency()),
+        undirectedGraph.getAdjacencyMatrix()
+    );
+}
+
+TEST(Multigraphs, getSparseAdjacency_anyGraph_multiplicitiesAsValues) {
+    DirectedMultigraph directedGraph(3);
+    directedGraph.addMultiedge(0, 1, 3);
+    directedGraph.addMultiedge(2, 2, 2);
+
+    auto matrix = directedGraph.getSparseAdjacency();
+    EXPECT_EQ(matrix.values, Counts({3, 2}));
+    EXPECT_EQ(toDense(matrix), directedGraph.getAdjacencyMatrix());
+
+    UndirectedMultigraph undirectedGraph(3);
+    undirectedGraph.addMultiedge(0, 1, 3);
+    undirectedGraph.addMultiedge(2, 2, 2);
+    EXPECT_EQ(
+        toDense(undirectedGraph.getSparseAdjacency()),
+        undirectedGraph.getAdjacencyMatrix()
+    );
+    EXPECT_EQ(
+        toDense(undirectedGraph.getSparseAdjacency(false)),
+        undirectedGraph.getAdjacencyMatrix(false)
+    );
+}
+
+TEST(ReadOnlyGraphs, getSparseAdjacency_anyGraph_sameAsDenseMatrix) {
+    UndirectedGraph graph(4);
+    graph.addEdge(0, 3);
+    graph.addEdge(3, 3);
+    graph.addEdge(1, 2);
+
+    CompactUndirectedGraph compactGraph(graph);
+    EXPECT_EQ(
+        toDense(compactGraph.getSparseAdjacency()), graph.getAdjacencyMatrix()
+    );
+    EXPECT_EQ(
+        toDense(compress(graph).getSparseAdjacency()),
+        graph.getAdjacencyMatrix()
+    );
+
+    DenseUndirectedGraph denseGraph(4);
+    for (auto edge : graph.edges())
+        denseGraph.addEdge(edge.first, edge.second);
+    EXPECT_EQ(
+        toDense(denseGraph.getSparseAdjacency(false)),
+        graph.getAdjacencyMatrix(false)
+    );
+
+    CompactDirectedMultigraph multigraph(DirectedMultigraph(2));
+    EXPECT_EQ(multigraph.getSparseAdjacency().offsets, Offsets({0, 0, 0}));
+}
@@ -4,6 +4,7 @@
 #include "gtest/gtest.h"
 #include <deque>
 #include <list>
+#include <set>
 #include <stdexcept>
 
 typedef ::testing::Types<std::string, int> TestTypes;
@@ -229,6 +230,36 @@ TYPED_TEST(
     );
 }
 
+TYPED_TEST(
+    EdgeLabeledUndirectedGraph_, setEdgeLabel_reversedVertices_bothEndsChanged
+) {
+    this->graph.addEdge(0, 2, this->labels[0]);
+    this->graph.addEdge(1, 2, this->labels[1]);
+    this->graph.setEdgeLabel(2, 0, this->labels[2]);
+
+    this->EXPECT_LABEL({0, 2}, 2);
+    this->EXPECT_LABEL({1, 2}, 1);
+    std::list<TypeParam> expectedLabels = {this->labels[2], this->labels[1]};
+    EXPECT_EQ(this->graph.getOutEdgeLabels(2), expectedLabels);
+}
+
+TYPED_TEST(
+    EdgeLabeledUndirectedGraph_,
+    getOutEdgeLabels_anyEdges_labelsInNeighbourOrder
+) {
+    this->graph.addEdge(0, 2, this->labels[0]);
+    this->graph.addEdge(1, 0, this->labels[1]);
+    this->graph.addEdge(0, 0, this->labels[2]);
+    this->graph.removeEdge(2, 0);
+
+    this->EXPECT_NEIGHBOURS(0, {1, 0});
+    std::list<TypeParam> expectedLabels = {this->labels[1], this->labels[2]};
+    EXPECT_EQ(this->graph.getOutEdgeLabels(0), expectedLabels);
+    EXPECT_EQ(
+        this->graph.getOutEdgeLabels(1), std::list<TypeParam>({this->labels[1]})
+    );
+}
+
 TYPED_TEST(
     EdgeLabeledUndirectedGraph_,
     setEdgeLabel_vertexOutOfRange_throwInvalidArgument
@@ -315,6 +315,26 @@ TEST(UndirectedMultigraph, getEdgeMultiplicity_inexistentEdge_return0) {
     EXPECT_EQ(graph.getEdgeMultiplicity(0, 2), 0);
 }
 
+TEST(
+    UndirectedMultigraph,
+    getOutEdgeMultiplicities_multiedgeChanged_bothEndsUpdated
+) {
+    BaseGraph::UndirectedMultigraph graph(3);
+    graph.addMultiedge(0, 2, 3);
+    graph.addEdge(1, 0);
+    graph.addEdge(2, 0);
+    graph.removeMultiedge(1, 0, 1);
+
+    EXPECT_EQ(
+        graph.getOutEdgeMultiplicities(0), std::list<unsigned int>({4})
+    );
+    EXPECT_EQ(
+        graph.getOutEdgeMultiplicities(2), std::list<unsigned int>({4})
+    );
+    EXPECT_EQ(graph.getOutEdgeMultiplicities(1), std::list<unsigned int>());
+    EXPECT_EQ(graph.getDegree(2), 4);
+}
+
 TEST(
     UndirectedMultigraph, getEdgeMultiplicity_vertexOutOfRange_throwOutOfRange
 ) {
@@ -364,6 +384,25 @@ TEST(UndirectedMultigraph, getDegrees_countSelfLoopsOnce_returnCorrectDegrees) {
     EXPECT_EQ(graph.getDegree(2, false), 0);
 }
 
+TEST(UndirectedMultigraph, degrees_afterEdgeRemovals_degreesUpdated) {
+    BaseGraph::UndirectedMultigraph graph(3);
+    graph.addMultiedge(0, 1, 3);
+    graph.addMultiedge(1, 2, 2);
+    graph.addMultiedge(2, 2, 2);
+
+    graph.removeMultiedge(1, 0, 2);
+    graph.setEdgeMultiplicity(2, 2, 1);
+    EXPECT_EQ(graph.getDegrees(), std::vector<size_t>({1, 3, 4}));
+    EXPECT_EQ(graph.getDegrees(false), std::vector<size_t>({1, 3, 3}));
+
+    graph.removeVertexFromEdgeList(2);
+    EXPECT_EQ(graph.getDegrees(), std::vector<size_t>({1, 1, 0}));
+
+    graph.resize(4);
+    graph.clearEdges();
+    EXPECT_EQ(graph.getDegrees(), std::vector<size_t>({0, 0, 0, 0}));
+}
+
 TEST(UndirectedMultigraph, getDegree_vertexOutOfRange_throwOutOfRange) {
     BaseGraph::UndirectedMultigraph graph(0);
     EXPECT_THROW(graph.getDegree(0), std::out_of_range);
@@ -445,6 +484,26 @@ TEST(
     );
 }
 
+TEST(UndirectedMultigraph, mergeDuplicateEdges_multiedge_multiplicitiesSummed) {
+    BaseGraph::UndirectedMultigraph graph(multiplicities.size());
+    graph.addMultiedge(0, 1, multiplicities[0]);
+    graph.addMultiedge(0, 2, multiplicities[1]);
+    graph.addMultiedge(0, 1, multiplicities[0], true);
+    graph.addMultiedge(1, 1, multiplicities[2]);
+    graph.addMultiedge(1, 1, multiplicities[2], true);
+
+    graph.mergeDuplicateEdges();
+
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+    EXPECT_EQ(graph.getEdgeMultiplicity(0, 1), 2 * multiplicities[0]);
+    EXPECT_EQ(graph.getEdgeMultiplicity(1, 1), 2 * multiplicities[2]);
+    EXPECT_EQ(
+        graph.getTotalEdgeNumber(),
+        2 * multiplicities[0] + multiplicities[1] + 2 * multiplicities[2]
+    );
+    EXPECT_EQ(graph.getDegree(0), 2 * multiplicities[0] + multiplicities[1]);
+}
+
 TEST(UndirectedMultigraph, removeSelfLoops_noSelfLoop_doNothing) {
     BaseGraph::UndirectedMultigraph graph(multiplicities.size());
     graph.addMultiedge(0, 1, multiplicities[0]);
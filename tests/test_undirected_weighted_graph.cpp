@@ -89,6 +89,32 @@ TEST(UndirectedWeightedGraph, setEdgeWeight_inexistentEdge_addEdge) {
     EXPECT_EQ(graph.getTotalWeight(), .5);
 }
 
+TEST(
+    UndirectedWeightedGraph,
+    setEdgeWeight_existentEdgeReversed_weightAndTotalWeightUpdated
+) {
+    BaseGraph::UndirectedWeightedGraph graph(3);
+    graph.addEdge(0, 2, 1.5);
+    graph.addEdge(0, 1, 1);
+    graph.setEdgeWeight(2, 0, -1);
+
+    EXPECT_EQ(graph.getEdgeWeight(0, 2), -1);
+    EXPECT_EQ(graph.getEdgeWeight(2, 0), -1);
+    EXPECT_EQ(graph.getEdgeNumber(), 2);
+    EXPECT_EQ(graph.getTotalWeight(), 0);
+}
+
+TEST(UndirectedWeightedGraph, getOutEdgeWeights_anyEdges_weightsOfNeighbours) {
+    BaseGraph::UndirectedWeightedGraph graph(3);
+    graph.addEdge(0, 2, 1.5);
+    graph.addEdge(1, 0, -2);
+    graph.addEdge(0, 0, 1);
+
+    EXPECT_EQ(graph.getOutEdgeWeights(0), std::list<double>({1.5, -2, 1}));
+    EXPECT_EQ(graph.getOutEdgeWeights(1), std::list<double>({-2}));
+    EXPECT_EQ(graph.getOutEdgeWeights(2), std::list<double>({1.5}));
+}
+
 TEST(UndirectedWeightedGraph, setEdgeWeight_vertexOutOfRange_throwOutOfRange) {
     BaseGraph::UndirectedWeightedGraph graph(0);
     EXPECT_THROW(graph.setEdgeWeight(0, 0, 1), std::out_of_range);
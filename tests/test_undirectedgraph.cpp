@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <deque>
 #include <list>
+#include <set>
 #include <stdexcept>
 
 TEST(UndirectedGraph, getNeighbours_vertexOutOfRange_throwInvalidArgument) {
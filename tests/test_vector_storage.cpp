@@ -0,0 +1,174 @@
+#include "BaseGraph/algorithms/paths.hpp"
+#include "BaseGraph/algorithms/topology.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_multigraph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <list>
+#include <type_traits>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef LabeledDirectedGraph<NoLabel, VectorStorage> VectorDirectedGraph;
+typedef LabeledUndirectedGraph<NoLabel, VectorStorage> VectorUndirectedGraph;
+typedef std::vector<VertexIndex> VectorSuccessors;
+
+TEST(VectorStorage, successors_directedGraph_areContiguous) {
+    EXPECT_TRUE(
+        (std::is_same<VectorDirectedGraph::Successors, VectorSuccessors>::value)
+    );
+    EXPECT_TRUE((std::is_same<DirectedGraph::Successors, Successors>::value));
+}
+
+TEST(VectorStorage, addEdge_directedGraph_successorsInInsertionOrder) {
+    VectorDirectedGraph graph(3);
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2);
+    graph.addEdge(1, 1);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({2, 1}));
+    EXPECT_EQ(graph.getOutNeighbours(1), VectorSuccessors({1}));
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+}
+
+TEST(VectorStorage, removeEdge_directedGraphWithDuplicates_allRemoved) {
+    VectorDirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 1, true);
+
+    graph.removeEdge(0, 1);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({2}));
+    EXPECT_EQ(graph.getEdgeNumber(), 1);
+}
+
+TEST(VectorStorage, removeDuplicateEdges_directedGraph_keepFirstOccurrence) {
+    VectorDirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2);
+    graph.addEdge(0, 1, true);
+    graph.addEdge(0, 1, true);
+    graph.addEdge(0, 2, true);
+
+    graph.removeDuplicateEdges();
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({1, 2}));
+    EXPECT_EQ(graph.getEdgeNumber(), 2);
+}
+
+TEST(VectorStorage, removeVertexFromEdgeList_directedGraph_vertexNotInEdges) {
+    VectorDirectedGraph graph(4);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 0);
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 0);
+    graph.addEdge(1, 0, true);
+    graph.addEdge(1, 3);
+
+    graph.removeVertexFromEdgeList(0);
+
+    EXPECT_EQ(graph.getOutNeighbours(0), VectorSuccessors({}));
+    EXPECT_EQ(graph.getOutNeighbours(1), VectorSuccessors({2, 3}));
+    EXPECT_EQ(graph.getEdgeNumber(), 2);
+}
+
+TEST(VectorStorage, edges_directedGraph_returnEachEdge) {
+    std::list<Edge> edges = {{1, 2}, {1, 0}, {1, 1}, {3, 0}};
+    VectorDirectedGraph graph(edges);
+
+    std::list<Edge> loopEdges;
+    for (const Edge &edge : graph.edges())
+        loopEdges.push_back(edge);
+    EXPECT_EQ(loopEdges, edges);
+}
+
+TEST(VectorStorage, removeEdge_undirectedGraph_removedInBothLists) {
+    VectorUndirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2);
+    graph.addEdge(1, 1);
+
+    graph.removeEdge(1, 0);
+    graph.removeEdge(1, 1);
+
+    EXPECT_EQ(graph.getNeighbours(0), VectorSuccessors({2}));
+    EXPECT_EQ(graph.getNeighbours(1), VectorSuccessors({}));
+    EXPECT_EQ(graph.getNeighbours(2), VectorSuccessors({0}));
+    EXPECT_EQ(graph.getEdgeNumber(), 1);
+}
+
+TEST(VectorStorage, removeVertexFromEdgeList_undirectedGraph_vertexNotInEdges) {
+    VectorUndirectedGraph graph(4);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 0);
+    graph.addEdge(1, 2);
+    graph.addEdge(0, 3);
+    graph.addEdge(1, 3);
+
+    graph.removeVertexFromEdgeList(0);
+
+    EXPECT_EQ(graph.getNeighbours(0), VectorSuccessors({}));
+    EXPECT_EQ(graph.getNeighbours(1), VectorSuccessors({2, 3}));
+    EXPECT_EQ(graph.getNeighbours(3), VectorSuccessors({1}));
+    EXPECT_EQ(graph.getEdgeNumber(), 2);
+}
+
+TEST(VectorStorage, weightedGraphs_addAndRemoveEdges_totalWeightUpdated) {
+    BasicDirectedWeightedGraph<VectorStorage> directed(3);
+    directed.addEdge(0, 1, 1.5);
+    directed.addEdge(1, 2, 2);
+    directed.removeEdge(0, 1);
+    EXPECT_EQ(directed.getOutNeighbours(0), VectorSuccessors({}));
+    EXPECT_EQ(directed.getTotalWeight(), 2);
+
+    BasicUndirectedWeightedGraph<VectorStorage> undirected(3);
+    undirected.addEdge(0, 1, 1.5);
+    undirected.addEdge(1, 2, 2);
+    undirected.removeEdge(1, 0);
+    EXPECT_EQ(undirected.getOutNeighbours(1), VectorSuccessors({2}));
+    EXPECT_EQ(undirected.getTotalWeight(), 2);
+}
+
+TEST(VectorStorage, multigraphs_removeMultiedge_edgeErasedAtZero) {
+    BasicDirectedMultigraph<VectorStorage> directed(3);
+    directed.addMultiedge(0, 1, 2);
+    directed.addEdge(0, 2);
+    directed.removeMultiedge(0, 1, 2);
+    EXPECT_EQ(directed.getOutNeighbours(0), VectorSuccessors({2}));
+    EXPECT_EQ(directed.getTotalEdgeNumber(), 1);
+
+    BasicUndirectedMultigraph<VectorStorage> undirected(3);
+    undirected.addMultiedge(0, 1, 2);
+    undirected.addEdge(0, 2);
+    undirected.removeMultiedge(1, 0, 2);
+    EXPECT_EQ(undirected.getOutNeighbours(0), VectorSuccessors({2}));
+    EXPECT_EQ(undirected.getOutNeighbours(1), VectorSuccessors({}));
+    EXPECT_EQ(undirected.getTotalEdgeNumber(), 1);
+}
+
+TEST(VectorStorage, algorithms_vectorStorageGraph_sameResultAsListStorage) {
+    std::list<Edge> edges = {{0, 1}, {1, 2}, {2, 3}, {0, 4}, {4, 3}};
+    VectorUndirectedGraph vectorGraph(edges);
+    UndirectedGraph listGraph(edges);
+
+    EXPECT_EQ(
+        algorithms::findAllGeodesics(vectorGraph, 0, 3),
+        algorithms::findAllGeodesics(listGraph, 0, 3)
+    );
+    EXPECT_EQ(
+        algorithms::findVertexPredecessors(vectorGraph, 1),
+        algorithms::findVertexPredecessors(listGraph, 1)
+    );
+
+    auto subgraph = algorithms::getSubgraph(vectorGraph, {0, 1, 2});
+    EXPECT_TRUE(subgraph.hasEdge(0, 1));
+    EXPECT_FALSE(subgraph.hasEdge(2, 3));
+    EXPECT_EQ(subgraph.getEdgeNumber(), 2);
+}
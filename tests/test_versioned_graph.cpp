@@ -0,0 +1,113 @@
+#include "BaseGraph/algorithms/paths.hpp"
+#include "BaseGraph/versioned_directed_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> Neighbours;
+
+static const size_t blockSize = VersionedDirectedGraph::getBlockSize();
+
+TEST(VersionedDirectedGraph, updatesAfterSnapshot_snapshotUnchanged) {
+    VersionedDirectedGraph graph(3);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 2);
+    graph.addEdge(2, 2);
+    graph.addEdge(0, 1);
+
+    DirectedGraphSnapshot snapshot = graph.getSnapshot();
+    graph.removeEdge(0, 1);
+    graph.addEdge(1, 0);
+    graph.resize(2 * blockSize);
+    graph.addEdge(2 * blockSize - 1, 0);
+
+    EXPECT_EQ(snapshot.getSize(), 3);
+    EXPECT_EQ(snapshot.getEdgeNumber(), 3);
+    EXPECT_EQ(snapshot.getOutNeighbours(0), Neighbours({1, 2}));
+    EXPECT_TRUE(snapshot.getOutNeighbours(1).empty());
+    EXPECT_THROW(snapshot.getOutNeighbours(3), std::out_of_range);
+
+    EXPECT_EQ(graph.getSize(), 2 * blockSize);
+    EXPECT_EQ(graph.getEdgeNumber(), 4);
+    EXPECT_EQ(graph.getOutNeighbours(0), Neighbours({2}));
+    EXPECT_EQ(graph.getOutNeighbours(1), Neighbours({0}));
+    EXPECT_TRUE(graph.hasEdge(2 * blockSize - 1, 0));
+    EXPECT_THROW(graph.resize(3), std::invalid_argument);
+}
+
+TEST(VersionedDirectedGraph, updatesAfterSnapshot_onlyModifiedBlocksCopied) {
+    VersionedDirectedGraph graph(3 * blockSize);
+    for (VertexIndex i : graph)
+        graph.addEdge(i, (i + 1) % graph.getSize());
+
+    DirectedGraphSnapshot snapshot = graph.getSnapshot();
+    DirectedGraphSnapshot otherSnapshot = snapshot;
+    for (VertexIndex i : graph)
+        EXPECT_EQ(&snapshot.getOutNeighbours(i), &graph.getOutNeighbours(i));
+
+    graph.addEdge(blockSize + 1, 0);
+    graph.addEdge(blockSize + 2, 0);
+    for (VertexIndex i : graph) {
+        bool inModifiedBlock = i / blockSize == 1;
+        EXPECT_EQ(
+            &snapshot.getOutNeighbours(i) == &graph.getOutNeighbours(i),
+            !inModifiedBlock
+        );
+        EXPECT_EQ(
+            &snapshot.getOutNeighbours(i), &otherSnapshot.getOutNeighbours(i)
+        );
+    }
+    EXPECT_EQ(snapshot.getOutDegree(blockSize + 1), 1);
+    EXPECT_EQ(graph.getOutDegree(blockSize + 1), 2);
+}
+
+TEST(LabeledVersionedDirectedGraph, anyUpdates_labelsKept) {
+    LabeledVersionedDirectedGraph<std::string> graph(3);
+    graph.addEdge(0, 1, std::string("a"));
+    graph.addEdge(0, 2, std::string("b"));
+    graph.addEdge(0, 1, std::string("c"));
+
+    auto snapshot = graph.getSnapshot();
+    graph.removeEdge(0, 1);
+    graph.addEdge(0, 1, std::string("d"));
+
+    EXPECT_EQ(snapshot.getEdgeLabel(0, 1), "a");
+    EXPECT_EQ(
+        snapshot.getOutEdgeLabels(0), std::vector<std::string>({"a", "b"})
+    );
+    EXPECT_EQ(graph.getOutNeighbours(0), Neighbours({2, 1}));
+    EXPECT_EQ(graph.getOutEdgeLabels(0), std::vector<std::string>({"b", "d"}));
+    EXPECT_EQ(graph.getEdgeLabel(2, 0, false), "");
+    EXPECT_THROW(graph.getEdgeLabel(2, 0), std::invalid_argument);
+}
+
+TEST(VersionedDirectedGraph, readerThread_readsConsistentVersion) {
+    const size_t size = 4 * blockSize;
+    VersionedDirectedGraph graph(size);
+    for (VertexIndex i = 0; i + 1 < size; ++i)
+        graph.addEdge(i, i + 1);
+
+    DirectedGraphSnapshot snapshot = graph.getSnapshot();
+    std::vector<algorithms::Path> paths;
+    std::thread reader([snapshot, &paths]() {
+        for (size_t k = 0; k < 20; ++k)
+            paths.push_back(
+                algorithms::findGeodesics(snapshot, 0, size - 1)
+            );
+    });
+    for (VertexIndex i = 0; i + 2 < size; ++i) {
+        graph.addEdge(i, i + 2);
+        if (i % 3 == 0)
+            graph.removeEdge(i, i + 1);
+    }
+    reader.join();
+
+    for (const algorithms::Path &path : paths)
+        EXPECT_EQ(path.size(), size);
+    EXPECT_LT(algorithms::findGeodesics(graph, 0, size - 1).size(), size);
+}
@@ -0,0 +1,122 @@
+#include "BaseGraph/algorithms/topology.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+#include "BaseGraph/vertex_properties.hpp"
+
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<std::string> Names;
+
+static DirectedGraph getGraphWithProperties() {
+    DirectedGraph graph(4);
+    graph.addEdges(std::vector<Edge>{{0, 1}, {1, 2}, {2, 3}, {3, 0}});
+    graph.getVertexProperties().add("name", Names({"a", "b", "c", "d"}));
+    graph.getVertexProperties().add<double>("score", -1);
+    graph.getVertexProperties().get<double>("score")[2] = 5;
+    return graph;
+}
+
+TEST(VertexProperties, addAndGet_anyColumns_valuesPerVertex) {
+    VertexProperties properties(3);
+    std::vector<int> &counts = properties.add<int>("count", 7);
+    counts[1] = 2;
+    properties.add("name", Names({"a", "b", "c"}), std::string("?"));
+
+    EXPECT_EQ(properties.getNames(), Names({"count", "name"}));
+    EXPECT_EQ(properties.get<int>("count"), std::vector<int>({7, 2, 7}));
+    EXPECT_TRUE(properties.has("name"));
+    EXPECT_THROW(properties.add<int>("count"), std::invalid_argument);
+    EXPECT_THROW(properties.add("other", Names()), std::invalid_argument);
+    EXPECT_THROW(properties.get<double>("count"), std::invalid_argument);
+    EXPECT_THROW(properties.get<int>("other"), std::invalid_argument);
+
+    properties.resize(4);
+    EXPECT_EQ(properties.get<std::string>("name")[3], "?");
+    EXPECT_EQ(properties.get<int>("count")[3], 7);
+
+    properties.remove("count");
+    EXPECT_FALSE(properties.has("count"));
+    EXPECT_EQ(properties.getColumnNumber(), 1);
+}
+
+TEST(DirectedGraph, vertexProperties_resizeAndRemoval_rowsFollowVertices) {
+    DirectedGraph graph = getGraphWithProperties();
+    DirectedGraph copy = graph;
+    graph.resize(6);
+    EXPECT_EQ(
+        graph.getVertexProperties().get<double>("score"),
+        std::vector<double>({-1, -1, 5, -1, -1, -1})
+    );
+
+    graph.removeVertices({0, 4});
+    EXPECT_EQ(graph.getVertexProperties().getSize(), 4);
+    EXPECT_EQ(
+        graph.getVertexProperties().get<std::string>("name"),
+        Names({"b", "c", "d", ""})
+    );
+    EXPECT_EQ(
+        graph.getVertexProperties().get<double>("score"),
+        std::vector<double>({-1, 5, -1, -1})
+    );
+    EXPECT_EQ(
+        copy.getVertexProperties().get<std::string>("name"),
+        Names({"a", "b", "c", "d"})
+    );
+}
+
+TEST(DirectedGraph, vertexProperties_getPermutedGraph_rowsPermuted) {
+    DirectedGraph graph = getGraphWithProperties();
+    DirectedGraph permutedGraph = graph.getPermutedGraph({2, 0, 3, 1});
+    EXPECT_EQ(
+        permutedGraph.getVertexProperties().get<std::string>("name"),
+        Names({"b", "d", "a", "c"})
+    );
+    EXPECT_EQ(
+        permutedGraph.getVertexProperties().get<double>("score")[3], 5
+    );
+}
+
+TEST(UndirectedWeightedGraph, vertexProperties_anyOperation_rowsFollow) {
+    UndirectedWeightedGraph graph(3);
+    graph.addEdge(0, 1, 2.5);
+    graph.getVertexProperties().add("id", std::vector<int>({10, 11, 12}));
+
+    auto permutedGraph = graph.getPermutedGraph({1, 2, 0});
+    EXPECT_EQ(
+        permutedGraph.getVertexProperties().get<int>("id"),
+        std::vector<int>({12, 10, 11})
+    );
+    graph.removeVertices({1});
+    EXPECT_EQ(
+        graph.getVertexProperties().get<int>("id"), std::vector<int>({10, 12})
+    );
+}
+
+TEST(VertexProperties, getSubgraph_anyVertices_propertiesKept) {
+    DirectedGraph graph = getGraphWithProperties();
+
+    auto subgraph = algorithms::getSubgraph(graph, {1, 2});
+    EXPECT_EQ(
+        subgraph.getVertexProperties().get<std::string>("name"),
+        Names({"a", "b", "c", "d"})
+    );
+
+    auto subgraphAndRemap = algorithms::getSubgraphWithRemap(graph, {0, 2, 3});
+    const auto &remap = subgraphAndRemap.second;
+    const auto &names =
+        subgraphAndRemap.first.getVertexProperties().get<std::string>("name");
+    ASSERT_EQ(names.size(), 3);
+    EXPECT_EQ(names[remap.at(0)], "a");
+    EXPECT_EQ(names[remap.at(2)], "c");
+    EXPECT_EQ(names[remap.at(3)], "d");
+    EXPECT_EQ(
+        subgraphAndRemap.first.getVertexProperties().get<double>("score")
+            [remap.at(2)],
+        5
+    );
+}
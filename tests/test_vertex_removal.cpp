@@ -0,0 +1,154 @@
+#include "BaseGraph/dense_directed_graph.hpp"
+#include "BaseGraph/dense_undirected_graph.hpp"
+#include "BaseGraph/directed_graph.hpp"
+#include "BaseGraph/directed_multigraph.hpp"
+#include "BaseGraph/directed_weighted_graph.hpp"
+#include "BaseGraph/undirected_graph.hpp"
+#include "BaseGraph/undirected_multigraph.hpp"
+#include "BaseGraph/undirected_weighted_graph.hpp"
+
+#include "gtest/gtest.h"
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace BaseGraph;
+
+typedef std::vector<VertexIndex> Indices;
+
+static const Indices removedVertices = {1, 4, 1};
+static const Indices expectedNewIndices = {
+    0, REMOVED_VERTEX, 1, 2, REMOVED_VERTEX, 3
+};
+
+TEST(VertexRemoval, getIndicesAfterRemoval_anyVertices_remainingInOrder) {
+    EXPECT_EQ(getIndicesAfterRemoval(removedVertices, 6), expectedNewIndices);
+    EXPECT_EQ(getIndicesAfterRemoval({}, 2), Indices({0, 1}));
+    EXPECT_THROW(getIndicesAfterRemoval({6}, 6), std::out_of_range);
+
+    std::vector<std::string> values = {"a", "b", "c", "d", "e", "f"};
+    applyIndicesAfterRemoval(values, expectedNewIndices);
+    EXPECT_EQ(values, std::vector<std::string>({"a", "c", "d", "f"}));
+}
+
+TEST(DirectedGraph, removeVertices_anyVertices_edgesAndLabelsCompacted) {
+    LabeledDirectedGraph<std::string> graph(6);
+    graph.addEdge(0, 1, std::string("a"));
+    graph.addEdge(0, 5, std::string("b"));
+    graph.addEdge(0, 2, std::string("c"));
+    graph.addEdge(3, 3, std::string("d"));
+    graph.addEdge(4, 0, std::string("e"));
+    graph.addEdge(5, 3, std::string("f"));
+
+    EXPECT_EQ(graph.removeVertices(removedVertices), expectedNewIndices);
+    EXPECT_EQ(graph.getSize(), 4);
+    EXPECT_EQ(graph.getEdgeNumber(), 4);
+    EXPECT_EQ(graph.getOutNeighbours(0), std::list<VertexIndex>({3, 1}));
+    EXPECT_EQ(graph.getEdgeLabel(0, 3), "b");
+    EXPECT_EQ(graph.getEdgeLabel(0, 1), "c");
+    EXPECT_EQ(graph.getEdgeLabel(2, 2), "d");
+    EXPECT_EQ(graph.getEdgeLabel(3, 2), "f");
+    EXPECT_TRUE(graph.getOutNeighbours(1).empty());
+
+    graph.addEdge(3, 0, std::string("g"));
+    EXPECT_EQ(graph.getEdgeNumber(), 5);
+    EXPECT_THROW(graph.removeVertices({4}), std::out_of_range);
+}
+
+TEST(DirectedGraph, removeVertices_sortedStorageAndInNeighbours_kept) {
+    LabeledDirectedGraph<NoLabel, SortedStorage<VectorStorage>> graph(6);
+    graph.trackInNeighbours();
+    graph.addEdges(std::vector<Edge>{{0, 5}, {0, 3}, {0, 4}, {2, 3}, {4, 3}});
+
+    graph.removeVertices(removedVertices);
+    EXPECT_EQ(graph.getOutNeighbours(0), std::vector<VertexIndex>({2, 3}));
+    EXPECT_EQ(graph.getInNeighbours(2), std::vector<VertexIndex>({0, 1}));
+    EXPECT_TRUE(graph.getInNeighbours(1).empty());
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+}
+
+TEST(UndirectedGraph, removeVertices_anyVertices_edgesCompacted) {
+    UndirectedGraph graph(6);
+    graph.addEdges(std::vector<Edge>{{0, 1}, {0, 5}, {1, 1}, {2, 3}, {3, 3}});
+    graph.addEdge(4, 5);
+
+    EXPECT_EQ(graph.removeVertices(removedVertices), expectedNewIndices);
+    EXPECT_EQ(graph.getSize(), 4);
+    EXPECT_EQ(graph.getEdgeNumber(), 3);
+    EXPECT_EQ(graph.getNeighbours(3), std::list<VertexIndex>({0}));
+    EXPECT_EQ(graph.getNeighbours(2), std::list<VertexIndex>({1, 2}));
+    EXPECT_EQ(graph.getDegree(2), 3);
+}
+
+TEST(WeightedGraphs, removeVertices_anyGraph_totalWeightUpdated) {
+    DirectedWeightedGraph directedGraph(6);
+    directedGraph.addEdge(0, 1, 1.5);
+    directedGraph.addEdge(4, 4, 2);
+    directedGraph.addEdge(3, 5, -1);
+
+    directedGraph.removeVertices(removedVertices);
+    EXPECT_EQ(directedGraph.getTotalWeight(), -1);
+    EXPECT_EQ(directedGraph.getEdgeNumber(), 1);
+    EXPECT_EQ(directedGraph.getEdgeWeight(2, 3), -1);
+
+    UndirectedWeightedGraph undirectedGraph(6);
+    undirectedGraph.addEdge(0, 1, 1.5);
+    undirectedGraph.addEdge(4, 4, 2);
+    undirectedGraph.addEdge(3, 5, -1);
+
+    undirectedGraph.removeVertices(removedVertices);
+    EXPECT_EQ(undirectedGraph.getTotalWeight(), -1);
+    EXPECT_EQ(undirectedGraph.getEdgeNumber(), 1);
+    EXPECT_EQ(undirectedGraph.getEdgeWeight(3, 2), -1);
+}
+
+TEST(Multigraphs, removeVertices_anyGraph_degreesUpdated) {
+    DirectedMultigraph directedGraph(6);
+    directedGraph.addMultiedge(0, 1, 3);
+    directedGraph.addMultiedge(5, 0, 2);
+    directedGraph.addMultiedge(4, 5, 4);
+
+    directedGraph.removeVertices(removedVertices);
+    EXPECT_EQ(directedGraph.getTotalEdgeNumber(), 2);
+    EXPECT_EQ(directedGraph.getEdgeNumber(), 1);
+    EXPECT_EQ(directedGraph.getEdgeMultiplicity(3, 0), 2);
+    EXPECT_EQ(directedGraph.getOutDegrees(), std::vector<size_t>({0, 0, 0, 2}));
+    EXPECT_EQ(directedGraph.getInDegrees(), std::vector<size_t>({2, 0, 0, 0}));
+
+    UndirectedMultigraph undirectedGraph(6);
+    undirectedGraph.addMultiedge(0, 1, 3);
+    undirectedGraph.addMultiedge(5, 0, 2);
+    undirectedGraph.addMultiedge(2, 2, 4);
+
+    undirectedGraph.removeVertices(removedVertices);
+    EXPECT_EQ(undirectedGraph.getTotalEdgeNumber(), 6);
+    EXPECT_EQ(undirectedGraph.getEdgeNumber(), 2);
+    EXPECT_EQ(undirectedGraph.getDegrees(), std::vector<size_t>({2, 8, 0, 2}));
+    EXPECT_EQ(undirectedGraph.getDegree(1, false), 4);
+}
+
+TEST(DenseGraphs, removeVertices_anyGraph_edgesCompacted) {
+    DenseDirectedGraph directedGraph(6);
+    directedGraph.addEdge(0, 5);
+    directedGraph.addEdge(4, 0);
+    directedGraph.addEdge(3, 3);
+
+    EXPECT_EQ(
+        directedGraph.removeVertices(removedVertices), expectedNewIndices
+    );
+    EXPECT_EQ(directedGraph.getSize(), 4);
+    EXPECT_EQ(directedGraph.getEdgeNumber(), 2);
+    EXPECT_TRUE(directedGraph.hasEdge(0, 3));
+    EXPECT_TRUE(directedGraph.hasEdge(2, 2));
+
+    DenseUndirectedGraph undirectedGraph(6);
+    undirectedGraph.addEdge(0, 5);
+    undirectedGraph.addEdge(4, 0);
+    undirectedGraph.addEdge(3, 3);
+
+    undirectedGraph.removeVertices(removedVertices);
+    EXPECT_EQ(undirectedGraph.getEdgeNumber(), 2);
+    EXPECT_TRUE(undirectedGraph.hasEdge(3, 0));
+    EXPECT_TRUE(undirectedGraph.hasEdge(2, 2));
+}